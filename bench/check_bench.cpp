@@ -0,0 +1,139 @@
+/**
+ * \file check_bench.cpp
+ * \brief Time taken to check a script with syntax and sortedness in one pass or in two.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * Usage: check_bench [assertions [directory]]
+ * Writes a QF_AUFLIA script with the given number of assertions (20000 by default) to
+ * the directory (the current one by default) and parses it. Its checks are then timed,
+ * parsing excluded: the syntax checked first and the sortedness afterwards, each in a
+ * pass of its own, and both checked in a single pass, as smtlib-parser does. Each
+ * figure is the best of five runs, the two ways taking turns. Every run is made in a
+ * process of its own, so that it does not inherit the heap left behind by the others.
+ */
+
+#include "exec/execution.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace smtlib;
+
+// Number of declared integer constants used in the terms
+static const int VAR_COUNT = 1000;
+
+// Number of runs of which the fastest is reported
+static const int RUNS = 5;
+
+static string var(long i) {
+    return "x" + to_string(i % VAR_COUNT);
+}
+
+/** Write a script whose assertions mix arithmetic, arrays, Boolean connectives and lets */
+static void writeScript(const string& path, long assertions) {
+    ofstream out(path);
+    out << "(set-logic QF_AUFLIA)\n";
+    for (int i = 0; i < VAR_COUNT; i++) {
+        out << "(declare-fun x" << i << " () Int)\n";
+    }
+    out << "(declare-fun p () Bool)\n";
+    out << "(declare-fun f (Int Int) Int)\n";
+    out << "(declare-fun a () (Array Int Int))\n";
+
+    for (long i = 0; i < assertions; i++) {
+        switch (i % 4) {
+            case 0:
+                out << "(assert (and (< " << var(i) << " " << var(i + 1) << ") (<= (+ " << var(i + 2)
+                    << " 1) (* 2 " << var(i + 3) << ")) (not (= " << var(i) << " " << var(i + 4) << "))))\n";
+                break;
+            case 1:
+                out << "(assert (= (select (store a " << var(i) << " " << var(i + 1) << ") " << var(i + 2)
+                    << ") (f " << var(i + 3) << " (- " << var(i + 4) << " 3))))\n";
+                break;
+            case 2:
+                out << "(assert (=> p (distinct " << var(i) << " " << var(i + 1) << " (ite (> " << var(i + 2)
+                    << " 0) " << var(i + 3) << " " << var(i + 4) << "))))\n";
+                break;
+            default:
+                out << "(assert (let ((y (+ " << var(i) << " " << var(i + 1) << ")) (z (mod " << var(i + 2)
+                    << " 7))) (or (>= y z) (< (abs y) (div z 2)))))\n";
+                break;
+        }
+    }
+    out << "(check-sat)\n";
+}
+
+/** Time taken to check the script, in milliseconds, or a negative number if it has errors */
+static double check(const string& path, bool twoPasses) {
+    sptr_t<SmtExecutionSettings> settings = make_shared<SmtExecutionSettings>();
+    settings->setInputFromFile(path);
+    SmtExecution exec(settings);
+    if (!exec.parse())
+        return -1;
+
+    auto start = chrono::steady_clock::now();
+    bool success = (!twoPasses || exec.checkSyntax()) && exec.checkSortedness();
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return success ? ms : -1;
+}
+
+/** Check the script in a child process, returning the time taken as check() does */
+static double checkInChild(const string& path, bool twoPasses) {
+    int fds[2];
+    if (pipe(fds) != 0)
+        return -1;
+
+    pid_t pid = fork();
+    if (pid == 0) {
+        close(fds[0]);
+        double ms = check(path, twoPasses);
+        ssize_t written = write(fds[1], &ms, sizeof(ms));
+        _exit(written == sizeof(ms) ? 0 : 1);
+    }
+
+    close(fds[1]);
+    double ms = -1;
+    if (pid < 0 || read(fds[0], &ms, sizeof(ms)) != sizeof(ms))
+        ms = -1;
+    close(fds[0]);
+    if (pid > 0)
+        waitpid(pid, NULL, 0);
+    return ms;
+}
+
+int main(int argc, char** argv) {
+    long assertions = argc > 1 ? atol(argv[1]) : 20000;
+    string dir = argc > 2 ? argv[2] : ".";
+    string path = dir + "/check_bench.smt2";
+
+    writeScript(path, assertions);
+
+    // Both ways are timed in turn, so that they run in the same conditions
+    double twoPasses = -1, onePass = -1;
+    for (int i = 0; i < RUNS; i++) {
+        double twoPassesRun = checkInChild(path, true);
+        double onePassRun = checkInChild(path, false);
+        if (twoPassesRun < 0 || onePassRun < 0) {
+            fprintf(stderr, "Could not check '%s'\n", path.c_str());
+            remove(path.c_str());
+            return 1;
+        }
+
+        if (i == 0 || twoPassesRun < twoPasses)
+            twoPasses = twoPassesRun;
+        if (i == 0 || onePassRun < onePass)
+            onePass = onePassRun;
+    }
+    remove(path.c_str());
+
+    printf("Script with %ld assertions:\n", assertions);
+    printf("  %-28s %10.1f ms\n", "syntax, then sortedness", twoPasses);
+    printf("  %-28s %10.1f ms %8.2fx\n", "both in one pass", onePass, twoPasses / onePass);
+    return 0;
+}
@@ -0,0 +1,52 @@
+#include "heap_counter.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <malloc.h>
+#include <new>
+
+using namespace smtlib::bench;
+
+static std::atomic<unsigned long> allocations(0);
+static std::atomic<unsigned long> liveBytes(0);
+
+void* operator new(size_t size) {
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr)
+        throw std::bad_alloc();
+
+    allocations++;
+    liveBytes += malloc_usable_size(ptr);
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    if (ptr) {
+        liveBytes -= malloc_usable_size(ptr);
+        free(ptr);
+    }
+}
+
+void operator delete[](void* ptr) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    operator delete(ptr);
+}
+
+unsigned long HeapCounter::getAllocations() {
+    return allocations;
+}
+
+unsigned long HeapCounter::getLiveBytes() {
+    return liveBytes;
+}
@@ -0,0 +1,28 @@
+/**
+ * \file heap_counter.h
+ * \brief Counting of heap allocations and live heap bytes, for the benchmark programs.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_BENCH_HEAP_COUNTER_H
+#define SMTLIB_PARSER_BENCH_HEAP_COUNTER_H
+
+namespace smtlib {
+    namespace bench {
+        /**
+         * Totals kept by the replacements of the global operator new and delete
+         * defined in heap_counter.cpp, which is linked into each benchmark program
+         * that uses them. Sizes are those of the blocks handed out by malloc.
+         */
+        class HeapCounter {
+        public:
+            /** Number of calls to operator new so far */
+            static unsigned long getAllocations();
+
+            /** Bytes allocated through operator new and not freed yet */
+            static unsigned long getLiveBytes();
+        };
+    }
+}
+
+#endif //SMTLIB_PARSER_BENCH_HEAP_COUNTER_H
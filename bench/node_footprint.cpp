@@ -0,0 +1,101 @@
+/**
+ * \file node_footprint.cpp
+ * \brief Size of each class of AST nodes, and heap taken by the trees of parsed files.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * Usage: node_footprint [file...]
+ * Run from the project root. The sizes are printed first, followed by one line
+ * for each file: its size on disk, the bytes still allocated once it has been
+ * parsed (which is the tree, since parsing keeps nothing else) and the number
+ * of allocations made while parsing it.
+ */
+
+#include "heap_counter.h"
+
+#include "ast/ast_attribute.h"
+#include "ast/ast_basic.h"
+#include "ast/ast_command.h"
+#include "ast/ast_datatype.h"
+#include "ast/ast_identifier.h"
+#include "ast/ast_literal.h"
+#include "ast/ast_match.h"
+#include "ast/ast_script.h"
+#include "ast/ast_sexp.h"
+#include "ast/ast_sort.h"
+#include "ast/ast_symbol_decl.h"
+#include "ast/ast_term.h"
+#include "ast/ast_var.h"
+#include "parser/smtlib_parser.h"
+
+#include <cstdio>
+#include <sys/stat.h>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+using namespace smtlib::bench;
+
+static void printSize(const char* name, size_t size) {
+    printf("  %-32s %4zu\n", name, size);
+}
+
+int main(int argc, char** argv) {
+    printf("Node sizes (bytes):\n");
+    printSize("AstNode", sizeof(AstNode));
+    printSize("Attribute", sizeof(Attribute));
+    printSize("CompAttributeValue", sizeof(CompAttributeValue));
+    printSize("Symbol", sizeof(Symbol));
+    printSize("Keyword", sizeof(Keyword));
+    printSize("MetaSpecConstant", sizeof(MetaSpecConstant));
+    printSize("BooleanValue", sizeof(BooleanValue));
+    printSize("NumeralLiteral", sizeof(NumeralLiteral));
+    printSize("DecimalLiteral", sizeof(DecimalLiteral));
+    printSize("StringLiteral", sizeof(StringLiteral));
+    printSize("SimpleIdentifier", sizeof(SimpleIdentifier));
+    printSize("QualifiedIdentifier", sizeof(QualifiedIdentifier));
+    printSize("Sort", sizeof(Sort));
+    printSize("CompSExpression", sizeof(CompSExpression));
+    printSize("SortedVariable", sizeof(SortedVariable));
+    printSize("VarBinding", sizeof(VarBinding));
+    printSize("QualifiedTerm", sizeof(QualifiedTerm));
+    printSize("LetTerm", sizeof(LetTerm));
+    printSize("ForallTerm", sizeof(ForallTerm));
+    printSize("ExistsTerm", sizeof(ExistsTerm));
+    printSize("MatchTerm", sizeof(MatchTerm));
+    printSize("MatchCase", sizeof(MatchCase));
+    printSize("AnnotatedTerm", sizeof(AnnotatedTerm));
+    printSize("AssertCommand", sizeof(AssertCommand));
+    printSize("DeclareFunCommand", sizeof(DeclareFunCommand));
+    printSize("DefineFunCommand", sizeof(DefineFunCommand));
+    printSize("SortSymbolDeclaration", sizeof(SortSymbolDeclaration));
+    printSize("SimpleFunDeclaration", sizeof(SimpleFunDeclaration));
+    printSize("ParametricFunDeclaration", sizeof(ParametricFunDeclaration));
+    printSize("ConstructorDeclaration", sizeof(ConstructorDeclaration));
+    printSize("Script", sizeof(Script));
+
+    if (argc > 1)
+        printf("Heap after parsing:\n");
+
+    for (int i = 1; i < argc; i++) {
+        struct stat info;
+        if (stat(argv[i], &info) != 0) {
+            printf("  %s: cannot be read\n", argv[i]);
+            continue;
+        }
+
+        unsigned long liveBefore = HeapCounter::getLiveBytes();
+        unsigned long allocsBefore = HeapCounter::getAllocations();
+
+        sptr_t<AstNode> ast;
+        {
+            Parser parser;
+            ast = parser.parse(argv[i]);
+        }
+
+        printf("  %-32s %10ld KiB on disk %10lu KiB live %12lu allocations\n", argv[i],
+               (long) info.st_size / 1024, (HeapCounter::getLiveBytes() - liveBefore) / 1024,
+               HeapCounter::getAllocations() - allocsBefore);
+    }
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+/**
+ * \file printer_bench.cpp
+ * \brief Time taken to print a parsed script of several megabytes back to SMT-LIB.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * Usage: printer_bench [megabytes [directory]]
+ * Writes a QF_LIA script of about the given size (16 MB by default) to the directory
+ * (the current one by default), half of it in wide terms and half in deeply nested
+ * ones, and parses it. The tree is then printed with AstNode::toString() and with an
+ * AstPrinter writing to a file, next to a plain copy of the input file, which gives
+ * the speed of the disk. Each figure is the best of three runs.
+ */
+
+#include "ast/visitor/ast_printer.h"
+#include "parser/smtlib_parser.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <string>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+// Number of declared constants used in the terms
+static const int VAR_COUNT = 1000;
+
+// Number of nested applications in each deep term
+static const int DEEP_TERM_DEPTH = 5000;
+
+// Number of runs of which the fastest is reported
+static const int RUNS = 3;
+
+/** Write a script of about the given size, returning its actual size */
+static long writeScript(const string& path, long size) {
+    ofstream out(path);
+    out << "(set-logic QF_LIA)\n";
+    for (int i = 0; i < VAR_COUNT; i++) {
+        out << "(declare-fun x" << i << " () Int)\n";
+    }
+
+    long written = (long) out.tellp();
+    bool wide = true;
+    while (written < size) {
+        if (wide) {
+            // About 1 MB of comparisons under a single conjunction
+            out << "(assert (and";
+            for (int i = 0; i < 64 * 1024; i++) {
+                out << " (< x" << i % VAR_COUNT << " x" << (i + 1) % VAR_COUNT << ")";
+            }
+            out << "))\n";
+        } else {
+            out << "(assert (> ";
+            for (int i = 0; i < DEEP_TERM_DEPTH; i++) {
+                out << "(+ x" << i % VAR_COUNT << " ";
+            }
+            out << "0" << string(DEEP_TERM_DEPTH, ')') << " 0))\n";
+        }
+
+        wide = !wide;
+        written = (long) out.tellp();
+    }
+
+    return written;
+}
+
+/** Fastest of several runs of a function, in milliseconds */
+static double time(function<void()> run) {
+    double best = 0;
+    for (int i = 0; i < RUNS; i++) {
+        auto start = chrono::steady_clock::now();
+        run();
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        if (i == 0 || ms < best)
+            best = ms;
+    }
+    return best;
+}
+
+static void report(const char* what, double ms, long bytes) {
+    printf("  %-28s %10.1f ms %10.1f MB/s\n", what, ms, bytes / 1048576.0 / (ms / 1000));
+}
+
+int main(int argc, char** argv) {
+    long megabytes = argc > 1 ? atol(argv[1]) : 16;
+    string dir = argc > 2 ? argv[2] : ".";
+    string input = dir + "/printer_bench.in.smt2";
+    string output = dir + "/printer_bench.out.smt2";
+
+    long size = writeScript(input, megabytes * 1048576);
+
+    Parser parser;
+    sptr_t<AstNode> ast = parser.parse(input);
+    if (!ast) {
+        fprintf(stderr, "Could not parse '%s'\n", input.c_str());
+        return 1;
+    }
+
+    long printed = (long) ast->toString().size();
+    printf("Script of %.1f MB, printed as %.1f MB:\n", size / 1048576.0, printed / 1048576.0);
+
+    report("copy of the file", time([&] {
+        ifstream in(input, ios::binary);
+        ofstream out(output, ios::binary);
+        out << in.rdbuf();
+    }), size);
+
+    report("toString()", time([&] {
+        string text = ast->toString();
+        if (text.size() != (size_t) printed)
+            abort();
+    }), printed);
+
+    report("AstPrinter to a file", time([&] {
+        ofstream out(output);
+        AstPrinter printer(out);
+        printer.print(ast);
+    }), printed);
+
+    remove(input.c_str());
+    remove(output.c_str());
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * \file scope_bench.cpp
+ * \brief Time taken to check scripts whose scopes are nested more and more deeply.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * Usage: scope_bench [directory]
+ * For each depth, writes two QF_LIA scripts to the directory (the current one by
+ * default) and times their sortedness check, parsing excluded:
+ *  - an assertion made of nested lets, each binding referring to the previous one;
+ *  - a stack of push levels, each declaring a constant and asserting something
+ *    about it and about a constant declared at the bottom, all popped at the end.
+ * When lookups, additions and pops take constant time, the time per level stays
+ * the same as the depth grows.
+ */
+
+#include "exec/execution.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <functional>
+#include <string>
+
+using namespace std;
+using namespace smtlib;
+
+// Depths of the scripts, each twice the previous one
+static const unsigned long DEPTHS[] = { 2500, 5000, 10000, 20000, 40000 };
+
+static void writeLets(const string& path, unsigned long depth) {
+    ofstream out(path);
+    out << "(set-logic QF_LIA)\n(declare-fun a () Int)\n(assert ";
+    for (unsigned long i = 0; i < depth; i++) {
+        out << "(let ((v" << i << " " << (i == 0 ? string("a") : "(+ v" + to_string(i - 1) + " 1)") << ")) ";
+    }
+    out << "(> v" << depth - 1 << " a)" << string(depth, ')') << ")\n";
+}
+
+static void writePushes(const string& path, unsigned long depth) {
+    ofstream out(path);
+    out << "(set-logic QF_LIA)\n(declare-fun a () Int)\n";
+    for (unsigned long i = 0; i < depth; i++) {
+        out << "(push 1)\n(declare-fun c" << i << " () Int)\n(assert (< a c" << i << "))\n";
+    }
+    out << "(pop " << depth << ")\n(check-sat)\n";
+}
+
+/** Time taken to check a script, in milliseconds, or a negative number if it has errors */
+static double check(const string& path) {
+    sptr_t<SmtExecutionSettings> settings = make_shared<SmtExecutionSettings>();
+    settings->setInputFromFile(path);
+    SmtExecution exec(settings);
+    if (!exec.parse())
+        return -1;
+
+    auto start = chrono::steady_clock::now();
+    bool success = exec.checkSortedness();
+    double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    return success ? ms : -1;
+}
+
+static void run(const char* name, const string& path, function<void(const string&, unsigned long)> write) {
+    printf("%s:\n", name);
+    for (unsigned long depth : DEPTHS) {
+        write(path, depth);
+        double ms = check(path);
+        if (ms < 0)
+            printf("  depth %6lu: check failed\n", depth);
+        else
+            printf("  depth %6lu: %9.1f ms %8.2f us per level\n", depth, ms, 1000 * ms / depth);
+    }
+    remove(path.c_str());
+}
+
+int main(int argc, char** argv) {
+    string dir = argc > 1 ? argv[1] : ".";
+    run("Nested lets", dir + "/scope_bench.lets.smt2", writeLets);
+    run("Nested push levels", dir + "/scope_bench.push.smt2", writePushes);
+    return 0;
+}
@@ -1,7 +1,12 @@
 #include "execution.h"
 
+#include "ast/ast_script.h"
 #include "ast/visitor/ast_syntax_checker.h"
+#include "ast/visitor/ast_visitor_fused.h"
 #include "util/global_values.h"
+#include "util/stats.h"
+
+#include <thread>
 
 
 using namespace std;
@@ -47,7 +52,9 @@ bool SmtExecution::parse() {
     }
 
     if (settings->getInputMethod() == SmtExecutionSettings::InputMethod::INPUT_FILE) {
+        Stats::Timer timer("parse", settings->getFilename());
         sptr_t<Parser> parser = make_shared<Parser>();
+        parser->setDiagnostics(settings->getDiagnostics());
         ast = parser->parse(settings->getFilename().c_str());
         if (ast) {
             parseSuccessful = true;
@@ -70,17 +77,14 @@ bool SmtExecution::checkSyntax() {
         return false;
     }
 
+    Stats::Timer timer("syntax", settings->getFilename());
     sptr_t<SyntaxChecker> chk = make_shared<SyntaxChecker>();
+    chk->setParallelChecking(settings->isParallelChecking());
+    chk->setDiagnostics(settings->getDiagnostics());
     syntaxCheckSuccessful = chk->check(ast);
 
-    if (!syntaxCheckSuccessful) {
-        if (settings->getInputMethod() == SmtExecutionSettings::InputMethod::INPUT_AST) {
-            Logger::syntaxError("SmtExecution::checkSyntax()", chk->getErrors().c_str());
-        } else {
-            Logger::syntaxError("SmtExecution::checkSyntax()",
-                                settings->getFilename().c_str(), chk->getErrors().c_str());
-        }
-    }
+    if (!syntaxCheckSuccessful)
+        reportSyntaxErrors(chk);
 
     return syntaxCheckSuccessful;
 }
@@ -91,11 +95,121 @@ bool SmtExecution::checkSortedness() {
 
     sortednessCheckAttempted = true;
 
-    if (!checkSyntax()) {
-        //Logger::error("SmtExecution::checkSortedness()", "Stopped due to previous errors");
+    if ((settings->isCheckOnReduce() || settings->isPipelinedChecking()) && !parseAttempted
+        && settings->getInputMethod() == SmtExecutionSettings::InputMethod::INPUT_FILE) {
+        return parseAndCheck();
+    }
+
+    // Parallel checks split the script in parts, so syntax is checked for the whole script first
+    if (syntaxCheckAttempted || !parse() || !ast || settings->isParallelChecking()) {
+        if (!checkSyntax()) {
+            //Logger::error("SmtExecution::checkSortedness()", "Stopped due to previous errors");
+            return false;
+        }
+
+        Stats::Timer timer("sortedness", settings->getFilename());
+        sptr_t<SortednessChecker> chk = makeSortednessChecker();
+        sortednessCheckSuccessful = chk->check(ast);
+
+        if (!sortednessCheckSuccessful)
+            reportSortednessErrors(chk);
+
+        return sortednessCheckSuccessful;
+    }
+
+    // Check syntax and sortedness in the same pass, command by command
+    syntaxCheckAttempted = true;
+    Stats::Timer timer("syntax+sortedness", settings->getFilename());
+
+    sptr_t<SyntaxChecker> syntaxChk = make_shared<SyntaxChecker>();
+    syntaxChk->setDiagnostics(settings->getDiagnostics());
+    sptr_t<SortednessChecker> sortChk = makeSortednessChecker();
+
+    // As when the syntax is checked first, sortedness errors are only written if there are no syntax errors
+    sortChk->setHoldingDiagnostics(true);
+
+    FusedVisitor fused;
+    fused.add(syntaxChk);
+    fused.add(sortChk);
+    fused.run(ast);
+
+    return finishChecks(syntaxChk, sortChk);
+}
+
+bool SmtExecution::parseAndCheck() {
+    parseAttempted = true;
+    syntaxCheckAttempted = true;
+    Stats::Timer timer("parse+check", settings->getFilename());
+
+    sptr_t<SyntaxChecker> syntaxChk = make_shared<SyntaxChecker>();
+    syntaxChk->setDiagnostics(settings->getDiagnostics());
+    sptr_t<SortednessChecker> sortChk = makeSortednessChecker();
+
+    // As when the syntax is checked first, sortedness errors are only written if there are no syntax errors
+    sortChk->setHoldingDiagnostics(true);
+
+    // Whether a command is clean must be known right after visiting it, for it to be released
+    sortChk->setParallelChecking(false);
+
+    sptr_t<FusedVisitor> fused = make_shared<FusedVisitor>();
+    fused->add(syntaxChk);
+    fused->add(sortChk);
+    fused->begin();
+
+    sptr_t<Parser> parser = make_shared<Parser>();
+    parser->setDiagnostics(settings->getDiagnostics());
+    sptr_t<CommandPipeline> pipeline;
+
+    // Parsing and checking cannot overlap on a single hardware thread, where the pipeline would only add costs
+    if (settings->isPipelinedChecking() && thread::hardware_concurrency() > 1) {
+        pipeline = make_shared<CommandPipeline>(fused, settings->isCheckOnReduce());
+        parser->setCommandPipeline(pipeline);
+    } else {
+        parser->setCommandVisitor(fused, settings->isCheckOnReduce());
+    }
+
+    ast = parser->parse(settings->getFilename().c_str());
+
+    // Released commands with errors are added back, since the reports point at them
+    if (pipeline) {
+        sptr_v<Command> kept = pipeline->finish();
+        if (ast && ast->getKind() == NODE_SCRIPT) {
+            sptr_v<Command>& commands = dynamic_cast<Script*>(ast.get())->getCommands();
+            commands.insert(commands.end(), kept.begin(), kept.end());
+        }
+    }
+
+    if (!ast) {
+        //Logger::error("SmtExecution::parseAndCheck()", "Stopped due to previous errors");
+        return false;
+    }
+
+    parseSuccessful = true;
+
+    // Theory and logic files have no commands, so they are checked as a whole
+    if (ast->getKind() != NODE_SCRIPT)
+        fused->visitPart(ast.get());
+    fused->end();
+
+    return finishChecks(syntaxChk, sortChk);
+}
+
+bool SmtExecution::finishChecks(sptr_t<SyntaxChecker> syntaxChk, sptr_t<SortednessChecker> sortChk) {
+    syntaxCheckSuccessful = syntaxChk->getErrorCount() == 0;
+    if (!syntaxCheckSuccessful) {
+        reportSyntaxErrors(syntaxChk);
         return false;
     }
 
+    sortChk->writeHeldDiagnostics();
+    sortednessCheckSuccessful = sortChk->getErrorCount() == 0;
+    if (!sortednessCheckSuccessful)
+        reportSortednessErrors(sortChk);
+
+    return sortednessCheckSuccessful;
+}
+
+sptr_t<SortednessChecker> SmtExecution::makeSortednessChecker() {
     sptr_t<SortednessChecker> chk;
 
     if (settings->getSortCheckContext())
@@ -103,18 +217,36 @@ bool SmtExecution::checkSortedness() {
     else
         chk = make_shared<SortednessChecker>();
 
+    chk->setLazyTheoryLoading(settings->isLazyTheoryLoading());
+    chk->setParallelChecking(settings->isParallelChecking());
+    chk->setErrorLimit(settings->getErrorLimit());
+    chk->setDiagnostics(settings->getDiagnostics());
     if (settings->isCoreTheoryEnabled())
         chk->loadTheory(THEORY_CORE);
-    sortednessCheckSuccessful = chk->check(ast);
 
-    if (!sortednessCheckSuccessful) {
-        if (settings->getInputMethod() == SmtExecutionSettings::InputMethod::INPUT_AST) {
-            Logger::sortednessError("SmtExecution::checkSortedness()", chk->getErrors().c_str());
-        } else {
-            Logger::sortednessError("SmtExecution::checkSortedness()",
-                                    settings->getFilename().c_str(), chk->getErrors().c_str());
-        }
+    return chk;
+}
+
+void SmtExecution::reportSyntaxErrors(sptr_t<SyntaxChecker> chk) {
+    if (settings->getDiagnostics())
+        settings->getDiagnostics()->flush();
+
+    if (settings->getInputMethod() == SmtExecutionSettings::InputMethod::INPUT_AST) {
+        Logger::syntaxError("SmtExecution::checkSyntax()", chk->getErrors().c_str());
+    } else {
+        Logger::syntaxError("SmtExecution::checkSyntax()",
+                            settings->getFilename().c_str(), chk->getErrors().c_str());
     }
+}
 
-    return sortednessCheckSuccessful;
-}
\ No newline at end of file
+void SmtExecution::reportSortednessErrors(sptr_t<SortednessChecker> chk) {
+    if (settings->getDiagnostics())
+        settings->getDiagnostics()->flush();
+
+    if (settings->getInputMethod() == SmtExecutionSettings::InputMethod::INPUT_AST) {
+        Logger::sortednessError("SmtExecution::checkSortedness()", chk->getErrors().c_str());
+    } else {
+        Logger::sortednessError("SmtExecution::checkSortedness()",
+                                settings->getFilename().c_str(), chk->getErrors().c_str());
+    }
+}
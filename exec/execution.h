@@ -9,6 +9,7 @@
 
 #include "execution_settings.h"
 
+#include "ast/visitor/ast_syntax_checker.h"
 #include "parser/smtlib_parser.h"
 #include "util/global_typedef.h"
 
@@ -25,6 +26,27 @@ namespace smtlib {
         bool syntaxCheckAttempted, syntaxCheckSuccessful;
         bool sortednessCheckAttempted, sortednessCheckSuccessful;
 
+        /** Create a sortedness checker, as configured by the settings */
+        sptr_t<smtlib::ast::SortednessChecker> makeSortednessChecker();
+
+        /**
+         * Parse the input file, checking each command as soon as it has been parsed,
+         * either right away or on another thread
+         */
+        bool parseAndCheck();
+
+        /**
+         * Report the errors found by a syntax checker and a sortedness checker run together,
+         * as if the syntax had been checked first: sortedness errors, and their diagnostics
+         * held back until now, are only reported if no syntax errors were found
+         * \return Whether both checks succeeded
+         */
+        bool finishChecks(sptr_t<smtlib::ast::SyntaxChecker> syntaxChk,
+                          sptr_t<smtlib::ast::SortednessChecker> sortChk);
+
+        void reportSyntaxErrors(sptr_t<smtlib::ast::SyntaxChecker> chk);
+        void reportSortednessErrors(sptr_t<smtlib::ast::SortednessChecker> chk);
+
     public:
         SmtExecution();
 
@@ -36,7 +58,10 @@ namespace smtlib {
         /** Check syntax correctness of the input */
         bool checkSyntax();
 
-        /** Check sortedness of the input */
+        /**
+         * Check sortedness of the input. Unless the syntax has already been
+         * checked on its own, both checks are done in a single pass.
+         */
         bool checkSortedness();
     };
 }
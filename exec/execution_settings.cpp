@@ -5,10 +5,17 @@ using namespace smtlib;
 using namespace smtlib::ast;
 
 SmtExecutionSettings::SmtExecutionSettings()
-        : coreTheoryEnabled(true), inputMethod(INPUT_NONE) {}
+        : coreTheoryEnabled(true), lazyTheoryLoading(false), checkOnReduce(false),
+          parallelChecking(false), pipelinedChecking(false), errorLimit(0), inputMethod(INPUT_NONE) {}
 
 SmtExecutionSettings::SmtExecutionSettings(sptr_t<SmtExecutionSettings> settings) {
     this->coreTheoryEnabled = settings->coreTheoryEnabled;
+    this->lazyTheoryLoading = settings->lazyTheoryLoading;
+    this->checkOnReduce = settings->checkOnReduce;
+    this->parallelChecking = settings->parallelChecking;
+    this->pipelinedChecking = settings->pipelinedChecking;
+    this->errorLimit = settings->errorLimit;
+    this->diagnostics = settings->diagnostics;
     this->inputMethod = settings->inputMethod;
     this->filename = settings->filename;
     this->ast = settings->ast;
@@ -10,6 +10,7 @@
 #include "ast/ast_abstract.h"
 #include "ast/stack/ast_symbol_stack.h"
 #include "ast/visitor/ast_sortedness_checker.h"
+#include "util/diagnostic_writer.h"
 #include "util/global_typedef.h"
 
 #include <memory>
@@ -22,6 +23,12 @@ namespace smtlib {
 
     private:
         bool coreTheoryEnabled;
+        bool lazyTheoryLoading;
+        bool checkOnReduce;
+        bool parallelChecking;
+        bool pipelinedChecking;
+        unsigned long errorLimit;
+        sptr_t<DiagnosticWriter> diagnostics;
         std::string filename;
         sptr_t<smtlib::ast::AstNode> ast;
         sptr_t<smtlib::ast::ISortCheckContext> sortCheckContext;
@@ -35,6 +42,45 @@ namespace smtlib {
         inline bool isCoreTheoryEnabled() { return coreTheoryEnabled; }
         inline void setCoreTheoryEnabled(bool enabled) { coreTheoryEnabled = enabled; }
 
+        /** Whether the declarations of a theory given as input are only checked once their symbols are needed */
+        inline bool isLazyTheoryLoading() { return lazyTheoryLoading; }
+        inline void setLazyTheoryLoading(bool lazy) { lazyTheoryLoading = lazy; }
+
+        /**
+         * Whether each command of an input file is checked as soon as it has been parsed,
+         * and released afterwards unless errors were found in it
+         */
+        inline bool isCheckOnReduce() { return checkOnReduce; }
+        inline void setCheckOnReduce(bool enabled) { checkOnReduce = enabled; }
+
+        /**
+         * Whether the syntax of a script is checked concurrently, and runs of assertions are
+         * then sort-checked concurrently, against snapshots of the symbol stack. Not used when
+         * checking on reduce, since commands are then released as soon as they have been checked.
+         */
+        inline bool isParallelChecking() { return parallelChecking; }
+        inline void setParallelChecking(bool parallel) { parallelChecking = parallel; }
+
+        /**
+         * Whether the commands of an input file are checked on another thread while the
+         * rest of the file is still being parsed. Combined with checking on reduce, commands
+         * are released once checked, unless errors were found in them. On a single hardware
+         * thread, commands are checked on the parsing thread instead.
+         */
+        inline bool isPipelinedChecking() { return pipelinedChecking; }
+        inline void setPipelinedChecking(bool pipelined) { pipelinedChecking = pipelined; }
+
+        /** Number of sortedness errors after which checking stops (0 if there is no limit) */
+        inline unsigned long getErrorLimit() { return errorLimit; }
+        inline void setErrorLimit(unsigned long limit) { errorLimit = limit; }
+
+        /**
+         * Where errors are written as JSON Lines records, as soon as they are found, besides
+         * being reported once checking is done (none if empty)
+         */
+        inline sptr_t<DiagnosticWriter> getDiagnostics() { return diagnostics; }
+        inline void setDiagnostics(sptr_t<DiagnosticWriter> writer) { diagnostics = writer; }
+
         void setInputFromFile(std::string filename);
 
         void setInputFromAst(sptr_t<smtlib::ast::AstNode> ast);
@@ -0,0 +1,14 @@
+(logic QF_FP
+
+ :smt-lib-version 2.5
+ :written-by "Cesare Tinelli and Martin Brain"
+ :date "2014-05-27"
+
+ :theories (FloatingPoint)
+
+ :language
+ "Closed quantifier-free formulas built over an arbitrary expansion of the
+  FloatingPoint signature with free constant symbols over the sorts
+  RoundingMode and (_ FloatingPoint eb sb) with 1 < eb and 1 < sb.
+ "
+)
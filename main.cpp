@@ -1,5 +1,6 @@
 #include "exec/execution.h"
 #include "util/logger.h"
+#include "util/stats.h"
 
 #include <cstring>
 #include <iostream>
@@ -12,12 +13,32 @@ using namespace smtlib::ast;
 int main(int argc, char **argv) {
     sptr_t<SmtExecutionSettings> settings = make_shared<SmtExecutionSettings>();
     vector<string> files;
+    bool statsJson = false;
 
     for (int i = 1; i < argc; i++) {
         smatch sm;
+        string arg(argv[i]);
 
         if (strcmp(argv[i], "--no-core") == 0) {
             settings->setCoreTheoryEnabled(false);
+        } else if (strcmp(argv[i], "--check-on-reduce") == 0) {
+            settings->setCheckOnReduce(true);
+        } else if (strcmp(argv[i], "--parallel") == 0) {
+            settings->setParallelChecking(true);
+        } else if (strcmp(argv[i], "--pipeline") == 0) {
+            settings->setPipelinedChecking(true);
+        } else if (regex_match(arg, sm, regex("--max-errors=([0-9]+)"))) {
+            settings->setErrorLimit(stoul(sm[1]));
+        } else if (regex_match(arg, sm, regex("--diagnostics=(.+)"))) {
+            sptr_t<DiagnosticWriter> writer = DiagnosticWriter::open(sm[1]);
+            if (!writer) {
+                Logger::error("main()", ("Cannot open diagnostics file '" + sm[1].str() + "'").c_str());
+                return 1;
+            }
+            settings->setDiagnostics(writer);
+        } else if (regex_match(arg, sm, regex("--stats(=(text|json))?"))) {
+            Stats::enable();
+            statsJson = sm[2] == "json";
         } else {
             files.push_back(string(argv[i]));
         }
@@ -28,10 +49,22 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    for (auto fileIt = files.begin(); fileIt != files.end(); fileIt++) {
-        settings->setInputFromFile(*fileIt);
-        SmtExecution exec(settings);
-        exec.checkSortedness();
+    // A parsing error has already been written out when it is caught, and stops the execution
+    try {
+        for (auto fileIt = files.begin(); fileIt != files.end(); fileIt++) {
+            Stats::Timer timer("file", *fileIt);
+            settings->setInputFromFile(*fileIt);
+            SmtExecution exec(settings);
+            exec.checkSortedness();
+        }
+    } catch (const ParseError&) {
+        return Logger::ERR_PARSE;
+    }
+
+    if (Stats::isEnabled()) {
+        cerr << Stats::report(statsJson, [](unsigned kind) {
+            return string(getNodeKindName((NodeKind) kind));
+        });
     }
 
     return 0;
@@ -0,0 +1,88 @@
+#include "ast_abstract.h"
+
+#include "visitor/ast_printer.h"
+
+using namespace std;
+using namespace smtlib::ast;
+
+// Names of the kinds of nodes, in the order in which they are declared
+static const char* NODE_KIND_NAMES[] = {
+    "ATTRIBUTE",
+    "COMP_ATTRIBUTE_VALUE",
+    "SYMBOL",
+    "KEYWORD",
+    "META_SPEC_CONSTANT",
+    "BOOLEAN_VALUE",
+    "PROP_LITERAL",
+    "ASSERT_COMMAND",
+    "CHECK_SAT_COMMAND",
+    "CHECK_SAT_ASSUM_COMMAND",
+    "DECLARE_CONST_COMMAND",
+    "DECLARE_DATATYPE_COMMAND",
+    "DECLARE_DATATYPES_COMMAND",
+    "DECLARE_FUN_COMMAND",
+    "DECLARE_SORT_COMMAND",
+    "DEFINE_FUN_COMMAND",
+    "DEFINE_FUN_REC_COMMAND",
+    "DEFINE_FUNS_REC_COMMAND",
+    "DEFINE_SORT_COMMAND",
+    "ECHO_COMMAND",
+    "EXIT_COMMAND",
+    "GET_ASSERTS_COMMAND",
+    "GET_ASSIGNS_COMMAND",
+    "GET_INFO_COMMAND",
+    "GET_MODEL_COMMAND",
+    "GET_OPTION_COMMAND",
+    "GET_PROOF_COMMAND",
+    "GET_UNSAT_ASSUMS_COMMAND",
+    "GET_UNSAT_CORE_COMMAND",
+    "GET_VALUE_COMMAND",
+    "POP_COMMAND",
+    "PUSH_COMMAND",
+    "RESET_COMMAND",
+    "RESET_ASSERTS_COMMAND",
+    "SET_INFO_COMMAND",
+    "SET_LOGIC_COMMAND",
+    "SET_OPTION_COMMAND",
+    "FUNCTION_DECLARATION",
+    "FUNCTION_DEFINITION",
+    "SIMPLE_IDENTIFIER",
+    "QUALIFIED_IDENTIFIER",
+    "DECIMAL_LITERAL",
+    "NUMERAL_LITERAL",
+    "STRING_LITERAL",
+    "LOGIC",
+    "THEORY",
+    "SCRIPT",
+    "SORT",
+    "COMP_SEXPRESSION",
+    "SORT_SYMBOL_DECLARATION",
+    "SPEC_CONST_FUN_DECLARATION",
+    "META_SPEC_CONST_FUN_DECLARATION",
+    "SIMPLE_FUN_DECLARATION",
+    "PARAMETRIC_FUN_DECLARATION",
+    "SORT_DECLARATION",
+    "SELECTOR_DECLARATION",
+    "CONSTRUCTOR_DECLARATION",
+    "SIMPLE_DATATYPE_DECLARATION",
+    "PARAMETRIC_DATATYPE_DECLARATION",
+    "QUALIFIED_CONSTRUCTOR",
+    "QUALIFIED_PATTERN",
+    "MATCH_CASE",
+    "QUALIFIED_TERM",
+    "LET_TERM",
+    "FORALL_TERM",
+    "EXISTS_TERM",
+    "MATCH_TERM",
+    "ANNOTATED_TERM",
+    "SORTED_VARIABLE",
+    "VAR_BINDING"
+};
+
+const char* smtlib::ast::getNodeKindName(NodeKind kind) {
+    return NODE_KIND_NAMES[kind];
+}
+
+string AstNode::toString() {
+    return AstPrinter::toString(this);
+}
@@ -9,12 +9,89 @@
 
 #include "ast/visitor/ast_visitor.h"
 #include "util/global_typedef.h"
+#include "util/stats.h"
 
 #include <string>
 #include <memory>
 
 namespace smtlib {
     namespace ast {
+        /** Kinds of nodes in the SMT-LIB abstract syntax tree */
+        enum NodeKind {
+            NODE_ATTRIBUTE = 0,
+            NODE_COMP_ATTRIBUTE_VALUE,
+            NODE_SYMBOL,
+            NODE_KEYWORD,
+            NODE_META_SPEC_CONSTANT,
+            NODE_BOOLEAN_VALUE,
+            NODE_PROP_LITERAL,
+            NODE_ASSERT_COMMAND,
+            NODE_CHECK_SAT_COMMAND,
+            NODE_CHECK_SAT_ASSUM_COMMAND,
+            NODE_DECLARE_CONST_COMMAND,
+            NODE_DECLARE_DATATYPE_COMMAND,
+            NODE_DECLARE_DATATYPES_COMMAND,
+            NODE_DECLARE_FUN_COMMAND,
+            NODE_DECLARE_SORT_COMMAND,
+            NODE_DEFINE_FUN_COMMAND,
+            NODE_DEFINE_FUN_REC_COMMAND,
+            NODE_DEFINE_FUNS_REC_COMMAND,
+            NODE_DEFINE_SORT_COMMAND,
+            NODE_ECHO_COMMAND,
+            NODE_EXIT_COMMAND,
+            NODE_GET_ASSERTS_COMMAND,
+            NODE_GET_ASSIGNS_COMMAND,
+            NODE_GET_INFO_COMMAND,
+            NODE_GET_MODEL_COMMAND,
+            NODE_GET_OPTION_COMMAND,
+            NODE_GET_PROOF_COMMAND,
+            NODE_GET_UNSAT_ASSUMS_COMMAND,
+            NODE_GET_UNSAT_CORE_COMMAND,
+            NODE_GET_VALUE_COMMAND,
+            NODE_POP_COMMAND,
+            NODE_PUSH_COMMAND,
+            NODE_RESET_COMMAND,
+            NODE_RESET_ASSERTS_COMMAND,
+            NODE_SET_INFO_COMMAND,
+            NODE_SET_LOGIC_COMMAND,
+            NODE_SET_OPTION_COMMAND,
+            NODE_FUNCTION_DECLARATION,
+            NODE_FUNCTION_DEFINITION,
+            NODE_SIMPLE_IDENTIFIER,
+            NODE_QUALIFIED_IDENTIFIER,
+            NODE_DECIMAL_LITERAL,
+            NODE_NUMERAL_LITERAL,
+            NODE_STRING_LITERAL,
+            NODE_LOGIC,
+            NODE_THEORY,
+            NODE_SCRIPT,
+            NODE_SORT,
+            NODE_COMP_SEXPRESSION,
+            NODE_SORT_SYMBOL_DECLARATION,
+            NODE_SPEC_CONST_FUN_DECLARATION,
+            NODE_META_SPEC_CONST_FUN_DECLARATION,
+            NODE_SIMPLE_FUN_DECLARATION,
+            NODE_PARAMETRIC_FUN_DECLARATION,
+            NODE_SORT_DECLARATION,
+            NODE_SELECTOR_DECLARATION,
+            NODE_CONSTRUCTOR_DECLARATION,
+            NODE_SIMPLE_DATATYPE_DECLARATION,
+            NODE_PARAMETRIC_DATATYPE_DECLARATION,
+            NODE_QUALIFIED_CONSTRUCTOR,
+            NODE_QUALIFIED_PATTERN,
+            NODE_MATCH_CASE,
+            NODE_QUALIFIED_TERM,
+            NODE_LET_TERM,
+            NODE_FORALL_TERM,
+            NODE_EXISTS_TERM,
+            NODE_MATCH_TERM,
+            NODE_ANNOTATED_TERM,
+            NODE_SORTED_VARIABLE,
+            NODE_VAR_BINDING
+        };
+
+        /** Name of a kind of node, as in its enumerator */
+        const char* getNodeKindName(NodeKind kind);
 
         /** Node of the SMT-LIB abstract syntax tree */
         class AstNode {
@@ -23,10 +100,21 @@ namespace smtlib {
             int rowRight;
             int colLeft;
             int colRight;
-            sptr_t<std::string> filename;
+            const std::string* filename;
+            NodeKind kind;
+
+        protected:
+            /**
+             * \param kind  Kind of the node, fixed by each concrete node class
+             */
+            AstNode(NodeKind kind) : rowLeft(0), rowRight(0), colLeft(0), colRight(0),
+                                     filename(NULL), kind(kind) {
+                Stats::countNode(kind);
+            }
 
         public:
-            AstNode() : rowLeft(0), colLeft(0), rowRight(0), colRight(0) { }
+            /** Get the kind of the node */
+            inline NodeKind getKind() { return kind; }
 
             /** Get row where node begins */
             inline int getRowLeft() { return rowLeft; }
@@ -52,21 +140,23 @@ namespace smtlib {
             /** Set column where node ends */
             inline void setColRight(int colRight) { this->colRight = colRight; }
 
-            /** Get name of the source file */
-            inline sptr_t<std::string> getFilename() { return filename; }
+            /** Get name of the source file (interned by the parser, shared by all nodes of the file) */
+            inline const std::string* getFilename() { return filename; }
 
             /** Set name of the source file */
-            inline void setFilename(sptr_t<std::string> filename) { this->filename = filename; }
+            inline void setFilename(const std::string* filename) { this->filename = filename; }
 
             /** Accept a visitor */
             virtual void accept(class AstVisitor0* visitor) = 0;
 
-            /** Get string representation of the node */
-            virtual std::string toString() = 0;
+            /** Get string representation of the node (printed by AstPrinter) */
+            std::string toString();
         };
 
         /** Root of the SMT-LIB abstract syntax tree */
         class AstRoot : public AstNode {
+        protected:
+            AstRoot(NodeKind kind) : AstNode(kind) { }
         };
     }
 }
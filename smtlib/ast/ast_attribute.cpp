@@ -1,43 +1,20 @@
 #include "ast_attribute.h"
 
-#include <sstream>
-
 using namespace smtlib::ast;
 using namespace std;
 
 /* ==================================== Attribute ===================================== */
 
 void Attribute::accept(AstVisitor0* visitor) {
-    visitor->visit(shared_from_this());
-}
-
-string Attribute::toString() {
-    stringstream ss;
-    ss << keyword->toString();
-    if(value) {
-        ss << " " << value->toString();
-    }
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ================================ CompAttributeValue ================================ */
 
-CompAttributeValue::CompAttributeValue(sptr_v<AttributeValue>& values) {
+CompAttributeValue::CompAttributeValue(sptr_v<AttributeValue>& values) : AttributeValue(NODE_COMP_ATTRIBUTE_VALUE) {
     this->values.insert(this->values.begin(), values.begin(), values.end());
 }
 
 void CompAttributeValue::accept(AstVisitor0* visitor) {
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string CompAttributeValue::toString() {
-    stringstream ss;
-    ss << "(";
-    for (auto valueIt = values.begin(); valueIt != values.end(); valueIt++) {
-        ss << (*valueIt)->toString();
-        if(valueIt + 1 != values.end())
-            ss << " ";
-    }
-    ss << ")";
-    return ss.str();
-}
\ No newline at end of file
@@ -27,13 +27,13 @@ namespace smtlib {
 
         public:
             /** Default constructor. */
-            inline Attribute() { }
+            inline Attribute() : AstNode(NODE_ATTRIBUTE) { }
 
             /**
              * Constructs keyword without attribute value.
              * \param keyword   Keyword of the attribute
              */
-            inline Attribute(sptr_t<Keyword> keyword) : keyword(keyword) { }
+            inline Attribute(sptr_t<Keyword> keyword) : AstNode(NODE_ATTRIBUTE), keyword(keyword) { }
 
             /**
              * Constructs keyword with attribute value.
@@ -42,7 +42,7 @@ namespace smtlib {
              */
             inline Attribute(sptr_t<Keyword> keyword,
                              sptr_t<AttributeValue> value)
-                    : keyword(keyword), value(value) { }
+                    : AstNode(NODE_ATTRIBUTE), keyword(keyword), value(value) { }
 
             inline sptr_t<Keyword> getKeyword() { return keyword; }
 
@@ -53,8 +53,6 @@ namespace smtlib {
             inline void setValue(sptr_t<AttributeValue> value) { this->value = value; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ============================== CompAttributeValue ============================== */
@@ -73,8 +71,6 @@ namespace smtlib {
             inline sptr_v<AttributeValue>& getValues() { return values; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -1,69 +1,34 @@
 #include "ast_basic.h"
 
-#include "util/global_values.h"
-
-#include <sstream>
-
 using namespace smtlib::ast;
 using namespace std;
 
 /* ====================================== Symbol ====================================== */
 
 void Symbol::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string Symbol::toString() {
-    return value;
+    visitor->visit(this);
 }
 
 /* ====================================== Keyword ===================================== */
 
 void Keyword::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string Keyword::toString() {
-    return value;
+    visitor->visit(this);
 }
 
 /* ================================= MetaSpecConstant ================================= */
 
 void MetaSpecConstant::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string MetaSpecConstant::toString() {
-    return (type == META_SPEC_STRING) ? MSCONST_STRING
-                                      : (type == META_SPEC_NUMERAL ? MSCONST_NUMERAL
-                                                                   : MSCONST_DECIMAL);
+    visitor->visit(this);
 }
 
 /* =================================== BooleanValue =================================== */
 
 void BooleanValue::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string BooleanValue::toString() {
-    if(value)
-        return CONST_TRUE;
-    else
-        return CONST_FALSE;
+    visitor->visit(this);
 }
 
 /* =================================== PropLiteral ==================================== */
 
 void PropLiteral::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string PropLiteral::toString() {
-    if(negated) {
-        stringstream ss;
-        ss << "(not " << symbol->toString() << ")";
-        return ss.str();
-    } else {
-        return symbol->toString();
-    }
-}
\ No newline at end of file
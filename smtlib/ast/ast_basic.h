@@ -21,27 +21,30 @@ namespace smtlib {
          * Node of the SMT-LIB abstract syntax tree.
          * Can act as an S-expression, an index.
          */
-        class Symbol : public virtual AstNode,
-                       public SExpression,
-                       public Index,
-                       public AttributeValue,
-                       public Constructor,
+        class Symbol : public Constructor,
                        public std::enable_shared_from_this<Symbol> {
         private:
             std::string value;
+            bool validated;
         public:
             /**
              * \param value     Textual value of the symbol
+             * \param validated Whether the value is known to be well-formed (e.g. it was matched by the lexer)
              */
-            inline Symbol(std::string value) : value(value) { }
+            inline Symbol(std::string value, bool validated = false)
+                    : Constructor(NODE_SYMBOL), value(value), validated(validated) { }
 
             inline std::string& getValue() { return value; }
 
-            inline void setValue(std::string value) { this->value = value; }
+            inline void setValue(std::string value) {
+                this->value = value;
+                this->validated = false;
+            }
 
-            virtual void accept(AstVisitor0* visitor);
+            /** Whether the value is known to be well-formed, so that it need not be checked again */
+            inline bool isValidated() { return validated; }
 
-            virtual std::string toString();
+            virtual void accept(AstVisitor0* visitor);
         };
 
         /* ====================================== Keyword ===================================== */
@@ -50,24 +53,30 @@ namespace smtlib {
          * Node of the SMT-LIB abstract syntax tree.
          * Can act as an S-expression.
          */
-        class Keyword : public virtual AstNode,
-                        public SExpression,
+        class Keyword : public SExpression,
                         public std::enable_shared_from_this<Keyword> {
         private:
             std::string value;
+            bool validated;
         public:
             /**
              * \param value     Textual value of the keyword
+             * \param validated Whether the value is known to be well-formed (e.g. it was matched by the lexer)
              */
-            inline Keyword(std::string value) : value(value) { }
+            inline Keyword(std::string value, bool validated = false)
+                    : SExpression(NODE_KEYWORD), value(value), validated(validated) { }
 
             inline std::string& getValue() { return value; }
 
-            inline void setValue(std::string value) { this->value = value; }
+            inline void setValue(std::string value) {
+                this->value = value;
+                this->validated = false;
+            }
 
-            virtual void accept(AstVisitor0* visitor);
+            /** Whether the value is known to be well-formed, so that it need not be checked again */
+            inline bool isValidated() { return validated; }
 
-            virtual std::string toString();
+            virtual void accept(AstVisitor0* visitor);
         };
 
         /* ================================= MetaSpecConstant ================================= */
@@ -88,7 +97,7 @@ namespace smtlib {
             /**
              * \param type  Meta specification constant type
              */
-            inline MetaSpecConstant(MetaSpecConstant::Type type) : type(type) { }
+            inline MetaSpecConstant(MetaSpecConstant::Type type) : AstNode(NODE_META_SPEC_CONSTANT), type(type) { }
 
             inline MetaSpecConstant::Type getType() { return type; }
 
@@ -96,8 +105,6 @@ namespace smtlib {
 
             virtual void accept(AstVisitor0* visitor);
 
-            virtual std::string toString();
-
         private:
             MetaSpecConstant::Type type;
         };
@@ -107,8 +114,7 @@ namespace smtlib {
          * A boolean value ('true' or 'false').
          * Node of the SMT-LIB abstract syntax tree.
          */
-        class BooleanValue : public virtual AstNode,
-                             public AttributeValue,
+        class BooleanValue : public AttributeValue,
                              public std::enable_shared_from_this<BooleanValue> {
         private:
             bool value;
@@ -116,15 +122,13 @@ namespace smtlib {
             /**
              * \param value Truth value ("true" or "false")
              */
-            inline BooleanValue(bool value) : value(value) { }
+            inline BooleanValue(bool value) : AttributeValue(NODE_BOOLEAN_VALUE), value(value) { }
 
             inline bool getValue() { return value; }
 
             inline void setValue(bool value) { this->value = value; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =================================== PropLiteral ==================================== */
@@ -144,7 +148,7 @@ namespace smtlib {
              * \param negated   Whether the symbol is negated
              */
             inline PropLiteral(sptr_t<Symbol> symbol, bool negated)
-                    : symbol(symbol), negated(negated) { }
+                    : AstNode(NODE_PROP_LITERAL), symbol(symbol), negated(negated) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -155,8 +159,6 @@ namespace smtlib {
             inline void setNegated(bool negated) { this->negated = negated; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -23,7 +23,10 @@ namespace smtlib {
     namespace ast {
         /* ===================================== Command ====================================== */
         /** Abstract root of the hierarchy of commands */
-        class Command : public AstNode { };
+        class Command : public AstNode {
+        protected:
+            Command(NodeKind kind) : AstNode(kind) { }
+        };
 
         /* ================================== AssertCommand =================================== */
         /**
@@ -39,15 +42,13 @@ namespace smtlib {
             /**
              * \param term  Asserted term
              */
-            inline AssertCommand(sptr_t<Term> term) : term(term) { }
+            inline AssertCommand(sptr_t<Term> term) : Command(NODE_ASSERT_COMMAND), term(term) { }
 
             inline sptr_t<Term> getTerm() { return term; }
 
             inline void setTerm(sptr_t<Term> term) { this->term = term; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= CheckSatCommand ================================== */
@@ -58,11 +59,9 @@ namespace smtlib {
         class CheckSatCommand : public Command,
                                 public std::enable_shared_from_this<CheckSatCommand> {
         public:
-            inline CheckSatCommand() { }
+            inline CheckSatCommand() : Command(NODE_CHECK_SAT_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== CheckSatAssumCommand =============================== */
@@ -84,8 +83,6 @@ namespace smtlib {
             inline sptr_v<PropLiteral>& getAssumptions() { return assumptions; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== DeclareConstCommand ================================ */
@@ -104,7 +101,7 @@ namespace smtlib {
              * \param sort  Sort of the constant
              */
             inline DeclareConstCommand(sptr_t<Symbol> symbol, sptr_t<Sort> sort)
-                    : symbol(symbol), sort(sort) { }
+                    : Command(NODE_DECLARE_CONST_COMMAND), symbol(symbol), sort(sort) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -115,8 +112,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ============================== DeclareDatatypeCommand ============================== */
@@ -135,7 +130,7 @@ namespace smtlib {
              */
             inline DeclareDatatypeCommand(sptr_t<Symbol> symbol,
                                           sptr_t<DatatypeDeclaration> declaration)
-                    : symbol(symbol), declaration(declaration) { }
+                    : Command(NODE_DECLARE_DATATYPE_COMMAND), symbol(symbol), declaration(declaration) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -148,8 +143,6 @@ namespace smtlib {
             }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ============================= DeclareDatatypesCommand ============================== */
@@ -175,8 +168,6 @@ namespace smtlib {
             inline sptr_v<DatatypeDeclaration>& getDeclarations() { return declarations; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ DeclareFunCommand ================================= */
@@ -211,8 +202,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ DeclareSortCommand ================================ */
@@ -232,7 +221,7 @@ namespace smtlib {
              */
             inline DeclareSortCommand(sptr_t<Symbol> symbol,
                                       sptr_t<NumeralLiteral> arity)
-                    : symbol(symbol), arity(arity) { }
+                    : Command(NODE_DECLARE_SORT_COMMAND), symbol(symbol), arity(arity) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -243,8 +232,6 @@ namespace smtlib {
             inline void setArity(sptr_t<NumeralLiteral> arity) { this->arity = arity; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= DefineFunCommand ================================= */
@@ -261,7 +248,7 @@ namespace smtlib {
              * \param definition    Function definition
              */
             inline DefineFunCommand(sptr_t<FunctionDefinition> definition)
-                    : definition(definition) { }
+                    : Command(NODE_DEFINE_FUN_COMMAND), definition(definition) { }
 
             /**
              * \param signature    Function signature
@@ -269,7 +256,7 @@ namespace smtlib {
              */
             inline DefineFunCommand(sptr_t<FunctionDeclaration> signature,
                                     sptr_t<Term> body)
-                    : definition(std::make_shared<FunctionDefinition>(signature, body)) { }
+                    : Command(NODE_DEFINE_FUN_COMMAND), definition(std::make_shared<FunctionDefinition>(signature, body)) { }
 
             /**
              * \param symbol    Name of the function
@@ -287,8 +274,6 @@ namespace smtlib {
             inline void setDefinition(sptr_t<FunctionDefinition> definition) { this->definition = definition; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ DefineFunRecCommand =============================== */
@@ -305,13 +290,13 @@ namespace smtlib {
              * \param definition    Function definition
              */
             inline DefineFunRecCommand(sptr_t<FunctionDefinition> definition)
-                    : definition(definition) { }
+                    : Command(NODE_DEFINE_FUN_REC_COMMAND), definition(definition) { }
 
             /**
              * \param signature    Function signature
              * \param body         Function body
              */
-            inline DefineFunRecCommand(sptr_t<FunctionDeclaration> signature, sptr_t<Term> body) {
+            inline DefineFunRecCommand(sptr_t<FunctionDeclaration> signature, sptr_t<Term> body) : Command(NODE_DEFINE_FUN_REC_COMMAND) {
                 definition = std::make_shared<FunctionDefinition>(signature, body);
             }
 
@@ -331,8 +316,6 @@ namespace smtlib {
             inline void setDefinition(sptr_t<FunctionDefinition> definition) { this->definition = definition; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== DefineFunsRecCommand =============================== */
@@ -357,8 +340,6 @@ namespace smtlib {
             inline sptr_v<Term>& getBodies() { return bodies; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ DefineSortCommand ================================= */
@@ -391,8 +372,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =================================== EchoCommand ==================================== */
@@ -408,15 +387,13 @@ namespace smtlib {
             /**
              * \param   Message to print
              */
-            inline EchoCommand(std::string message) : message(message) { }
+            inline EchoCommand(std::string message) : Command(NODE_ECHO_COMMAND), message(message) { }
 
             inline std::string &getMessage() { return message; }
 
             inline void setMessage(std::string message) { this->message = message; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =================================== ExitCommand ==================================== */
@@ -427,11 +404,9 @@ namespace smtlib {
         class ExitCommand : public Command,
                             public std::enable_shared_from_this<ExitCommand> {
         public:
-            inline ExitCommand() { }
+            inline ExitCommand() : Command(NODE_EXIT_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ GetAssertsCommand ================================= */
@@ -442,11 +417,9 @@ namespace smtlib {
         class GetAssertsCommand : public Command,
                                   public std::enable_shared_from_this<GetAssertsCommand> {
         public:
-            inline GetAssertsCommand() { }
+            inline GetAssertsCommand() : Command(NODE_GET_ASSERTS_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ GetAssignsCommand ================================= */
@@ -457,11 +430,9 @@ namespace smtlib {
         class GetAssignsCommand : public Command,
                                   public std::enable_shared_from_this<GetAssignsCommand> {
         public:
-            inline GetAssignsCommand() { }
+            inline GetAssignsCommand() : Command(NODE_GET_ASSIGNS_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================== GetInfoCommand ================================== */
@@ -477,15 +448,13 @@ namespace smtlib {
             /**
              * \param flag  Flag name
              */
-            inline GetInfoCommand(sptr_t<Keyword> flag) : flag(flag) { }
+            inline GetInfoCommand(sptr_t<Keyword> flag) : Command(NODE_GET_INFO_COMMAND), flag(flag) { }
 
             inline sptr_t<Keyword> getFlag() { return flag; }
 
             inline void setFlag(sptr_t<Keyword> flag) { this->flag = flag; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= GetModelCommand ================================== */
@@ -496,11 +465,9 @@ namespace smtlib {
         class GetModelCommand : public Command,
                                 public std::enable_shared_from_this<GetModelCommand> {
         public:
-            inline GetModelCommand() { }
+            inline GetModelCommand() : Command(NODE_GET_MODEL_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= GetOptionCommand ================================= */
@@ -516,15 +483,13 @@ namespace smtlib {
             /**
              * \param option    Option name
              */
-            inline GetOptionCommand(sptr_t<Keyword> option) : option(option) { }
+            inline GetOptionCommand(sptr_t<Keyword> option) : Command(NODE_GET_OPTION_COMMAND), option(option) { }
 
             inline sptr_t<Keyword> getOption() { return option; }
 
             inline void setOption(sptr_t<Keyword> option) { this->option = option; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= GetProofCommand ================================== */
@@ -535,11 +500,9 @@ namespace smtlib {
         class GetProofCommand : public Command,
                                 public std::enable_shared_from_this<GetProofCommand> {
         public:
-            inline GetProofCommand() { }
+            inline GetProofCommand() : Command(NODE_GET_PROOF_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ============================== GetUnsatAssumsCommand =============================== */
@@ -550,11 +513,9 @@ namespace smtlib {
         class GetUnsatAssumsCommand : public Command,
                                       public std::enable_shared_from_this<GetUnsatAssumsCommand> {
         public:
-            inline GetUnsatAssumsCommand() { }
+            inline GetUnsatAssumsCommand() : Command(NODE_GET_UNSAT_ASSUMS_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== GetUnsatCoreCommand ================================ */
@@ -565,11 +526,9 @@ namespace smtlib {
         class GetUnsatCoreCommand : public Command,
                                     public std::enable_shared_from_this<GetUnsatCoreCommand> {
         public:
-            inline GetUnsatCoreCommand() { }
+            inline GetUnsatCoreCommand() : Command(NODE_GET_UNSAT_CORE_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= GetValueCommand ================================== */
@@ -590,8 +549,6 @@ namespace smtlib {
             inline sptr_v<Term>& getTerms() { return terms; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ==================================== PopCommand ==================================== */
@@ -607,15 +564,13 @@ namespace smtlib {
             /**
              * \param numeral   Number of levels to pop
              */
-            inline PopCommand(sptr_t<NumeralLiteral> numeral) : numeral(numeral) { }
+            inline PopCommand(sptr_t<NumeralLiteral> numeral) : Command(NODE_POP_COMMAND), numeral(numeral) { }
 
             inline sptr_t<NumeralLiteral> getNumeral() { return numeral; }
 
             inline void setNumeral(sptr_t<NumeralLiteral> numeral) { this->numeral = numeral; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =================================== PushCommand ==================================== */
@@ -631,15 +586,13 @@ namespace smtlib {
             /**
              * \param numeral   Number of levels to push
              */
-            inline PushCommand(sptr_t<NumeralLiteral> numeral) : numeral(numeral) { }
+            inline PushCommand(sptr_t<NumeralLiteral> numeral) : Command(NODE_PUSH_COMMAND), numeral(numeral) { }
 
             inline sptr_t<NumeralLiteral> getNumeral() { return numeral; }
 
             inline void setNumeral(sptr_t<NumeralLiteral> numeral) { this->numeral = numeral; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =================================== ResetCommand =================================== */
@@ -650,11 +603,9 @@ namespace smtlib {
         class ResetCommand : public Command,
                              public std::enable_shared_from_this<ResetCommand> {
         public:
-            inline ResetCommand() { }
+            inline ResetCommand() : Command(NODE_RESET_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== ResetAssertsCommand ================================ */
@@ -665,11 +616,9 @@ namespace smtlib {
         class ResetAssertsCommand : public Command,
                                     public std::enable_shared_from_this<ResetAssertsCommand> {
         public:
-            inline ResetAssertsCommand() { }
+            inline ResetAssertsCommand() : Command(NODE_RESET_ASSERTS_COMMAND) { }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================== SetInfoCommand ================================== */
@@ -685,15 +634,13 @@ namespace smtlib {
             /**
              * \param info    Info to set
              */
-            inline SetInfoCommand(sptr_t<Attribute> info) : info(info) { }
+            inline SetInfoCommand(sptr_t<Attribute> info) : Command(NODE_SET_INFO_COMMAND), info(info) { }
 
             inline sptr_t<Attribute> getInfo() { return info; }
 
             inline void setInfo(sptr_t<Attribute> info) { this->info = info; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= SetLogicCommand ================================== */
@@ -709,15 +656,13 @@ namespace smtlib {
             /**
              * \param name  Name of the logic to set
              */
-            inline SetLogicCommand(sptr_t<Symbol> logic) : logic(logic) { }
+            inline SetLogicCommand(sptr_t<Symbol> logic) : Command(NODE_SET_LOGIC_COMMAND), logic(logic) { }
 
             inline sptr_t<Symbol> getLogic() { return logic; }
 
             inline void setLogic(sptr_t<Symbol> logic) { this->logic = logic; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= SetOptionCommand ================================= */
@@ -733,15 +678,13 @@ namespace smtlib {
             /**
              * \param option    Option to set
              */
-            inline SetOptionCommand(sptr_t<Attribute> option) : option(option) { }
+            inline SetOptionCommand(sptr_t<Attribute> option) : Command(NODE_SET_OPTION_COMMAND), option(option) { }
 
             inline sptr_t<Attribute> getOption() { return option; }
 
             inline void setOption(sptr_t<Attribute> option) { this->option = option; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -31,7 +31,7 @@ namespace smtlib {
              */
             inline SortDeclaration(sptr_t<Symbol> symbol,
                                    sptr_t<NumeralLiteral> arity)
-                    : symbol(symbol), arity(arity) { }
+                    : AstNode(NODE_SORT_DECLARATION), symbol(symbol), arity(arity) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -42,8 +42,6 @@ namespace smtlib {
             inline void setArity(sptr_t<NumeralLiteral> arity) { this->arity = arity; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== SelectorDeclaration ================================ */
@@ -63,7 +61,7 @@ namespace smtlib {
              */
             inline SelectorDeclaration(sptr_t<Symbol> symbol,
                                        sptr_t<Sort> sort)
-                    : symbol(symbol), sort(sort) { }
+                    : AstNode(NODE_SELECTOR_DECLARATION), symbol(symbol), sort(sort) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -74,8 +72,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== ConstructorDeclaration ============================== */
@@ -103,8 +99,6 @@ namespace smtlib {
             inline sptr_v<SelectorDeclaration>& getSelectors() { return selectors; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ DatatypeDeclaration =============================== */
@@ -112,7 +106,10 @@ namespace smtlib {
          * A datatype declaration (used by the declare-datatype and declare-datatypes commands).
          * Node of the SMT-LIB abstract syntax tree.
          */
-        class DatatypeDeclaration : public AstNode { };
+        class DatatypeDeclaration : public AstNode {
+        protected:
+            DatatypeDeclaration(NodeKind kind) : AstNode(kind) { }
+        };
 
         /* ============================= SimpleDatatypeDeclaration ============================ */
         /**
@@ -132,8 +129,6 @@ namespace smtlib {
             inline sptr_v<ConstructorDeclaration>& getConstructors() { return constructors; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =========================== ParametricDatatypeDeclaration ========================== */
@@ -159,8 +154,6 @@ namespace smtlib {
             inline sptr_v<ConstructorDeclaration>& getConstructors() { return constructors; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
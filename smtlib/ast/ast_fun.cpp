@@ -1,7 +1,5 @@
 #include "ast_fun.h"
 
-#include <sstream>
-
 using namespace std;
 using namespace smtlib::ast;
 
@@ -10,27 +8,12 @@ using namespace smtlib::ast;
 FunctionDeclaration::FunctionDeclaration(sptr_t<Symbol> symbol,
                                          sptr_v<SortedVariable>& params,
                                          sptr_t<Sort> sort)
-        : symbol(symbol), sort(sort) {
+        : AstNode(NODE_FUNCTION_DECLARATION), symbol(symbol), sort(sort) {
     this->params.insert(this->params.end(), params.begin(), params.end());
 }
 
 void FunctionDeclaration::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string FunctionDeclaration::toString() {
-    stringstream ss;
-    ss << symbol->toString() << " (";
-
-    for (auto paramIt = params.begin(); paramIt != params.end(); paramIt++) {
-        if(paramIt != params.begin())
-            ss << " ";
-        ss << "(" << (*paramIt)->toString() << ")";
-    }
-
-    ss << ") " << sort->toString();
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ================================ FunctionDefinition ================================ */
@@ -39,16 +22,10 @@ FunctionDefinition::FunctionDefinition(sptr_t<Symbol> symbol,
                                        sptr_v<SortedVariable>& params,
                                        sptr_t<Sort> sort,
                                        sptr_t<Term> body)
-        : body(body) {
+        : AstNode(NODE_FUNCTION_DEFINITION), body(body) {
     signature = make_shared<FunctionDeclaration>(symbol, params, sort);
 }
 
 void FunctionDefinition::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string FunctionDefinition::toString() {
-    stringstream ss;
-    ss << signature->toString() << " " << body->toString();
-    return ss.str();
-}
\ No newline at end of file
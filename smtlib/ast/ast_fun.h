@@ -52,8 +52,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort;}
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================ FunctionDefinition ================================ */
@@ -73,7 +71,7 @@ namespace smtlib {
              */
             FunctionDefinition(sptr_t<FunctionDeclaration> signature,
                                sptr_t<Term> body)
-                    : signature(signature), body(body) { }
+                    : AstNode(NODE_FUNCTION_DEFINITION), signature(signature), body(body) { }
 
             /**
              * \param symbol    Name of the function
@@ -95,8 +93,6 @@ namespace smtlib {
             inline void setBody(sptr_t<Term> body) { this->body = body; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -1,6 +1,7 @@
 #include "ast_identifier.h"
+#include "ast_literal.h"
 
-#include <sstream>
+#include <functional>
 
 using namespace std;
 using namespace smtlib::ast;
@@ -9,7 +10,7 @@ using namespace smtlib::ast;
 
 SimpleIdentifier::SimpleIdentifier(sptr_t<Symbol> symbol,
                                    sptr_v<Index>& indices)
-        : symbol(symbol) {
+        : Identifier(NODE_SIMPLE_IDENTIFIER), symbol(symbol) {
     this->indices.insert(this->indices.end(), indices.begin(), indices.end());
 }
 
@@ -17,33 +18,52 @@ bool SimpleIdentifier::isIndexed() {
     return !indices.empty();
 }
 
-void SimpleIdentifier::accept(AstVisitor0* visitor) {
-    visitor->visit(shared_from_this());
+static bool equalIndices(Index* index1, Index* index2) {
+    if (index1->getKind() != index2->getKind())
+        return false;
+
+    if (index1->getKind() == NODE_SYMBOL) {
+        return static_cast<Symbol*>(index1)->getValue() == static_cast<Symbol*>(index2)->getValue();
+    } else if (index1->getKind() == NODE_NUMERAL_LITERAL) {
+        NumeralLiteral* num1 = static_cast<NumeralLiteral*>(index1);
+        NumeralLiteral* num2 = static_cast<NumeralLiteral*>(index2);
+        return num1->getValue() == num2->getValue() && num1->getBase() == num2->getBase();
+    } else {
+        return index1->toString() == index2->toString();
+    }
 }
 
-string SimpleIdentifier::toString() {
-    if (!isIndexed())
-        return symbol->toString();
-    else {
-        stringstream ss;
-        ss << "( _ " << symbol->toString() << " ";
-        for (auto indexIt = indices.begin(); indexIt != indices.end(); indexIt++) {
-            if (indexIt != indices.begin())
-                ss << " ";
-            ss << (*indexIt)->toString();
-        }
-        ss << ")";
-        return ss.str();
+bool SimpleIdentifier::equals(SimpleIdentifier* other) {
+    if (symbol->getValue() != other->symbol->getValue() || indices.size() != other->indices.size())
+        return false;
+
+    for (unsigned long i = 0; i < indices.size(); i++) {
+        if (!equalIndices(indices[i].get(), other->indices[i].get()))
+            return false;
     }
+
+    return true;
+}
+
+size_t SimpleIdentifier::hash() {
+    size_t result = std::hash<string>()(symbol->getValue());
+    for (auto indexIt = indices.begin(); indexIt != indices.end(); indexIt++) {
+        if ((*indexIt)->getKind() == NODE_NUMERAL_LITERAL)
+            result = result * 31 + std::hash<long>()(static_cast<NumeralLiteral*>((*indexIt).get())->getValue());
+        else if ((*indexIt)->getKind() == NODE_SYMBOL)
+            result = result * 31 + std::hash<string>()(static_cast<Symbol*>((*indexIt).get())->getValue());
+        else
+            result = result * 31 + (*indexIt)->getKind();
+    }
+
+    return result;
+}
+
+void SimpleIdentifier::accept(AstVisitor0* visitor) {
+    visitor->visit(this);
 }
 
 /* =============================== QualifiedIdentifier ================================ */
 void QualifiedIdentifier::accept(AstVisitor0* visitor) {
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string QualifiedIdentifier::toString() {
-    stringstream ss;
-    ss << "(as " << identifier->toString() << " " << sort->toString() << ")";
-    return ss.str();
-}
\ No newline at end of file
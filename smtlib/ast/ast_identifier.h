@@ -31,7 +31,7 @@ namespace smtlib {
              * Constuctor for unindexed identifier.
              * \param symbol    Identifier symbol
              */
-            SimpleIdentifier(sptr_t<Symbol> symbol) : symbol(symbol) { }
+            SimpleIdentifier(sptr_t<Symbol> symbol) : Identifier(NODE_SIMPLE_IDENTIFIER), symbol(symbol) { }
 
             /**
              * Constuctor for indexed identifier.
@@ -49,9 +49,13 @@ namespace smtlib {
             /** Checks whether the identifier is indexed (i.e. the list of indices is not empty). */
             bool isIndexed();
 
-            virtual void accept(AstVisitor0* visitor);
+            /** Checks whether two identifiers have the same textual representation, without printing them */
+            bool equals(SimpleIdentifier* other);
+
+            /** Hash code consistent with equals() */
+            size_t hash();
 
-            virtual std::string toString();
+            virtual void accept(AstVisitor0* visitor);
         };
 
         /* =============================== QualifiedIdentifier ================================ */
@@ -69,7 +73,7 @@ namespace smtlib {
              * \param sort          Result sort
              */
             inline QualifiedIdentifier(sptr_t<SimpleIdentifier> identifier,
-                                       sptr_t<Sort> sort) :
+                                       sptr_t<Sort> sort) : Identifier(NODE_QUALIFIED_IDENTIFIER),
                     identifier(identifier), sort(sort) { }
 
             inline sptr_t<SimpleIdentifier> getIdentifier() { return identifier; }
@@ -81,8 +85,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -9,31 +9,73 @@
 
 #include "ast_abstract.h"
 
+#include <climits>
+
 namespace smtlib {
     namespace ast {
+        /*
+         * The roles form a single inheritance chain, so that each node holds exactly
+         * one AstNode subobject and no virtual base pointers. A node is statically an
+         * instance of all the roles above its own (e.g. every term is also an index,
+         * an s-expression and an attribute value); the parser and the glue code decide
+         * in which roles a node may actually appear.
+         */
+
+        class AttributeValue : public AstNode {
+        protected:
+            AttributeValue(NodeKind kind) : AstNode(kind) { }
+        };
 
-        class AttributeValue : public virtual AstNode { };
+        class SExpression : public AttributeValue {
+        protected:
+            SExpression(NodeKind kind) : AttributeValue(kind) { }
+        };
 
-        class SExpression : public virtual AstNode { };
+        class Index : public SExpression {
+        protected:
+            Index(NodeKind kind) : SExpression(kind) { }
+        };
 
-        class Term : public virtual AstNode { };
+        class Pattern : public Index {
+        protected:
+            Pattern(NodeKind kind) : Index(kind) { }
+        };
 
-        class Identifier : public virtual AstNode,
-                           public Term { };
+        class Constructor : public Pattern {
+        protected:
+            Constructor(NodeKind kind) : Pattern(kind) { }
+        };
 
-        class Index : public virtual AstNode { };
+        class Term : public Index {
+        private:
+            unsigned int size;
 
-        class SpecConstant : public virtual AstNode,
-                             public SExpression,
-                             public Term,
-                             public AttributeValue { };
+        protected:
+            Term(NodeKind kind) : Index(kind), size(1) { }
 
-        class Pattern : public virtual AstNode { };
+            /** Count the terms of a subterm in the size of this term */
+            inline void addToSize(Term* subterm) {
+                if (subterm)
+                    size = subterm->size > UINT_MAX - size ? UINT_MAX : size + subterm->size;
+            }
 
-        class Constructor : public virtual AstNode,
-                            public Pattern { };
+        public:
+            /**
+             * Number of terms in the tree of this term (at most UINT_MAX), counted when
+             * the term was built. Subterms changed afterwards are not counted again.
+             */
+            inline unsigned int getSize() { return size; }
+        };
 
+        class Identifier : public Term {
+        protected:
+            Identifier(NodeKind kind) : Term(kind) { }
+        };
 
+        class SpecConstant : public Term {
+        protected:
+            SpecConstant(NodeKind kind) : Term(kind) { }
+        };
     }
 }
 
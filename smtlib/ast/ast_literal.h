@@ -20,11 +20,11 @@ namespace smtlib {
          * Node of the SMT-LIB abstract syntax tree.
          */
         template<class T>
-        class Literal : public virtual AstNode {
+        class Literal : public SpecConstant {
         protected:
             T value;
 
-            Literal() { }
+            Literal(NodeKind kind) : SpecConstant(kind) { }
 
         public:
             inline T &getValue() { return value; }
@@ -40,22 +40,32 @@ namespace smtlib {
          * Can act as an index or a specification constant.
          */
         class NumeralLiteral : public Literal<long>,
-                               public Index,
-                               public SpecConstant,
                                public std::enable_shared_from_this<NumeralLiteral> {
         private:
             unsigned int base;
+            unsigned long digits;
         public:
             inline NumeralLiteral(long value, unsigned int base)
-                    : base(base) { this->value = value; }
+                    : Literal<long>(NODE_NUMERAL_LITERAL), base(base), digits(0) { this->value = value; }
+
+            /**
+             * \param value     Numeric value
+             * \param base      Base in which the value was written
+             * \param digits    Number of digits written, including leading zeros
+             */
+            inline NumeralLiteral(long value, unsigned int base, unsigned long digits)
+                    : Literal<long>(NODE_NUMERAL_LITERAL), base(base), digits(digits) { this->value = value; }
 
             inline unsigned int getBase() { return base; }
 
             inline void setBase(unsigned int base) { this->base = base; }
 
-            virtual void accept(AstVisitor0* visitor);
+            /** Number of digits written, which gives the width of #b and #x literals (0 if unknown) */
+            inline unsigned long getDigits() { return digits; }
+
+            inline void setDigits(unsigned long digits) { this->digits = digits; }
 
-            virtual std::string toString();
+            virtual void accept(AstVisitor0* visitor);
         };
 
         /* ================================== DecimalLiteral ================================== */
@@ -65,14 +75,11 @@ namespace smtlib {
          * Can act as a specification constant.
          */
         class DecimalLiteral : public Literal<double>,
-                               public SpecConstant,
                                public std::enable_shared_from_this<DecimalLiteral> {
         public:
-            inline DecimalLiteral(double value) { this->value = value; }
+            inline DecimalLiteral(double value) : Literal<double>(NODE_DECIMAL_LITERAL) { this->value = value; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================== StringLiteral =================================== */
@@ -82,14 +89,11 @@ namespace smtlib {
          * Can act as a specification constant.
          */
         class StringLiteral : public Literal<std::string>,
-                              public SpecConstant,
                               public std::enable_shared_from_this<StringLiteral> {
         public:
-            inline StringLiteral(std::string value) { this->value = value; }
+            inline StringLiteral(std::string value) : Literal<std::string>(NODE_STRING_LITERAL) { this->value = value; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
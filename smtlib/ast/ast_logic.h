@@ -30,7 +30,7 @@ namespace smtlib {
              * Constructs logic without attributes.
              * \param name          Logic name
              */
-            inline Logic(sptr_t<Symbol> name) : name(name) { }
+            inline Logic(sptr_t<Symbol> name) : AstRoot(NODE_LOGIC), name(name) { }
 
             /**
              * Constructs logic with attributes.
@@ -46,8 +46,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -24,7 +24,7 @@ namespace smtlib {
             sptr_t<Sort> sort;
         public:
             inline QualifiedConstructor(sptr_t<Symbol> symbol, sptr_t<Sort> sort)
-                    : symbol(symbol), sort(sort) { }
+                    : Constructor(NODE_QUALIFIED_CONSTRUCTOR), symbol(symbol), sort(sort) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -35,8 +35,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================= QualifiedPattern ================================= */
@@ -57,8 +55,6 @@ namespace smtlib {
             inline sptr_v<Symbol>& getSymbols() { return symbols; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ===================================== MatchCase ==================================== */
@@ -70,7 +66,7 @@ namespace smtlib {
             sptr_t<Term> term;
         public:
             inline MatchCase(sptr_t<Pattern> pattern,
-                             sptr_t<Term> term) : pattern(pattern), term(term) { }
+                             sptr_t<Term> term) : AstNode(NODE_MATCH_CASE), pattern(pattern), term(term) { }
 
             inline sptr_t<Pattern> getPattern() { return pattern; }
 
@@ -81,8 +77,6 @@ namespace smtlib {
             inline void setTerm(sptr_t<Term> term) { this->term = term; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -1,21 +1,12 @@
 #include "ast_script.h"
-#include <sstream>
 
 using namespace std;
 using namespace smtlib::ast;
 
-Script::Script(sptr_v<Command>& commands) {
+Script::Script(sptr_v<Command>& commands) : AstRoot(NODE_SCRIPT) {
     this->commands.insert(this->commands.end(), commands.begin(), commands.end());
 }
 
 void Script::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string Script::toString() {
-    stringstream ss;
-    for (auto commandIt = commands.begin(); commandIt != commands.end(); commandIt++) {
-        ss << (*commandIt)->toString() << "\n";
-    }
-    return ss.str();
-}
\ No newline at end of file
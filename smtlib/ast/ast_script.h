@@ -27,7 +27,7 @@ namespace smtlib {
 
         public:
             /** Default constructor */
-            inline Script() { }
+            inline Script() : AstRoot(NODE_SCRIPT) { }
 
             /**
              * \param cmds    Command list
@@ -37,8 +37,6 @@ namespace smtlib {
             inline sptr_v<Command>& getCommands() { return commands; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
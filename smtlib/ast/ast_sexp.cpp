@@ -1,25 +1,12 @@
 #include "ast_sexp.h"
-#include <sstream>
 
 using namespace std;
 using namespace smtlib::ast;
 
-CompSExpression::CompSExpression(sptr_v<SExpression>& exprs) {
+CompSExpression::CompSExpression(sptr_v<SExpression>& exprs) : SExpression(NODE_COMP_SEXPRESSION) {
     this->exprs.insert(this->exprs.end(), exprs.begin(), exprs.end());
 }
 
 void CompSExpression::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string CompSExpression::toString() {
-    stringstream ss;
-    ss << "(";
-    for (auto exprIt = exprs.begin(); exprIt != exprs.end(); exprIt++) {
-        if(exprIt != exprs.begin())
-            ss << " ";
-        ss << (*exprIt)->toString();
-    }
-    ss <<")";
-    return ss.str();
-}
\ No newline at end of file
@@ -19,7 +19,6 @@ namespace smtlib {
          * Node of the SMT-LIB abstract syntax tree.
          */
         class CompSExpression : public SExpression,
-                                public AttributeValue,
                                 public std::enable_shared_from_this<CompSExpression> {
         private:
             sptr_v<SExpression> exprs;
@@ -32,8 +31,6 @@ namespace smtlib {
             inline sptr_v<SExpression>& getExpressions() { return exprs; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -1,12 +1,11 @@
 #include "ast_sort.h"
-#include <sstream>
 
 using namespace std;
 using namespace smtlib::ast;
 
 Sort::Sort(sptr_t<SimpleIdentifier> identifier,
            sptr_v<Sort>& args)
-        : identifier(identifier) {
+        : AstNode(NODE_SORT), identifier(identifier) {
     this->args.insert(this->args.end(), args.begin(), args.end());
 }
 
@@ -14,24 +13,30 @@ bool Sort::hasArgs() {
     return !args.empty();
 }
 
-void Sort::accept(AstVisitor0* visitor) {
-     visitor->visit(shared_from_this());
+bool Sort::equals(Sort* other) {
+    if (this == other)
+        return true;
+
+    if (args.size() != other->args.size() || !identifier->equals(other->identifier.get()))
+        return false;
+
+    for (unsigned long i = 0; i < args.size(); i++) {
+        if (!args[i]->equals(other->args[i].get()))
+            return false;
+    }
+
+    return true;
 }
 
-string Sort::toString() {
-    if(!hasArgs()) {
-        return identifier->toString();
-    } else {
-        stringstream ss;
-        ss << "(" << identifier->toString() << " ";
-
-        for (auto argIt = args.begin(); argIt != args.end(); argIt++) {
-            if(argIt != args.begin())
-                ss << " ";
-            ss << (*argIt)->toString();
-        }
-
-        ss << ")";
-        return ss.str();
+size_t Sort::hash() {
+    size_t result = identifier->hash();
+    for (auto argIt = args.begin(); argIt != args.end(); argIt++) {
+        result = result * 31 + (*argIt)->hash();
     }
-}
\ No newline at end of file
+
+    return result;
+}
+
+void Sort::accept(AstVisitor0* visitor) {
+     visitor->visit(this);
+}
@@ -31,7 +31,7 @@ namespace smtlib {
              * Constructor for a simple sort
              * \param identifier    Sort name
              */
-            inline Sort(sptr_t<SimpleIdentifier> identifier) : identifier(identifier) { }
+            inline Sort(sptr_t<SimpleIdentifier> identifier) : AstNode(NODE_SORT), identifier(identifier) { }
 
             /**
              * Constructor for a parametric sort
@@ -50,9 +50,13 @@ namespace smtlib {
             /** Checks whether the sort is parametrized (i.e. the list of sort parameters is not empty). */
             bool hasArgs();
 
-            virtual void accept(AstVisitor0* visitor);
+            /** Checks whether two sorts have the same textual representation, without printing them */
+            bool equals(Sort* other);
+
+            /** Hash code consistent with equals() */
+            size_t hash();
 
-            virtual std::string toString();
+            virtual void accept(AstVisitor0* visitor);
         };
     }
 }
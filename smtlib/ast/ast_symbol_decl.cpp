@@ -1,5 +1,4 @@
 #include "ast_symbol_decl.h"
-#include <sstream>
 
 using namespace std;
 using namespace smtlib::ast;
@@ -9,50 +8,24 @@ using namespace smtlib::ast;
 SortSymbolDeclaration::SortSymbolDeclaration(sptr_t<SimpleIdentifier> identifier,
                                              sptr_t<NumeralLiteral> arity,
                                              sptr_v<Attribute> &attributes)
-        : identifier(identifier), arity(arity) {
+        : AttributeValue(NODE_SORT_SYMBOL_DECLARATION), identifier(identifier), arity(arity) {
     this->attributes.insert(this->attributes.end(), attributes.begin(), attributes.end());
 }
 
 void SortSymbolDeclaration::accept(AstVisitor0 *visitor) {
-    visitor->visit(shared_from_this());
-}
-
-string SortSymbolDeclaration::toString() {
-    stringstream ss;
-    ss << "(" << identifier->toString() << " " << arity->toString();
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        ss << " " << (*attrIt)->toString();
-    }
-
-    ss << ")";
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ============================= SpecConstFunDeclaration ============================== */
 SpecConstFunDeclaration::SpecConstFunDeclaration(sptr_t<SpecConstant> constant,
                                                  sptr_t<Sort> sort,
                                                  sptr_v<Attribute> &attributes)
-        : constant(constant), sort(sort) {
+        : FunSymbolDeclaration(NODE_SPEC_CONST_FUN_DECLARATION), constant(constant), sort(sort) {
     this->attributes.insert(this->attributes.end(), attributes.begin(), attributes.end());
 }
 
 void SpecConstFunDeclaration::accept(AstVisitor0 *visitor) {
-    visitor->visit(shared_from_this());
-}
-
-string SpecConstFunDeclaration::toString() {
-    stringstream ss;
-    ss << "(" << constant->toString() << " " << sort->toString();
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        ss << " " << (*attrIt)->toString();
-    }
-
-    ss << ")";
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ========================== MetaSpecConstFunDeclaration =========================== */
@@ -60,70 +33,40 @@ string SpecConstFunDeclaration::toString() {
 MetaSpecConstFunDeclaration::MetaSpecConstFunDeclaration(sptr_t<MetaSpecConstant> constant,
                                                          sptr_t<Sort> sort,
                                                          sptr_v<Attribute> &attributes)
-        : constant(constant), sort(sort) {
+        : FunSymbolDeclaration(NODE_META_SPEC_CONST_FUN_DECLARATION), constant(constant), sort(sort) {
     this->attributes.insert(this->attributes.end(), attributes.begin(), attributes.end());
 }
 
 void MetaSpecConstFunDeclaration::accept(AstVisitor0 *visitor) {
-    visitor->visit(shared_from_this());
-}
-
-string MetaSpecConstFunDeclaration::toString() {
-    stringstream ss;
-    ss << "(" << constant->toString() << " " << sort->toString();
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        ss << " " << (*attrIt)->toString();
-    }
-
-    ss << ")";
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ============================== SimpleFunDeclaration =============================== */
 
 SimpleFunDeclaration::SimpleFunDeclaration(sptr_t<SimpleIdentifier> identifier,
                                            sptr_v<Sort> &signature)
-        : identifier(identifier) {
+        : FunSymbolDeclaration(NODE_SIMPLE_FUN_DECLARATION), identifier(identifier) {
     this->signature.insert(this->signature.end(), signature.begin(), signature.end());
 }
 
 SimpleFunDeclaration::SimpleFunDeclaration(sptr_t<SimpleIdentifier> identifier,
                                            sptr_v<Sort> &signature,
                                            sptr_v<Attribute> &attributes)
-        : identifier(identifier) {
+        : FunSymbolDeclaration(NODE_SIMPLE_FUN_DECLARATION), identifier(identifier) {
     this->signature.insert(this->signature.end(), signature.begin(), signature.end());
     this->attributes.insert(this->attributes.end(), attributes.begin(), attributes.end());
 
 }
 
 void SimpleFunDeclaration::accept(AstVisitor0 *visitor) {
-    visitor->visit(shared_from_this());
-}
-
-string SimpleFunDeclaration::toString() {
-    stringstream ss;
-    ss << "(" << identifier->toString();
-
-    for (auto sigIt = signature.begin(); sigIt != signature.end(); sigIt++) {
-        ss << " " << (*sigIt)->toString();
-    }
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        ss << " " << (*attrIt)->toString();
-    }
-
-    ss << ")";
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* =============================== ParametricFunDeclaration ================================ */
 
 ParametricFunDeclaration::ParametricFunDeclaration(sptr_v<Symbol> &params,
                                                    sptr_t<SimpleIdentifier> identifier,
-                                                   sptr_v<Sort> &signature) {
+                                                   sptr_v<Sort> &signature) : FunSymbolDeclaration(NODE_PARAMETRIC_FUN_DECLARATION) {
     this->params.insert(this->params.end(), params.begin(), params.end());
     setIdentifier(identifier);
     this->signature.insert(this->signature.end(), signature.begin(), signature.end());
@@ -132,7 +75,7 @@ ParametricFunDeclaration::ParametricFunDeclaration(sptr_v<Symbol> &params,
 ParametricFunDeclaration::ParametricFunDeclaration(sptr_v<Symbol> &params,
                                                    sptr_t<SimpleIdentifier> identifier,
                                                    sptr_v<Sort> &signature,
-                                                   sptr_v<Attribute> &attributes) {
+                                                   sptr_v<Attribute> &attributes) : FunSymbolDeclaration(NODE_PARAMETRIC_FUN_DECLARATION) {
     this->params.insert(this->params.end(), params.begin(), params.end());
     setIdentifier(identifier);
     this->signature.insert(this->signature.end(), signature.begin(), signature.end());
@@ -140,28 +83,5 @@ ParametricFunDeclaration::ParametricFunDeclaration(sptr_v<Symbol> &params,
 }
 
 void ParametricFunDeclaration::accept(AstVisitor0 *visitor) {
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string ParametricFunDeclaration::toString() {
-    stringstream ss;
-    ss << "(par (";
-    for (auto paramIt = params.begin(); paramIt != params.end(); paramIt++) {
-        if (paramIt != params.begin())
-            ss << " ";
-        ss << (*paramIt)->toString();
-    }
-
-    ss << ") (" << identifier->toString();
-    for (auto sigIt = signature.begin(); sigIt != signature.end(); sigIt++) {
-        ss << " " << (*sigIt)->toString();
-    }
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        ss << " " << (*attrIt)->toString();
-    }
-
-    ss << "))";
-
-    return ss.str();
-}
\ No newline at end of file
@@ -26,8 +26,7 @@ namespace smtlib {
          * Node of the SMT-LIB abstract syntax tree.
          * Can act as an attribute value.
          */
-        class SortSymbolDeclaration : public virtual AstNode,
-                                      public AttributeValue,
+        class SortSymbolDeclaration : public AttributeValue,
                                       public std::enable_shared_from_this<SortSymbolDeclaration> {
         private:
             sptr_t<SimpleIdentifier> identifier;
@@ -41,7 +40,7 @@ namespace smtlib {
              */
             inline SortSymbolDeclaration(sptr_t<SimpleIdentifier> identifier,
                                          sptr_t<NumeralLiteral> arity)
-                    : identifier(identifier), arity(arity) { }
+                    : AttributeValue(NODE_SORT_SYMBOL_DECLARATION), identifier(identifier), arity(arity) { }
 
             /**
              * Constructs declaration with attributes.
@@ -64,8 +63,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== FunSymbolDeclaration =============================== */
@@ -74,8 +71,9 @@ namespace smtlib {
          * Node of the SMT-LIB abstract syntax tree.
          * Can act as an attribute value.
          */
-        class FunSymbolDeclaration : public virtual AstNode,
-                                     public AttributeValue {
+        class FunSymbolDeclaration : public AttributeValue {
+        protected:
+            FunSymbolDeclaration(NodeKind kind) : AttributeValue(kind) { }
         };
 
         /* ============================= SpecConstFunDeclaration ============================== */
@@ -98,7 +96,7 @@ namespace smtlib {
             * \param sort          Function sort
             */
             inline SpecConstFunDeclaration(sptr_t<SpecConstant> constant, sptr_t<Sort> sort)
-                    : constant(constant), sort(sort) { }
+                    : FunSymbolDeclaration(NODE_SPEC_CONST_FUN_DECLARATION), constant(constant), sort(sort) { }
 
             /**
              * Constructs declaration with attributes.
@@ -121,8 +119,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ========================== MetaSpecConstFunDeclaration =========================== */
@@ -146,7 +142,7 @@ namespace smtlib {
             * \param sort          Function sort
             */
             inline MetaSpecConstFunDeclaration(sptr_t<MetaSpecConstant> constant, sptr_t<Sort> sort)
-                    : constant(constant), sort(sort) { }
+                    : FunSymbolDeclaration(NODE_META_SPEC_CONST_FUN_DECLARATION), constant(constant), sort(sort) { }
 
             /**
              * Constructs declaration with attributes.
@@ -169,8 +165,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ============================== SimpleFunDeclaration =============================== */
@@ -187,7 +181,7 @@ namespace smtlib {
             sptr_v<Sort> signature;
             sptr_v<Attribute> attributes;
 
-            SimpleFunDeclaration() { }
+            SimpleFunDeclaration() : FunSymbolDeclaration(NODE_SIMPLE_FUN_DECLARATION) { }
 
         public:
             /**
@@ -217,8 +211,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* =============================== ParametricFunDeclaration ================================ */
@@ -270,8 +262,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -1,5 +1,4 @@
 #include "ast_term.h"
-#include <sstream>
 
 using namespace std;
 using namespace smtlib::ast;
@@ -8,148 +7,79 @@ using namespace smtlib::ast;
 
 QualifiedTerm::QualifiedTerm(sptr_t<Identifier> identifier,
                              sptr_v<Term>& terms)
-        : identifier(identifier) {
+        : Term(NODE_QUALIFIED_TERM), identifier(identifier) {
     this->terms.insert(this->terms.end(), terms.begin(), terms.end());
-}
-
-void QualifiedTerm::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string QualifiedTerm::toString() {
-    stringstream ss;
-    ss << "(" << identifier->toString() << " ";
-
     for (auto termIt = terms.begin(); termIt != terms.end(); termIt++) {
-        if(termIt != terms.begin())
-            ss << " ";
-        ss << (*termIt)->toString();
+        addToSize((*termIt).get());
     }
+}
 
-    ss << ")";
-    return ss.str();
+void QualifiedTerm::accept(AstVisitor0* visitor){
+    visitor->visit(this);
 }
 
 /* ===================================== LetTerm ====================================== */
 
 LetTerm::LetTerm(sptr_v<VarBinding>& bindings,
                  sptr_t<Term> term)
-        : term(term) {
+        : Term(NODE_LET_TERM), term(term) {
     this->bindings.insert(this->bindings.end(), bindings.begin(), bindings.end());
-}
-
-void LetTerm::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string LetTerm::toString() {
-    stringstream ss;
-    ss << "(let (";
-
     for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
-        if(bindingIt != bindings.begin())
-            ss << " ";
-        ss << "(" << (*bindingIt)->toString() << ")";
+        addToSize((*bindingIt)->getTerm().get());
     }
+    addToSize(term.get());
+}
 
-    ss << ") " << term->toString() << ")";
-
-    return ss.str();
+void LetTerm::accept(AstVisitor0* visitor){
+    visitor->visit(this);
 }
 
 /* ==================================== ForallTerm ==================================== */
 ForallTerm::ForallTerm(sptr_v<SortedVariable>& bindings,
                        sptr_t<Term> term)
-        : term(term)  {
+        : Term(NODE_FORALL_TERM), term(term)  {
     this->bindings.insert(this->bindings.end(), bindings.begin(), bindings.end());
+    addToSize(term.get());
 }
 
 void ForallTerm::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string ForallTerm::toString() {
-    stringstream ss;
-    ss << "(forall (";
-
-    for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
-        if(bindingIt != bindings.begin())
-            ss << " ";
-        ss << "(" << (*bindingIt)->toString() << ")";
-    }
-
-    ss << ") " << term->toString() << ")";
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ==================================== ExistsTerm ==================================== */
 ExistsTerm::ExistsTerm(sptr_v<SortedVariable>& bindings,
                        sptr_t<Term> term)
-        : term(term) {
+        : Term(NODE_EXISTS_TERM), term(term) {
     this->bindings.insert(this->bindings.end(), bindings.begin(), bindings.end());
+    addToSize(term.get());
 }
 
 void ExistsTerm::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
-}
-
-string ExistsTerm::toString() {
-    stringstream ss;
-    ss << "(exists (";
-
-    for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
-        if(bindingIt != bindings.begin())
-            ss << " ";
-        ss << "(" << (*bindingIt)->toString() << ")";
-    }
-
-    ss << ") " << term->toString() << ")";
-
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ==================================== MatchTerm ===================================== */
 MatchTerm::MatchTerm(sptr_t<Term> term,
-                     sptr_v<MatchCase>& cases) : term(term) {
+                     sptr_v<MatchCase>& cases) : Term(NODE_MATCH_TERM), term(term) {
     this->cases.insert(this->cases.begin(), cases.begin(), cases.end());
+    addToSize(term.get());
+    for (auto caseIt = cases.begin(); caseIt != cases.end(); caseIt++) {
+        addToSize((*caseIt)->getTerm().get());
+    }
 }
 
 void MatchTerm::accept(AstVisitor0* visitor) {
-    visitor->visit(shared_from_this());
-}
-
-std::string MatchTerm::toString() {
-    stringstream ss;
-    ss << "(match " << term->toString();
-    for (auto caseIt = cases.begin(); caseIt != cases.end(); caseIt++) {
-        ss << " " << (*caseIt)->toString();
-    }
-    ss << ")";
-    return ss.str();
+    visitor->visit(this);
 }
 
 /* ================================== AnnotatedTerm =================================== */
 AnnotatedTerm::AnnotatedTerm(sptr_t<Term> term,
                              sptr_v<Attribute>& attributes)
-        : term(term) {
+        : Term(NODE_ANNOTATED_TERM), term(term) {
     this->attributes.insert(this->attributes.end(), attributes.begin(), attributes.end());
+    addToSize(term.get());
 }
 
 void AnnotatedTerm::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string AnnotatedTerm::toString() {
-    stringstream ss;
-    ss << "( ! " << term->toString() << " ";
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        if(attrIt != attributes.begin())
-            ss << " ";
-        ss << (*attrIt)->toString();
-    }
-
-    ss << ")";
-    return ss.str();
-}
\ No newline at end of file
@@ -43,8 +43,6 @@ namespace smtlib {
             inline sptr_v<Term>& getTerms() { return terms; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ===================================== LetTerm ====================================== */
@@ -73,8 +71,6 @@ namespace smtlib {
             inline sptr_v<VarBinding>& getBindings() { return bindings; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ==================================== ForallTerm ==================================== */
@@ -103,8 +99,6 @@ namespace smtlib {
             inline sptr_v<SortedVariable>& getBindings() { return bindings; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ==================================== ExistsTerm ==================================== */
@@ -133,8 +127,6 @@ namespace smtlib {
             inline sptr_v<SortedVariable>& getBindings() { return bindings; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ==================================== MatchTerm ===================================== */
@@ -154,8 +146,6 @@ namespace smtlib {
             sptr_v<MatchCase>& getCases() { return cases; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ================================== AnnotatedTerm =================================== */
@@ -184,8 +174,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
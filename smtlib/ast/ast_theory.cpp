@@ -1,28 +1,12 @@
 #include "ast_theory.h"
 
-#include <sstream>
-
 using namespace smtlib::ast;
 using namespace std;
 
-Theory::Theory(sptr_t<Symbol> name, sptr_v<Attribute>& attributes) : name(name) {
+Theory::Theory(sptr_t<Symbol> name, sptr_v<Attribute>& attributes) : AstRoot(NODE_THEORY), name(name) {
     this->attributes.insert(this->attributes.begin(), attributes.begin(), attributes.end());
 }
 
 void Theory::accept(AstVisitor0* visitor){
-    visitor->visit(shared_from_this());
+    visitor->visit(this);
 }
-
-string Theory::toString() {
-    stringstream ss;
-    ss << "(theory  " << name->toString() << " ";
-
-    for (auto attrIt = attributes.begin(); attrIt != attributes.end(); attrIt++) {
-        if(attrIt != attributes.begin())
-            ss << " ";
-        ss << (*attrIt)->toString();
-    }
-
-    ss << ")";
-    return ss.str();
-}
\ No newline at end of file
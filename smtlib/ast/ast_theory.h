@@ -31,7 +31,7 @@ namespace smtlib {
              * Constructs theory without attributes.
              * \param name  Theory name
              */
-            inline Theory(sptr_t<Symbol> name) : name(name) { }
+            inline Theory(sptr_t<Symbol> name) : AstRoot(NODE_THEORY), name(name) { }
 
             /**
              * Constructs theory with attributes.
@@ -47,8 +47,6 @@ namespace smtlib {
             inline sptr_v<Attribute>& getAttributes() { return attributes; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
@@ -33,7 +33,7 @@ namespace smtlib {
              * \param sort      Variable sort
              */
             inline SortedVariable(sptr_t<Symbol> symbol, sptr_t<Sort> sort)
-                    : symbol(symbol), sort(sort) { }
+                    : AstNode(NODE_SORTED_VARIABLE), symbol(symbol), sort(sort) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -44,8 +44,6 @@ namespace smtlib {
             inline void setSort(sptr_t<Sort> sort) { this->sort = sort; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
 
         /* ==================================== VarBinding ==================================== */
@@ -65,7 +63,7 @@ namespace smtlib {
              * \param term      Binding
              */
             VarBinding(sptr_t<Symbol> symbol, sptr_t<Term> term)
-                    : symbol(symbol), term(term) { }
+                    : AstNode(NODE_VAR_BINDING), symbol(symbol), term(term) { }
 
             inline sptr_t<Symbol> getSymbol() { return symbol; }
 
@@ -76,8 +74,6 @@ namespace smtlib {
             inline void setTerm(sptr_t<Term> term) { this->term = term; }
 
             virtual void accept(AstVisitor0* visitor);
-
-            virtual std::string toString();
         };
     }
 }
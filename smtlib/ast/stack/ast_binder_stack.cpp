@@ -0,0 +1,58 @@
+#include "ast_binder_stack.h"
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+void BinderStack::pop() {
+    if (scopes.empty())
+        return;
+
+    unsigned long mark = scopes.back();
+    while (trail.size() > mark) {
+        trail.back()->second.pop_back();
+        trail.pop_back();
+    }
+
+    scopes.pop_back();
+}
+
+bool BinderStack::bind(const string& name, sptr_t<Sort> sort) {
+    auto entryIt = bindings.find(name);
+    if (entryIt == bindings.end())
+        entryIt = bindings.emplace(name, vector<Binding>()).first;
+
+    vector<Binding>& chain = entryIt->second;
+    if (!chain.empty() && chain.back().scope == scopes.size())
+        return false;
+
+    chain.push_back(Binding(sort, scopes.size()));
+    trail.push_back(&*entryIt);
+    return true;
+}
+
+void BinderStack::pushVisible(BinderStack& other) {
+    push();
+
+    // The trail has an entry for each variable still bound, so a name may come up more
+    // than once; its innermost variable is bound the first time, and bind() skips the others
+    for (auto entryIt = other.trail.begin(); entryIt != other.trail.end(); entryIt++) {
+        bind((*entryIt)->first, (*entryIt)->second.back().sort);
+    }
+}
+
+sptr_t<Sort> BinderStack::getSort(const string& name, bool& bound) {
+    auto it = bindings.find(name);
+    bound = it != bindings.end() && !it->second.empty();
+    if (bound) {
+        return it->second.back().sort;
+    } else {
+        sptr_t<Sort> empty;
+        return empty;
+    }
+}
+
+void BinderStack::clear() {
+    while (!scopes.empty())
+        pop();
+}
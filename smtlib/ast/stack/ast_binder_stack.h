@@ -0,0 +1,85 @@
+/**
+ * \file ast_binder_stack.h
+ * \brief Scopes of variables bound inside terms.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_BINDER_STACK_H
+#define SMTLIB_PARSER_BINDER_STACK_H
+
+#include "ast/ast_sort.h"
+#include "util/global_typedef.h"
+
+#include <string>
+#include <vector>
+
+namespace smtlib {
+    /**
+     * Scopes of the variables bound by let, forall, exists and match terms.
+     * Only the sort of a bound variable is kept, and all storage is reused
+     * after its scope is popped, so that entering and leaving a binder does
+     * not allocate once the names it binds have been seen before.
+     */
+    class BinderStack {
+    private:
+        /** Sort of a bound variable, together with the scope in which it was bound */
+        struct Binding {
+            sptr_t<ast::Sort> sort;
+            unsigned long scope;
+
+            inline Binding(sptr_t<ast::Sort> sort, unsigned long scope) : sort(sort), scope(scope) { }
+        };
+
+        typedef umap<std::string, std::vector<Binding>> BindingMap;
+
+        BindingMap bindings;
+
+        // Chains are kept in the map after they become empty, so that their
+        // storage can be reused, and pointers to them stay valid
+        std::vector<BindingMap::value_type*> trail;
+        std::vector<unsigned long> scopes;
+
+    public:
+        inline BinderStack() { }
+
+        // The trail points into the map, so it cannot be copied along with it
+        BinderStack(const BinderStack&) = delete;
+        BinderStack& operator=(const BinderStack&) = delete;
+
+        /** Number of open scopes */
+        inline unsigned long getScopeCount() { return scopes.size(); }
+
+        /** Open a new scope */
+        inline void push() {
+            scopes.push_back(trail.size());
+        }
+
+        /** Close the last scope, unbinding its variables */
+        void pop();
+
+        /**
+         * Bind a variable in the last scope. If the name is already bound
+         * in the same scope, the first binding is kept.
+         * \return Whether the variable was bound
+         */
+        bool bind(const std::string& name, sptr_t<ast::Sort> sort);
+
+        /**
+         * Open a new scope, binding in it the innermost variable of each name bound in
+         * another stack. Sorts are looked up in the new stack as in the other one.
+         */
+        void pushVisible(BinderStack& other);
+
+        /**
+         * Get the sort of the innermost variable with the given name
+         * \param bound    Set to whether a variable with the name is bound. Its sort
+         *                 is empty if the sort of the binder could not be expanded.
+         */
+        sptr_t<ast::Sort> getSort(const std::string& name, bool& bound);
+
+        /** Close all scopes */
+        void clear();
+    };
+}
+
+#endif //SMTLIB_PARSER_BINDER_STACK_H
@@ -0,0 +1,535 @@
+#include "ast_builtin_theories.h"
+
+#include "util/global_values.h"
+
+#include <climits>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+/* ====================================== Tables ====================================== */
+
+/** Rules giving the signatures of the built-in functions, with m the width of the arguments */
+enum Rule {
+    BV_UNARY,               // (m) -> m
+    BV_BINARY,              // (m m) -> m
+    BV_LEFT_ASSOC,          // (m m ... m) -> m
+    BV_PREDICATE,           // (m m) -> Bool
+    BV_COMP,                // (m m) -> 1
+    BV_CONCAT,              // (i j) -> i + j
+    BV_EXTRACT,             // [i j] (m) -> i - j + 1, where m > i >= j
+    BV_REPEAT,              // [i] (m) -> i * m, where i > 0
+    BV_EXTEND,              // [i] (m) -> m + i
+    BV_ROTATE,              // [i] (m) -> m
+    FP_LITERAL,             // (1 eb i) -> FP(eb, i + 1)
+    FP_UNARY,               // (FP) -> FP
+    FP_BINARY,              // (FP FP) -> FP
+    FP_ROUNDED_UNARY,       // (RoundingMode FP) -> FP
+    FP_ROUNDED_BINARY,      // (RoundingMode FP FP) -> FP
+    FP_ROUNDED_TERNARY,     // (RoundingMode FP FP FP) -> FP
+    FP_CHAINABLE,           // (FP FP ... FP) -> Bool
+    FP_CLASSIFY,            // (FP) -> Bool
+    FP_TO_FP,               // [eb sb] (eb + sb) or (RoundingMode FP/Real/BitVec) -> FP(eb, sb)
+    FP_TO_FP_UNSIGNED,      // [eb sb] (RoundingMode m) -> FP(eb, sb)
+    FP_TO_BV,               // [m] (RoundingMode FP) -> m
+    FP_TO_REAL              // (FP) -> Real
+};
+
+/** Built-in function, together with the number of indices of its identifier */
+struct FunRule {
+    const char* name;
+    unsigned int family;
+    unsigned long indices;
+    Rule rule;
+};
+
+static constexpr FunRule FUN_RULES[] = {
+    {"concat",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_CONCAT},
+    {"extract",             BuiltinTheories::BITVECTOR_FUNS, 2, BV_EXTRACT},
+    {"repeat",              BuiltinTheories::BITVECTOR_FUNS, 1, BV_REPEAT},
+    {"zero_extend",         BuiltinTheories::BITVECTOR_FUNS, 1, BV_EXTEND},
+    {"sign_extend",         BuiltinTheories::BITVECTOR_FUNS, 1, BV_EXTEND},
+    {"rotate_left",         BuiltinTheories::BITVECTOR_FUNS, 1, BV_ROTATE},
+    {"rotate_right",        BuiltinTheories::BITVECTOR_FUNS, 1, BV_ROTATE},
+    {"bvnot",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_UNARY},
+    {"bvneg",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_UNARY},
+    {"bvand",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_LEFT_ASSOC},
+    {"bvor",                BuiltinTheories::BITVECTOR_FUNS, 0, BV_LEFT_ASSOC},
+    {"bvxor",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_LEFT_ASSOC},
+    {"bvadd",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_LEFT_ASSOC},
+    {"bvmul",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_LEFT_ASSOC},
+    {"bvnand",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvnor",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvxnor",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvsub",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvudiv",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvurem",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvsdiv",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvsrem",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvsmod",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvshl",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvlshr",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvashr",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_BINARY},
+    {"bvcomp",              BuiltinTheories::BITVECTOR_FUNS, 0, BV_COMP},
+    {"bvult",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvule",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvugt",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvuge",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvslt",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvsle",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvsgt",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"bvsge",               BuiltinTheories::BITVECTOR_FUNS, 0, BV_PREDICATE},
+    {"fp",                  BuiltinTheories::FLOATING_POINT, 0, FP_LITERAL},
+    {"fp.abs",              BuiltinTheories::FLOATING_POINT, 0, FP_UNARY},
+    {"fp.neg",              BuiltinTheories::FLOATING_POINT, 0, FP_UNARY},
+    {"fp.add",              BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_BINARY},
+    {"fp.sub",              BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_BINARY},
+    {"fp.mul",              BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_BINARY},
+    {"fp.div",              BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_BINARY},
+    {"fp.fma",              BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_TERNARY},
+    {"fp.sqrt",             BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_UNARY},
+    {"fp.roundToIntegral",  BuiltinTheories::FLOATING_POINT, 0, FP_ROUNDED_UNARY},
+    {"fp.rem",              BuiltinTheories::FLOATING_POINT, 0, FP_BINARY},
+    {"fp.min",              BuiltinTheories::FLOATING_POINT, 0, FP_BINARY},
+    {"fp.max",              BuiltinTheories::FLOATING_POINT, 0, FP_BINARY},
+    {"fp.leq",              BuiltinTheories::FLOATING_POINT, 0, FP_CHAINABLE},
+    {"fp.lt",               BuiltinTheories::FLOATING_POINT, 0, FP_CHAINABLE},
+    {"fp.geq",              BuiltinTheories::FLOATING_POINT, 0, FP_CHAINABLE},
+    {"fp.gt",               BuiltinTheories::FLOATING_POINT, 0, FP_CHAINABLE},
+    {"fp.eq",               BuiltinTheories::FLOATING_POINT, 0, FP_CHAINABLE},
+    {"fp.isNormal",         BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"fp.isSubnormal",      BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"fp.isZero",           BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"fp.isInfinite",       BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"fp.isNaN",            BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"fp.isNegative",       BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"fp.isPositive",       BuiltinTheories::FLOATING_POINT, 0, FP_CLASSIFY},
+    {"to_fp",               BuiltinTheories::FLOATING_POINT, 2, FP_TO_FP},
+    {"to_fp_unsigned",      BuiltinTheories::FLOATING_POINT, 2, FP_TO_FP_UNSIGNED},
+    {"fp.to_ubv",           BuiltinTheories::FLOATING_POINT, 1, FP_TO_BV},
+    {"fp.to_sbv",           BuiltinTheories::FLOATING_POINT, 1, FP_TO_BV},
+    {"fp.to_real",          BuiltinTheories::FLOATING_POINT, 0, FP_TO_REAL}
+};
+
+/** Floating point values indexed by exponent and significand size, e.g. (_ NaN 8 24) */
+static constexpr const char* FP_CONSTS[] = {"+oo", "-oo", "+zero", "-zero", "NaN"};
+
+/** Synonyms of floating point sorts */
+struct SortSynonym {
+    const char* name;
+    long eb;
+    long sb;
+};
+
+static constexpr SortSynonym FP_SYNONYMS[] = {
+    {"Float16", 5, 11},
+    {"Float32", 8, 24},
+    {"Float64", 11, 53},
+    {"Float128", 15, 113}
+};
+
+/** Theories and the families they describe */
+struct TheoryFamilies {
+    const char* theory;
+    unsigned int families;
+};
+
+static constexpr TheoryFamilies THEORY_FAMILIES[] = {
+    {"FixedSizeBitVectors", BuiltinTheories::BITVECTOR_SORTS | BuiltinTheories::BITVECTOR_FUNS},
+    {"FloatingPoint",       BuiltinTheories::BITVECTOR_SORTS | BuiltinTheories::FLOATING_POINT}
+};
+
+static const char* const SORT_BITVEC = "BitVec";
+static const char* const SORT_FLOATING_POINT = "FloatingPoint";
+static const char* const SORT_ROUNDING_MODE = "RoundingMode";
+static const char* const SORT_REAL = "Real";
+
+/** Get the rule of a built-in function, or NULL if there is none with that name */
+static const FunRule* findFunRule(const string& name) {
+    // Built once from the compiled-in table, then only read
+    static const umap<string, const FunRule*> rules = [] {
+        umap<string, const FunRule*> result;
+        for (unsigned long i = 0; i < sizeof(FUN_RULES) / sizeof(FUN_RULES[0]); i++) {
+            result[FUN_RULES[i].name] = &FUN_RULES[i];
+        }
+        return result;
+    }();
+
+    auto ruleIt = rules.find(name);
+    if (ruleIt != rules.end())
+        return ruleIt->second;
+    else
+        return NULL;
+}
+
+/* =================================== Sort helpers =================================== */
+
+/** Get the value of a decimal numeral index */
+static bool getNumeral(Index* index, long& value) {
+    if (index->getKind() != NODE_NUMERAL_LITERAL)
+        return false;
+
+    NumeralLiteral* numeral = static_cast<NumeralLiteral*>(index);
+    if (numeral->getBase() != 10)
+        return false;
+
+    value = numeral->getValue();
+    return true;
+}
+
+/** Get the values of the numeral indices of an identifier, if there are exactly 'count' of them */
+static bool getNumerals(SimpleIdentifier* id, unsigned long count, long* values) {
+    sptr_v<Index>& indices = id->getIndices();
+    if (indices.size() != count)
+        return false;
+
+    for (unsigned long i = 0; i < count; i++) {
+        if (!getNumeral(indices[i].get(), values[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/** Checks whether a sort has no arguments, no indices and the given name */
+static bool isNamedSort(Sort* sort, const char* name) {
+    return sort && !sort->hasArgs() && !sort->getIdentifier()->isIndexed()
+           && sort->getIdentifier()->getSymbol()->getValue() == name;
+}
+
+/** Get the width of a (_ BitVec m) sort, or -1 if the sort is not one */
+static long getBitVecWidth(Sort* sort) {
+    if (!sort || sort->hasArgs())
+        return -1;
+
+    SimpleIdentifier* id = sort->getIdentifier().get();
+    long width;
+    if (id->getSymbol()->getValue() != SORT_BITVEC || !getNumerals(id, 1, &width) || width <= 0)
+        return -1;
+
+    return width;
+}
+
+/** Get the exponent and significand sizes of a (_ FloatingPoint eb sb) sort */
+static bool getFloatingPointFormat(Sort* sort, long& eb, long& sb) {
+    if (!sort || sort->hasArgs())
+        return false;
+
+    SimpleIdentifier* id = sort->getIdentifier().get();
+    long values[2];
+    if (id->getSymbol()->getValue() != SORT_FLOATING_POINT || !getNumerals(id, 2, values)
+        || values[0] <= 1 || values[1] <= 1)
+        return false;
+
+    eb = values[0];
+    sb = values[1];
+    return true;
+}
+
+/** Checks whether all sorts are the same floating point sort, and get its format */
+static bool getCommonFormat(const sptr_t<Sort>* sorts, unsigned long count, long& eb, long& sb) {
+    if (count == 0 || !getFloatingPointFormat(sorts[0].get(), eb, sb))
+        return false;
+
+    for (unsigned long i = 1; i < count; i++) {
+        long eb2, sb2;
+        if (!getFloatingPointFormat(sorts[i].get(), eb2, sb2) || eb2 != eb || sb2 != sb)
+            return false;
+    }
+
+    return true;
+}
+
+/** Checks whether all sorts are bit vector sorts of the same width, and get the width */
+static long getCommonWidth(const sptr_t<Sort>* sorts, unsigned long count) {
+    if (count == 0)
+        return -1;
+
+    long width = getBitVecWidth(sorts[0].get());
+    for (unsigned long i = 1; i < count && width > 0; i++) {
+        if (getBitVecWidth(sorts[i].get()) != width)
+            return -1;
+    }
+
+    return width;
+}
+
+/** Build an indexed sort, such as (_ BitVec 8) */
+static sptr_t<Sort> buildIndexedSort(const char* name, const long* indices, unsigned long count) {
+    sptr_v<Index> idIndices;
+    for (unsigned long i = 0; i < count; i++) {
+        idIndices.push_back(make_shared<NumeralLiteral>(indices[i], 10));
+    }
+
+    return make_shared<Sort>(make_shared<SimpleIdentifier>(make_shared<Symbol>(name), idIndices));
+}
+
+/** Get the shared (_ BitVec m) sort */
+static sptr_t<Sort> getBitVecSort(long width) {
+    static thread_local umap<long, sptr_t<Sort>> sorts;
+
+    sptr_t<Sort>& sort = sorts[width];
+    if (!sort)
+        sort = buildIndexedSort(SORT_BITVEC, &width, 1);
+    return sort;
+}
+
+/** Get the shared (_ FloatingPoint eb sb) sort */
+static sptr_t<Sort> getFloatingPointSort(long eb, long sb) {
+    static thread_local umap<long, umap<long, sptr_t<Sort>>> sorts;
+
+    sptr_t<Sort>& sort = sorts[eb][sb];
+    if (!sort) {
+        long indices[2] = {eb, sb};
+        sort = buildIndexedSort(SORT_FLOATING_POINT, indices, 2);
+    }
+    return sort;
+}
+
+/** Get a shared sort without indices or arguments */
+static sptr_t<Sort> getNamedSort(const string& name) {
+    static thread_local umap<string, sptr_t<Sort>> sorts;
+
+    sptr_t<Sort>& sort = sorts[name];
+    if (!sort)
+        sort = make_shared<Sort>(make_shared<SimpleIdentifier>(make_shared<Symbol>(name)));
+    return sort;
+}
+
+/** Checks whether a width computed from indices or other widths is positive and representable */
+static bool isValidWidth(long width) {
+    return width > 0 && width < LONG_MAX / 2;
+}
+
+/* ================================== BuiltinTheories ================================= */
+
+bool BuiltinTheories::enable(const string& theory) {
+    for (unsigned long i = 0; i < sizeof(THEORY_FAMILIES) / sizeof(THEORY_FAMILIES[0]); i++) {
+        if (theory == THEORY_FAMILIES[i].theory) {
+            unsigned int added = THEORY_FAMILIES[i].families & ~families;
+            families |= THEORY_FAMILIES[i].families;
+            return added != 0;
+        }
+    }
+
+    return false;
+}
+
+bool BuiltinTheories::isSort(Sort* sort) {
+    if (!families || sort->hasArgs())
+        return false;
+
+    if ((families & BITVECTOR_SORTS) && getBitVecWidth(sort) > 0)
+        return true;
+
+    if (families & FLOATING_POINT) {
+        long eb, sb;
+        if (getFloatingPointFormat(sort, eb, sb))
+            return true;
+
+        return (bool) expandSynonym(sort);
+    }
+
+    return false;
+}
+
+sptr_t<Sort> BuiltinTheories::expandSynonym(Sort* sort) {
+    sptr_t<Sort> null;
+    if (!(families & FLOATING_POINT) || sort->hasArgs() || sort->getIdentifier()->isIndexed())
+        return null;
+
+    const string& name = sort->getIdentifier()->getSymbol()->getValue();
+    for (unsigned long i = 0; i < sizeof(FP_SYNONYMS) / sizeof(FP_SYNONYMS[0]); i++) {
+        if (name == FP_SYNONYMS[i].name)
+            return getFloatingPointSort(FP_SYNONYMS[i].eb, FP_SYNONYMS[i].sb);
+    }
+
+    return null;
+}
+
+sptr_t<Sort> BuiltinTheories::getLiteralSort(NumeralLiteral* literal) {
+    sptr_t<Sort> null;
+    if (!(families & BITVECTOR_SORTS) || literal->getDigits() == 0)
+        return null;
+
+    if (literal->getBase() == 2)
+        return getBitVecSort((long) literal->getDigits());
+    else if (literal->getBase() == 16)
+        return getBitVecSort(4 * (long) literal->getDigits());
+    else
+        return null;
+}
+
+sptr_t<Sort> BuiltinTheories::getConstSort(SimpleIdentifier* id) {
+    sptr_t<Sort> null;
+    if (!families || !id->isIndexed())
+        return null;
+
+    const string& name = id->getSymbol()->getValue();
+
+    // (_ bvX n), where X is a decimal numeral
+    if ((families & BITVECTOR_FUNS) && name.size() > 2 && name.compare(0, 2, "bv") == 0) {
+        for (unsigned long i = 2; i < name.size(); i++) {
+            if (name[i] < '0' || name[i] > '9')
+                return null;
+        }
+
+        long width;
+        if (getNumerals(id, 1, &width) && width > 0)
+            return getBitVecSort(width);
+        return null;
+    }
+
+    if (families & FLOATING_POINT) {
+        for (unsigned long i = 0; i < sizeof(FP_CONSTS) / sizeof(FP_CONSTS[0]); i++) {
+            if (name == FP_CONSTS[i]) {
+                long values[2];
+                if (getNumerals(id, 2, values) && values[0] > 1 && values[1] > 1)
+                    return getFloatingPointSort(values[0], values[1]);
+                return null;
+            }
+        }
+    }
+
+    return null;
+}
+
+sptr_t<Sort> BuiltinTheories::getReturnSort(SimpleIdentifier* id, const sptr_t<Sort>* args, unsigned long count) {
+    sptr_t<Sort> null;
+    if (!families)
+        return null;
+
+    const FunRule* rule = findFunRule(id->getSymbol()->getValue());
+    if (!rule || !(rule->family & families))
+        return null;
+
+    long indices[2];
+    if (!getNumerals(id, rule->indices, indices))
+        return null;
+
+    long width, eb, sb;
+    switch (rule->rule) {
+        case BV_UNARY:
+            width = count == 1 ? getBitVecWidth(args[0].get()) : -1;
+            return width > 0 ? getBitVecSort(width) : null;
+
+        case BV_BINARY:
+            width = count == 2 ? getCommonWidth(args, count) : -1;
+            return width > 0 ? getBitVecSort(width) : null;
+
+        case BV_LEFT_ASSOC:
+            width = count >= 2 ? getCommonWidth(args, count) : -1;
+            return width > 0 ? getBitVecSort(width) : null;
+
+        case BV_PREDICATE:
+            width = count == 2 ? getCommonWidth(args, count) : -1;
+            return width > 0 ? getNamedSort(SORT_BOOL) : null;
+
+        case BV_COMP:
+            width = count == 2 ? getCommonWidth(args, count) : -1;
+            return width > 0 ? getBitVecSort(1) : null;
+
+        case BV_CONCAT: {
+            if (count != 2)
+                return null;
+
+            long width1 = getBitVecWidth(args[0].get());
+            long width2 = getBitVecWidth(args[1].get());
+            if (width1 <= 0 || width2 <= 0 || !isValidWidth(width1 + width2))
+                return null;
+            return getBitVecSort(width1 + width2);
+        }
+
+        case BV_EXTRACT:
+            width = count == 1 ? getBitVecWidth(args[0].get()) : -1;
+            if (width <= 0 || indices[0] >= width || indices[1] < 0 || indices[0] < indices[1])
+                return null;
+            return getBitVecSort(indices[0] - indices[1] + 1);
+
+        case BV_REPEAT:
+            width = count == 1 ? getBitVecWidth(args[0].get()) : -1;
+            if (width <= 0 || indices[0] <= 0 || indices[0] > (LONG_MAX / 2) / width)
+                return null;
+            return getBitVecSort(indices[0] * width);
+
+        case BV_EXTEND:
+            width = count == 1 ? getBitVecWidth(args[0].get()) : -1;
+            if (width <= 0 || indices[0] < 0 || !isValidWidth(width + indices[0]))
+                return null;
+            return getBitVecSort(width + indices[0]);
+
+        case BV_ROTATE:
+            width = count == 1 ? getBitVecWidth(args[0].get()) : -1;
+            return width > 0 && indices[0] >= 0 ? getBitVecSort(width) : null;
+
+        case FP_LITERAL: {
+            if (count != 3 || getBitVecWidth(args[0].get()) != 1)
+                return null;
+
+            long expWidth = getBitVecWidth(args[1].get());
+            long sigWidth = getBitVecWidth(args[2].get());
+            if (expWidth <= 1 || sigWidth <= 0)
+                return null;
+            return getFloatingPointSort(expWidth, sigWidth + 1);
+        }
+
+        case FP_UNARY:
+            return count == 1 && getCommonFormat(args, 1, eb, sb) ? getFloatingPointSort(eb, sb) : null;
+
+        case FP_BINARY:
+            return count == 2 && getCommonFormat(args, 2, eb, sb) ? getFloatingPointSort(eb, sb) : null;
+
+        case FP_ROUNDED_UNARY:
+        case FP_ROUNDED_BINARY:
+        case FP_ROUNDED_TERNARY: {
+            unsigned long operands = rule->rule == FP_ROUNDED_UNARY ? 1 : (rule->rule == FP_ROUNDED_BINARY ? 2 : 3);
+            if (count != operands + 1 || !isNamedSort(args[0].get(), SORT_ROUNDING_MODE)
+                || !getCommonFormat(args + 1, operands, eb, sb))
+                return null;
+            return getFloatingPointSort(eb, sb);
+        }
+
+        case FP_CHAINABLE:
+            return count >= 2 && getCommonFormat(args, count, eb, sb) ? getNamedSort(SORT_BOOL) : null;
+
+        case FP_CLASSIFY:
+            return count == 1 && getCommonFormat(args, 1, eb, sb) ? getNamedSort(SORT_BOOL) : null;
+
+        case FP_TO_FP: {
+            if (indices[0] <= 1 || indices[1] <= 1)
+                return null;
+
+            bool fits;
+            if (count == 1) {
+                // From the IEEE 754-2008 interchange format
+                fits = getBitVecWidth(args[0].get()) == indices[0] + indices[1];
+            } else if (count == 2 && isNamedSort(args[0].get(), SORT_ROUNDING_MODE)) {
+                // From another floating point sort, from a real or from a signed bit vector
+                fits = getFloatingPointFormat(args[1].get(), eb, sb) || isNamedSort(args[1].get(), SORT_REAL)
+                       || getBitVecWidth(args[1].get()) > 0;
+            } else {
+                fits = false;
+            }
+
+            return fits ? getFloatingPointSort(indices[0], indices[1]) : null;
+        }
+
+        case FP_TO_FP_UNSIGNED:
+            if (indices[0] <= 1 || indices[1] <= 1 || count != 2
+                || !isNamedSort(args[0].get(), SORT_ROUNDING_MODE) || getBitVecWidth(args[1].get()) <= 0)
+                return null;
+            return getFloatingPointSort(indices[0], indices[1]);
+
+        case FP_TO_BV:
+            if (indices[0] <= 0 || count != 2 || !isNamedSort(args[0].get(), SORT_ROUNDING_MODE)
+                || !getFloatingPointFormat(args[1].get(), eb, sb))
+                return null;
+            return getBitVecSort(indices[0]);
+
+        case FP_TO_REAL:
+            return count == 1 && getCommonFormat(args, 1, eb, sb) ? getNamedSort(SORT_REAL) : null;
+    }
+
+    return null;
+}
@@ -0,0 +1,75 @@
+/**
+ * \file ast_builtin_theories.h
+ * \brief Built-in sorts and functions of the indexed theory families.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_BUILTIN_THEORIES_H
+#define SMTLIB_PARSER_BUILTIN_THEORIES_H
+
+#include "ast/ast_identifier.h"
+#include "ast/ast_literal.h"
+#include "ast/ast_sort.h"
+
+#include <string>
+
+namespace smtlib {
+    /**
+     * Sorts and functions that theory files only describe in prose, such as
+     * (_ BitVec m), ((_ extract i j) (_ BitVec m) (_ BitVec n)), concat or
+     * (_ FloatingPoint eb sb). Their signatures are computed from the indices
+     * of the identifiers and the widths of the arguments, following rules
+     * compiled into tables, instead of being looked up in the symbol table.
+     * Results are shared sorts, built once per width and thread.
+     */
+    class BuiltinTheories {
+    public:
+        /** Groups of built-in symbols, enabled by loading the theories that describe them */
+        enum Family {
+            /** (_ BitVec m), #b and #x literals */
+            BITVECTOR_SORTS = 1,
+            /** concat, extract and the bv operations, including those of the QF_BV extensions */
+            BITVECTOR_FUNS = 2,
+            /** (_ FloatingPoint eb sb), its synonyms, values and operations */
+            FLOATING_POINT = 4
+        };
+
+    private:
+        unsigned int families;
+
+    public:
+        inline BuiltinTheories() : families(0) { }
+
+        /** Families enabled so far */
+        inline unsigned int getFamilies() { return families; }
+
+        /**
+         * Enable the families described by a theory
+         * \return Whether any family was enabled that was not enabled before
+         */
+        bool enable(const std::string& theory);
+
+        /** Checks whether a sort is a built-in indexed sort or sort synonym, with valid indices */
+        bool isSort(ast::Sort* sort);
+
+        /** Get the definition of a built-in sort synonym (e.g. Float32), or null if the sort is not one */
+        sptr_t<ast::Sort> expandSynonym(ast::Sort* sort);
+
+        /** Get the sort of a #b or #x literal, or null if the literal is not one */
+        sptr_t<ast::Sort> getLiteralSort(ast::NumeralLiteral* literal);
+
+        /** Get the sort of a built-in indexed constant (e.g. (_ bv5 8) or (_ NaN 8 24)), or null */
+        sptr_t<ast::Sort> getConstSort(ast::SimpleIdentifier* id);
+
+        /**
+         * Get the return sort of an application of a built-in function, or null
+         * if the function is not built in or the arguments do not fit
+         * \param id       Function identifier
+         * \param args     Sorts of the arguments
+         * \param count    Number of arguments
+         */
+        sptr_t<ast::Sort> getReturnSort(ast::SimpleIdentifier* id, const sptr_t<ast::Sort>* args, unsigned long count);
+    };
+}
+
+#endif //SMTLIB_PARSER_BUILTIN_THEORIES_H
@@ -1,101 +1,146 @@
 #include "ast_symbol_stack.h"
 
+#include "util/global_values.h"
+#include "util/stats.h"
+
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
-SymbolStack::SymbolStack() {
-    push();
-}
-
-sptr_t<SymbolTable> SymbolStack::getTopLevel() {
-    return stack[stack.size() - 1];
-}
-
-sptr_v<SymbolTable>& SymbolStack::getStack() {
-    return stack;
-}
-
 bool SymbolStack::push() {
-    unsigned long size = stack.size();
-    stack.push_back(make_shared<SymbolTable>());
-    return (stack.size() == size + 1);
+    table.push();
+    return true;
 }
 
 bool SymbolStack::push(unsigned long levels) {
-    unsigned long size = stack.size();
-    for (int i = 0; i < levels; i++)
-        stack.push_back(make_shared<SymbolTable>());
-    return (stack.size() == size + levels);
+    for (unsigned long i = 0; i < levels; i++)
+        table.push();
+    return true;
 }
 
 bool SymbolStack::pop() {
-    if (stack.size() <= 1) {
-        return false;
-    } else {
-        unsigned long size = stack.size();
-        stack.erase(stack.begin() + (stack.size() - 1));
-        return (stack.size() == size - 1);
-    }
+    return table.pop();
 }
 
 bool SymbolStack::pop(unsigned long levels) {
-    if (stack.size() <= 1 + levels || levels == 0) {
+    if (levels == 0 || levels >= table.getLevelCount()) {
         return false;
     } else {
-        unsigned long size = stack.size();
-        stack.erase(stack.begin() + (stack.size() - levels), stack.begin() + (stack.size() - 1));
-        return (stack.size() == size - 1);
+        for (unsigned long i = 0; i < levels; i++)
+            table.pop();
+        return true;
     }
 }
 
 void SymbolStack::reset() {
-    pop(stack.size() - 1);
-    getTopLevel()->reset();
+    table.reset();
+    binders.clear();
 }
 
-sptr_t<SortInfo> SymbolStack::getSortInfo(string name) {
-    sptr_t<SortInfo> null;
-    for (auto lvlIt = stack.begin(); lvlIt != stack.end(); lvlIt++) {
-        sptr_t<SortInfo> info = (*lvlIt)->getSortInfo(name);
-        if (info)
-            return info;
-    }
-    return null;
+sptr_t<SymbolStack> SymbolStack::snapshot() {
+    sptr_t<SymbolStack> copy = make_shared<SymbolStack>();
+    copy->table = table;
+    copy->builtins = builtins;
+    return copy;
 }
 
-sptr_v<FunInfo> SymbolStack::getFunInfo(string name) {
-    sptr_v<FunInfo> result;
-    for (auto lvlIt = stack.begin(); lvlIt != stack.end(); lvlIt++) {
-        sptr_v<FunInfo> infos = (*lvlIt)->getFunInfo(name);
-        result.insert(result.end(), infos.begin(), infos.end());
-    }
-    return result;
+sptr_t<SymbolStack> SymbolStack::fork() {
+    sptr_t<SymbolStack> copy = snapshot();
+    copy->binders.pushVisible(binders);
+    return copy;
+}
+
+void SymbolStack::enableBuiltins(const string& theory) {
+    // Built-in sort synonyms change the expansions of sorts
+    if (builtins.enable(theory))
+        expansions.clear();
+}
+
+void SymbolStack::addPendingSort(const string& name, sptr_t<AstNode> declaration, sptr_t<ISymbolLoader> loader) {
+    table.addPendingSort(name, PendingDeclaration(declaration, loader));
+}
+
+void SymbolStack::addPendingFun(const string& name, sptr_t<AstNode> declaration, sptr_t<ISymbolLoader> loader) {
+    table.addPendingFun(name, PendingDeclaration(declaration, loader));
 }
 
-sptr_t<VarInfo> SymbolStack::getVarInfo(string name) {
-    sptr_t<VarInfo> null;
-    for (auto lvlIt = stack.begin(); lvlIt != stack.end(); lvlIt++) {
-        sptr_t<VarInfo> info = (*lvlIt)->getVarInfo(name);
-        if (info)
-            return info;
+bool SymbolStack::loadPendingSorts(const string& name) {
+    vector<PendingDeclaration> declarations;
+    if (!table.takePendingSorts(name, declarations))
+        return false;
+
+    loadDeclarations(name, declarations);
+    return true;
+}
+
+bool SymbolStack::loadPendingFuns(const string& name) {
+    vector<PendingDeclaration> declarations;
+    if (!table.takePendingFuns(name, declarations))
+        return false;
+
+    loadDeclarations(name, declarations);
+    return true;
+}
+
+void SymbolStack::loadDeclarations(const string& name, vector<PendingDeclaration>& declarations) {
+    for (auto declIt = declarations.begin(); declIt != declarations.end(); declIt++) {
+        sptr_v<SortInfo> sorts;
+        sptr_v<FunInfo> funs;
+        declIt->loader->load(name, declIt->declaration, sorts, funs);
+        table.addLoaded(name, *declIt, sorts, funs);
     }
-    return null;
+}
+
+sptr_t<SortInfo> SymbolStack::getSortInfo(const string& name) {
+    sptr_t<SortInfo> info = table.getSortInfo(name);
+    if (!info && loadPendingSorts(name))
+        info = table.getSortInfo(name);
+    return info;
+}
+
+sptr_v<FunInfo> SymbolStack::getFunInfo(const string& name) {
+    return getFunOverloads(name).getInfos();
+}
+
+const FunOverloads& SymbolStack::getFunOverloads(const string& name) {
+    const FunOverloads& overloads = table.getFunOverloads(name);
+    if (overloads.getInfos().empty() && loadPendingFuns(name))
+        return table.getFunOverloads(name);
+    return overloads;
+}
+
+const sptr_v<FunInfo>& SymbolStack::getNumeralInfo() {
+    const sptr_v<FunInfo>& infos = table.getNumeralInfo();
+    if (infos.empty() && loadPendingFuns(MSCONST_NUMERAL))
+        return table.getNumeralInfo();
+    return infos;
+}
+
+const sptr_v<FunInfo>& SymbolStack::getDecimalInfo() {
+    const sptr_v<FunInfo>& infos = table.getDecimalInfo();
+    if (infos.empty() && loadPendingFuns(MSCONST_DECIMAL))
+        return table.getDecimalInfo();
+    return infos;
+}
+
+const sptr_v<FunInfo>& SymbolStack::getStringInfo() {
+    const sptr_v<FunInfo>& infos = table.getStringInfo();
+    if (infos.empty() && loadPendingFuns(MSCONST_STRING))
+        return table.getStringInfo();
+    return infos;
+}
+
+sptr_t<VarInfo> SymbolStack::getVarInfo(const string& name) {
+    return table.getVarInfo(name);
 }
 
 sptr_t<SortInfo> SymbolStack::findDuplicate(sptr_t<SortInfo> info) {
-    sptr_t<SortInfo> null;
-    for (auto lvlIt = stack.begin(); lvlIt != stack.end(); lvlIt++) {
-        sptr_t<SortInfo> dup = (*lvlIt)->getSortInfo(info->name);
-        if (dup)
-            return dup;
-    }
-    return null;
+    return getSortInfo(info->name);
 }
 
 sptr_t<FunInfo> SymbolStack::findDuplicate(sptr_t<FunInfo> info) {
     sptr_t<FunInfo> null;
-    sptr_v<FunInfo> knownFuns = getFunInfo(info->name);
+    const sptr_v<FunInfo>& knownFuns = getFunOverloads(info->name).getInfos();
     for (auto funIt = knownFuns.begin(); funIt != knownFuns.end(); funIt++) {
         if (info->params.size() == 0 && (*funIt)->params.size() == 0) {
             if (equal(info->signature, (*funIt)->signature)) {
@@ -112,7 +157,7 @@ sptr_t<FunInfo> SymbolStack::findDuplicate(sptr_t<FunInfo> info) {
 }
 
 sptr_t<VarInfo> SymbolStack::findDuplicate(sptr_t<VarInfo> info) {
-    return getTopLevel()->getVarInfo(info->name);
+    return table.getLocalVarInfo(info->name);
 }
 
 sptr_t<Sort> SymbolStack::replace(sptr_t<Sort> sort, sptr_um2<string, Sort>& mapping) {
@@ -148,24 +193,43 @@ sptr_t<Sort> SymbolStack::expand(sptr_t<Sort> sort) {
     if (!sort)
         return sort;
 
+    Stats::count(Stats::STAT_SORT_EXPANSIONS);
+
+    if (expansionsStamp != table.getSortsStamp()) {
+        expansions.clear();
+        expansionsStamp = table.getSortsStamp();
+    }
+
+    auto expansionIt = expansions.find(sort);
+    if (expansionIt != expansions.end()) {
+        if (expansionIt->second.get() == expansionIt->first.get())
+            return sort;
+        else
+            return expansionIt->second;
+    }
+
+    sptr_t<Sort> result = expandUncached(sort);
+    expansions[sort] = result.get() == sort.get() ? sort : result;
+    return result;
+}
+
+sptr_t<Sort> SymbolStack::expandUncached(sptr_t<Sort> sort) {
+    Stats::count(Stats::STAT_SORT_EXPANSIONS_UNCACHED);
     sptr_t<Sort> null;
 
-    sptr_t<SortInfo> info = getSortInfo(sort->getIdentifier()->toString());
+    sptr_t<SimpleIdentifier> id = sort->getIdentifier();
+    sptr_t<SortInfo> info = id->isIndexed() ? getSortInfo(id->toString())
+                                            : getSortInfo(id->getSymbol()->getValue());
     if (!sort->hasArgs()) {
         if (info && info->definition) {
             if (info->definition->params.empty()) {
-                sptr_t<Sort> newsort = make_shared<Sort>(info->definition->sort->getIdentifier(),
-                                                             info->definition->sort->getArgs());
-                newsort->setRowLeft(sort->getRowLeft());
-                newsort->setColLeft(sort->getColLeft());
-                newsort->setRowRight(sort->getRowRight());
-                newsort->setColRight(sort->getColRight());
-                newsort->setFilename(sort->getFilename());
-
-                return newsort;
+                return info->definition->sort;
             } else {
                 return null;
             }
+        } else if (!info) {
+            sptr_t<Sort> synonym = builtins.expandSynonym(sort.get());
+            return synonym ? synonym : sort;
         } else {
             return sort;
         }
@@ -173,19 +237,11 @@ sptr_t<Sort> SymbolStack::expand(sptr_t<Sort> sort) {
         if (info && info->definition) {
             if (info->definition->params.size() == sort->getArgs().size()) {
                 sptr_um2<string, Sort> mapping;
-                for (int i = 0; i < info->definition->params.size(); i++) {
+                for (unsigned long i = 0; i < info->definition->params.size(); i++) {
                     mapping[info->definition->params[i]->toString()] = sort->getArgs()[i];
                 }
 
-                sptr_t<Sort> newsort = replace(info->definition->sort, mapping);
-                newsort = expand(newsort);
-                newsort->setRowLeft(sort->getRowLeft());
-                newsort->setColLeft(sort->getColLeft());
-                newsort->setRowRight(sort->getRowRight());
-                newsort->setColRight(sort->getColRight());
-                newsort->setFilename(sort->getFilename());
-
-                return newsort;
+                return expand(replace(info->definition->sort, mapping));
             } else {
                 return null;
             }
@@ -195,7 +251,7 @@ sptr_t<Sort> SymbolStack::expand(sptr_t<Sort> sort) {
 
             sptr_v<Sort> newargs;
             bool changed = false;
-            sptr_v<Sort> argSorts = sort->getArgs();
+            sptr_v<Sort>& argSorts = sort->getArgs();
             for (auto argIt = argSorts.begin(); argIt != argSorts.end(); argIt++) {
                 sptr_t<Sort> result = expand(*argIt);
                 if (!result)
@@ -207,14 +263,7 @@ sptr_t<Sort> SymbolStack::expand(sptr_t<Sort> sort) {
             }
 
             if (changed) {
-                sptr_t<Sort> newsort = make_shared<Sort>(sort->getIdentifier(), newargs);
-                newsort->setRowLeft(sort->getRowLeft());
-                newsort->setColLeft(sort->getColLeft());
-                newsort->setRowRight(sort->getRowRight());
-                newsort->setColRight(sort->getColRight());
-                newsort->setFilename(sort->getFilename());
-
-                return newsort;
+                return make_shared<Sort>(id, newargs);
             } else {
                 return sort;
             }
@@ -223,6 +272,7 @@ sptr_t<Sort> SymbolStack::expand(sptr_t<Sort> sort) {
 }
 
 bool SymbolStack::equal(sptr_t<Sort> sort1, sptr_t<Sort> sort2) {
+    Stats::count(Stats::STAT_SORT_COMPARISONS);
     if(sort1 && sort2) {
         return sort1->toString() == sort2->toString();
     } else {
@@ -294,6 +344,7 @@ bool SymbolStack::equal(sptr_v<Sort>& signature1,
 
 bool SymbolStack::equal(sptr_v<Symbol>& params1, sptr_v<Sort>& signature1,
                         sptr_v<Symbol>& params2, sptr_v<Sort>& signature2) {
+    Stats::count(Stats::STAT_SORT_COMPARISONS);
     if (params1.size() != params2.size() || signature1.size() != signature2.size())
         return false;
 
@@ -312,20 +363,20 @@ bool SymbolStack::equal(sptr_v<Symbol>& params1, sptr_v<Sort>& signature1,
 sptr_t<SortInfo> SymbolStack::tryAdd(sptr_t<SortInfo> info) {
     sptr_t<SortInfo> dup = findDuplicate(info);
     if (!dup)
-        getTopLevel()->add(info);
+        table.add(info);
     return dup;
 }
 
 sptr_t<FunInfo> SymbolStack::tryAdd(sptr_t<FunInfo> info) {
     sptr_t<FunInfo> dup = findDuplicate(info);
     if (!dup)
-        getTopLevel()->add(info);
+        table.add(info);
     return dup;
 }
 
 sptr_t<VarInfo> SymbolStack::tryAdd(sptr_t<VarInfo> info) {
     sptr_t<VarInfo> dup = findDuplicate(info);
     if (!dup)
-        getTopLevel()->add(info);
+        table.add(info);
     return dup;
 }
\ No newline at end of file
@@ -7,16 +7,59 @@
 #ifndef SMTLIB_PARSER_SYMBOL_STACK_H
 #define SMTLIB_PARSER_SYMBOL_STACK_H
 
+#include "ast_binder_stack.h"
+#include "ast_builtin_theories.h"
 #include "ast_symbol_table.h"
 
 #include <memory>
+#include <unordered_map>
 #include <vector>
 
 namespace smtlib {
-    /** A stack of symbol tables */
+    /**
+     * A stack of scopes of known sorts, functions and variables.
+     * Taking a snapshot of the stack is cheap, and a snapshot is not affected
+     * by later changes to the stack, so it can be handed over to another thread.
+     * Since expansions of sorts are cached inside the stack, each thread should
+     * work on its own snapshot.
+     *
+     * Declarations from theory files can be added as pending; their symbols are
+     * added only when their name is first looked up or declared again, and they
+     * are added to the level in which the declarations were kept aside.
+     */
     class SymbolStack {
     private:
-        sptr_v<SymbolTable> stack;
+        /** Hash of a sort, consistent with its textual representation */
+        struct SortHash {
+            inline size_t operator()(const sptr_t<ast::Sort>& sort) const { return sort->hash(); }
+        };
+
+        /** Equality of sorts with the same textual representation */
+        struct SortEquals {
+            inline bool operator()(const sptr_t<ast::Sort>& sort1, const sptr_t<ast::Sort>& sort2) const {
+                return sort1->equals(sort2.get());
+            }
+        };
+
+        SymbolTable table;
+        BinderStack binders;
+        BuiltinTheories builtins;
+
+        /**
+         * Expansions of the sorts seen so far, computed for the sorts of the table
+         * with the stamp expansionsStamp. A sort that expands to itself is mapped
+         * to itself, and a sort that cannot be expanded is mapped to null.
+         */
+        std::unordered_map<sptr_t<ast::Sort>, sptr_t<ast::Sort>, SortHash, SortEquals> expansions;
+        unsigned long expansionsStamp;
+
+        sptr_t<ast::Sort> expandUncached(sptr_t<ast::Sort> sort);
+
+        /** Check the pending declarations of sorts or of functions with a given name and add their symbols */
+        bool loadPendingSorts(const std::string& name);
+        bool loadPendingFuns(const std::string& name);
+
+        void loadDeclarations(const std::string& name, std::vector<PendingDeclaration>& declarations);
 
         bool equal(sptr_t<ast::Sort> sort1,
                    sptr_t<ast::Sort> sort2);
@@ -32,28 +75,64 @@ namespace smtlib {
                    std::unordered_map<std::string, std::string> &mapping);
 
     public:
-        SymbolStack();
-
-        sptr_t<SymbolTable> getTopLevel();
-
-        sptr_v<SymbolTable>& getStack();
+        inline SymbolStack() : expansionsStamp(0) { }
 
         bool push();
         bool push(unsigned long levels);
 
         bool pop();
+
+        /**
+         * Remove the last levels, as (pop n) does: n levels pushed since the first one
+         * are removed, so (push n) followed by (pop n) goes back to the same scope.
+         * \return Whether they were removed; nothing is removed if n is 0 or if fewer
+         *         than n levels have been pushed
+         */
         bool pop(unsigned long levels);
 
         void reset();
 
-        sptr_t<SortInfo> getSortInfo(std::string name);
-        sptr_v<FunInfo> getFunInfo(std::string name);
-        sptr_t<VarInfo> getVarInfo(std::string name);
+        /** Get a new stack with the same sorts, functions and variables, and no bound variables */
+        sptr_t<SymbolStack> snapshot();
+
+        /** Get a snapshot of the stack in which the variables bound so far inside terms are still bound */
+        sptr_t<SymbolStack> fork();
+
+        /** Get the scopes of variables bound inside terms */
+        inline BinderStack& getBinders() { return binders; }
+
+        /** Get the built-in sorts and functions of the theories loaded so far */
+        inline BuiltinTheories& getBuiltins() { return builtins; }
+
+        /** Enable the built-in sorts and functions described by a theory, if there are any */
+        void enableBuiltins(const std::string& theory);
+
+        /** Keep a theory declaration of a sort or of a function aside, until the name it declares is first needed */
+        void addPendingSort(const std::string& name, sptr_t<ast::AstNode> declaration, sptr_t<ISymbolLoader> loader);
+        void addPendingFun(const std::string& name, sptr_t<ast::AstNode> declaration, sptr_t<ISymbolLoader> loader);
+
+        sptr_t<SortInfo> getSortInfo(const std::string& name);
+        sptr_v<FunInfo> getFunInfo(const std::string& name);
+        sptr_t<VarInfo> getVarInfo(const std::string& name);
+
+        /** Get all functions with the given name, indexed for overload resolution */
+        const FunOverloads& getFunOverloads(const std::string& name);
+
+        /** Get the functions giving the sorts of numerals, decimals and string literals */
+        const sptr_v<FunInfo>& getNumeralInfo();
+        const sptr_v<FunInfo>& getDecimalInfo();
+        const sptr_v<FunInfo>& getStringInfo();
 
         sptr_t<SortInfo> findDuplicate(sptr_t<SortInfo> info);
         sptr_t<FunInfo> findDuplicate(sptr_t<FunInfo> info);
         sptr_t<VarInfo> findDuplicate(sptr_t<VarInfo> info);
 
+        /**
+         * Replace the sort aliases in a sort by their definitions, or return null if the
+         * sort has the wrong number of arguments. Expansions are shared between all the
+         * uses of equal sorts and must not be modified; they do not carry the location of
+         * the use, which stays in the unexpanded sort. A sort without aliases is returned as is.
+         */
         sptr_t<ast::Sort> expand(sptr_t<ast::Sort> sort);
         sptr_t<ast::Sort> replace(sptr_t<ast::Sort>, sptr_um2<std::string, ast::Sort>& mapping);
 
@@ -2,108 +2,251 @@
 
 #include "ast/ast_command.h"
 #include "ast/ast_symbol_decl.h"
+#include "util/global_values.h"
+#include "util/stats.h"
+
+#include <algorithm>
 
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
-unordered_map<string, sptr_t<SortInfo>>& SymbolTable::getSorts() {
-    return sorts;
+void SymbolTable::push() {
+    levels.push_back(current);
 }
 
-unordered_map<string, sptr_v<FunInfo>>& SymbolTable::getFuns() {
-    return funs;
-}
+bool SymbolTable::pop() {
+    if (levels.empty())
+        return false;
 
-unordered_map<string, sptr_t<VarInfo>>& SymbolTable::getVars() {
-    return vars;
+    current = levels.back();
+    levels.pop_back();
+    return true;
 }
 
-sptr_t<SortInfo> SymbolTable::getSortInfo(string name) {
-    auto it = sorts.find(name);
-    if (it != sorts.end()) {
-        return it->second;
+sptr_t<SortInfo> SymbolTable::getSortInfo(const string& name) {
+    unsigned depth;
+    const sptr_t<SortInfo>* info = current.sorts.find(name, depth);
+    Stats::count(Stats::STAT_SORT_LOOKUPS);
+    Stats::count(Stats::STAT_LOOKUP_DEPTH, depth);
+
+    if (info) {
+        return *info;
     } else {
         sptr_t<SortInfo> empty;
         return empty;
     }
 }
 
-sptr_v<FunInfo> SymbolTable::getFunInfo(string name) {
-    auto it = funs.find(name);
-    if (it != funs.end()) {
-        return it->second;
+const sptr_v<FunInfo>& SymbolTable::getFunInfo(const string& name) {
+    return getFunOverloads(name).getInfos();
+}
+
+const FunOverloads& SymbolTable::getFunOverloads(const string& name) {
+    static const FunOverloads empty;
+
+    unsigned depth;
+    const FunOverloads* overloads = current.funs.find(name, depth);
+    Stats::count(Stats::STAT_FUN_LOOKUPS);
+    Stats::count(Stats::STAT_LOOKUP_DEPTH, depth);
+
+    if (overloads) {
+        return *overloads;
     } else {
-        sptr_v<FunInfo> empty;
         return empty;
     }
 }
 
-sptr_t<VarInfo> SymbolTable::getVarInfo(string name) {
-    auto it = vars.find(name);
-    if (it != vars.end()) {
-        return it->second;
+const sptr_v<FunInfo>& SymbolTable::getNumeralInfo() {
+    static const sptr_v<FunInfo> empty;
+    return current.numerals ? current.numerals->getInfos() : empty;
+}
+
+const sptr_v<FunInfo>& SymbolTable::getDecimalInfo() {
+    static const sptr_v<FunInfo> empty;
+    return current.decimals ? current.decimals->getInfos() : empty;
+}
+
+const sptr_v<FunInfo>& SymbolTable::getStringInfo() {
+    static const sptr_v<FunInfo> empty;
+    return current.strings ? current.strings->getInfos() : empty;
+}
+
+void SymbolTable::updateLiteralInfo(Version& version) {
+    version.numerals = version.funs.find(MSCONST_NUMERAL);
+    version.decimals = version.funs.find(MSCONST_DECIMAL);
+    version.strings = version.funs.find(MSCONST_STRING);
+}
+
+sptr_t<VarInfo> SymbolTable::getVarInfo(const string& name) {
+    unsigned depth;
+    const VarEntry* entry = current.vars.find(name, depth);
+    Stats::count(Stats::STAT_VAR_LOOKUPS);
+    Stats::count(Stats::STAT_LOOKUP_DEPTH, depth);
+
+    if (entry) {
+        return entry->info;
     } else {
         sptr_t<VarInfo> empty;
         return empty;
     }
 }
 
-bool SymbolTable::add(sptr_t<SortInfo> info) {
-    if(sorts.find(info->name) == sorts.end()) {
-        sorts[info->name] = info;
-        return true;
+sptr_t<VarInfo> SymbolTable::getLocalVarInfo(const string& name) {
+    unsigned depth;
+    const VarEntry* entry = current.vars.find(name, depth);
+    Stats::count(Stats::STAT_VAR_LOOKUPS);
+    Stats::count(Stats::STAT_LOOKUP_DEPTH, depth);
+
+    if (entry && entry->level == levels.size()) {
+        return entry->info;
     } else {
-        return false;
+        sptr_t<VarInfo> empty;
+        return empty;
     }
 }
 
-bool SymbolTable::add(sptr_t<FunInfo> info) {
-    funs[info->name].push_back(info);
-    return true;
+void SymbolTable::add(sptr_t<SortInfo> info) {
+    current.sorts.set(info->name, info);
+    current.sortsStamp = ++lastSortsStamp;
 }
 
-bool SymbolTable::add(sptr_t<VarInfo> info) {
-    if(vars.find(info->name) == vars.end()) {
-        vars[info->name] = info;
-        return true;
-    } else {
+void SymbolTable::add(sptr_t<FunInfo> info) {
+    FunOverloads overloads = getFunOverloads(info->name);
+    overloads.add(info);
+    current.funs.set(info->name, overloads);
+    updateLiteralInfo(current);
+}
+
+void SymbolTable::add(sptr_t<VarInfo> info) {
+    current.vars.set(info->name, VarEntry(info, levels.size()));
+}
+
+typedef PersistentMap<string, vector<PendingDeclaration>> PendingMap;
+
+static void addPending(PendingMap& pending, const string& name, const PendingDeclaration& declaration) {
+    const vector<PendingDeclaration>* known = pending.find(name);
+    vector<PendingDeclaration> declarations;
+    if (known)
+        declarations = *known;
+    declarations.push_back(declaration);
+    pending.set(name, declarations);
+}
+
+static bool takePending(PendingMap& pending, const string& name, vector<PendingDeclaration>& declarations) {
+    const vector<PendingDeclaration>* known = pending.find(name);
+    if (!known || known->empty())
         return false;
+
+    declarations = *known;
+    pending.set(name, vector<PendingDeclaration>());
+    return true;
+}
+
+static void removePending(PendingMap& pending, const string& name, const PendingDeclaration& declaration) {
+    const vector<PendingDeclaration>* known = pending.find(name);
+    if (!known)
+        return;
+
+    vector<PendingDeclaration> declarations;
+    for (auto declIt = known->begin(); declIt != known->end(); declIt++) {
+        if (declIt->declaration != declaration.declaration)
+            declarations.push_back(*declIt);
     }
+
+    if (declarations.size() != known->size())
+        pending.set(name, declarations);
 }
 
-void SymbolTable::reset() {
-    // Clear all variables
-    vars.clear();
+void SymbolTable::addPendingSort(const string& name, const PendingDeclaration& declaration) {
+    PendingDeclaration pending = declaration;
+    pending.level = levels.size();
+    addPending(current.pendingSorts, name, pending);
+}
 
-    // Erase sort information that does not come from theory files
-    sptr_v<SortInfo> sortInfos;
-    for (auto sortIt = sorts.begin(); sortIt != sorts.end(); sortIt++) {
-        sortInfos.push_back(sortIt->second);
+void SymbolTable::addPendingFun(const string& name, const PendingDeclaration& declaration) {
+    PendingDeclaration pending = declaration;
+    pending.level = levels.size();
+    addPending(current.pendingFuns, name, pending);
+}
+
+bool SymbolTable::takePendingSorts(const string& name, vector<PendingDeclaration>& declarations) {
+    return takePending(current.pendingSorts, name, declarations);
+}
+
+bool SymbolTable::takePendingFuns(const string& name, vector<PendingDeclaration>& declarations) {
+    return takePending(current.pendingFuns, name, declarations);
+}
+
+void SymbolTable::addLoaded(const string& name, const PendingDeclaration& declaration,
+                            const sptr_v<SortInfo>& sorts, const sptr_v<FunInfo>& funs) {
+    for (unsigned long i = declaration.level; i < levels.size(); i++) {
+        addLoaded(levels[i], name, declaration, sorts, funs);
     }
+    addLoaded(current, name, declaration, sorts, funs);
+}
 
-    for (auto sortInfoIt = sortInfos.begin(); sortInfoIt != sortInfos.end(); sortInfoIt++) {
-        if(!dynamic_pointer_cast<SortSymbolDeclaration>((*sortInfoIt)->source)) {
-            sorts.erase((*sortInfoIt)->name);
+void SymbolTable::addLoaded(Version& version, const string& name, const PendingDeclaration& declaration,
+                            const sptr_v<SortInfo>& sorts, const sptr_v<FunInfo>& funs) {
+    removePending(version.pendingSorts, name, declaration);
+    removePending(version.pendingFuns, name, declaration);
+
+    for (auto sortIt = sorts.begin(); sortIt != sorts.end(); sortIt++) {
+        const sptr_t<SortInfo>* known = version.sorts.find((*sortIt)->name);
+        if (!known || *known != *sortIt) {
+            version.sorts.set((*sortIt)->name, *sortIt);
+            version.sortsStamp = ++lastSortsStamp;
         }
     }
 
-    // Erase function information that does not come from theory files
-    vector<string> funKeys;
-    vector<sptr_v<FunInfo>> funInfos;
+    bool funsChanged = false;
     for (auto funIt = funs.begin(); funIt != funs.end(); funIt++) {
-        funKeys.push_back(funIt->first);
-        funInfos.push_back(funIt->second);
+        const FunOverloads* known = version.funs.find((*funIt)->name);
+        if (known && find(known->getInfos().begin(), known->getInfos().end(), *funIt) != known->getInfos().end())
+            continue;
+
+        FunOverloads overloads;
+        if (known)
+            overloads = *known;
+        overloads.add(*funIt);
+        version.funs.set((*funIt)->name, overloads);
+        funsChanged = true;
     }
 
-    for (int i = 0; i < funKeys.size(); i++) {
-        sptr_v<FunInfo>& info = funs[funKeys[i]];
-        for (int j = 0; j < funInfos[i].size(); j++) {
-            if(!dynamic_pointer_cast<FunSymbolDeclaration>(funInfos[i][j]->source)) {
-                info.erase(info.begin() + j);
-            }
-        }
-        if(info.empty())
-            funs.erase(funKeys[i]);
+    if (funsChanged)
+        updateLiteralInfo(version);
+}
+
+void SymbolTable::reset() {
+    if (!levels.empty()) {
+        current = levels[0];
+        levels.clear();
     }
-}
\ No newline at end of file
+
+    // Clear all variables
+    current.vars.clear();
+
+    // Keep only sort information that comes from theory files
+    PersistentMap<string, sptr_t<SortInfo>> sorts;
+    current.sorts.forEach([&](const string& name, const sptr_t<SortInfo>& info) {
+        if (dynamic_pointer_cast<SortSymbolDeclaration>(info->source))
+            sorts.set(name, info);
+    });
+    current.sorts = sorts;
+    current.sortsStamp = ++lastSortsStamp;
+
+    // Keep only function information that comes from theory files
+    PersistentMap<string, FunOverloads> funs;
+    current.funs.forEach([&](const string& name, const FunOverloads& overloads) {
+        FunOverloads kept;
+        const sptr_v<FunInfo>& infos = overloads.getInfos();
+        for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
+            if (dynamic_pointer_cast<FunSymbolDeclaration>((*infoIt)->source))
+                kept.add(*infoIt);
+        }
+        if (!kept.getInfos().empty())
+            funs.set(name, kept);
+    });
+    current.funs = funs;
+    updateLiteralInfo(current);
+}
@@ -1,6 +1,6 @@
 /**
  * \file ast_symbol_table.h
- * \brief Table of known sorts, functions and variables.
+ * \brief Scoped table of known sorts, functions and variables.
  * \author Cristina Serban <cristina.serban89@gmail.com>
  */
 
@@ -8,34 +8,170 @@
 #define SMTLIB_PARSER_SMT_SYMBOL_TABLE_H
 
 #include "ast_symbol_util.h"
+#include "util/persistent_map.h"
 
 #include <memory>
 #include <string>
-#include <unordered_map>
+#include <vector>
 
 namespace smtlib {
-    /** A table of known sorts, functions and variables */
+    class SymbolStack;
+
+    /** Gives the symbols of a theory declaration, once they are first needed */
+    class ISymbolLoader {
+    public:
+        /**
+         * Get the sorts and functions declared by a theory declaration
+         * \param name     Name under which the declaration was kept aside
+         */
+        virtual void load(const std::string& name, sptr_t<ast::AstNode> declaration,
+                          sptr_v<SortInfo>& sorts, sptr_v<FunInfo>& funs) = 0;
+    };
+
+    /** Theory declaration whose symbols have not been added to a table yet */
+    struct PendingDeclaration {
+        sptr_t<ast::AstNode> declaration;
+        sptr_t<ISymbolLoader> loader;
+
+        /** Level in which the declaration was kept aside */
+        unsigned long level;
+
+        inline PendingDeclaration(sptr_t<ast::AstNode> declaration, sptr_t<ISymbolLoader> loader)
+                : declaration(declaration), loader(loader), level(0) { }
+    };
+
+    /**
+     * A table of known sorts, functions and variables, organized in levels.
+     * The contents of the table are kept in persistent maps: a level is
+     * pushed by saving the current version and popped by restoring it, and
+     * copying a table (for instance, to keep a snapshot of it after a logic
+     * has been loaded) takes time proportional only to the number of levels.
+     * Copies share their unchanged parts and can be read concurrently.
+     */
     class SymbolTable {
     private:
-        sptr_um2<std::string, SortInfo> sorts;
-        umap<std::string, sptr_v<FunInfo>> funs;
-        sptr_um2<std::string,VarInfo> vars;
+        /** Variable entry, together with the level in which it was added */
+        struct VarEntry {
+            sptr_t<VarInfo> info;
+            unsigned long level;
+
+            inline VarEntry(sptr_t<VarInfo> info, unsigned long level) : info(info), level(level) { }
+        };
+
+        /** Contents of the table at some point in time */
+        struct Version {
+            PersistentMap<std::string, sptr_t<SortInfo>> sorts;
+            PersistentMap<std::string, FunOverloads> funs;
+            PersistentMap<std::string, VarEntry> vars;
+
+            // Theory declarations not added yet, by declared name (an empty list once they are taken)
+            PersistentMap<std::string, std::vector<PendingDeclaration>> pendingSorts;
+            PersistentMap<std::string, std::vector<PendingDeclaration>> pendingFuns;
+
+            // Functions giving the sorts of literals, looked up again whenever a function is added
+            const FunOverloads* numerals;
+            const FunOverloads* decimals;
+            const FunOverloads* strings;
+
+            // Stamp of the sort map, changed whenever a sort is added or removed
+            unsigned long sortsStamp;
+
+            inline Version() : numerals(NULL), decimals(NULL), strings(NULL), sortsStamp(0) { }
+        };
+
+        Version current;
+
+        /** Last stamp given to a sort map */
+        unsigned long lastSortsStamp;
+
+        /** Update the functions giving the sorts of literals */
+        static void updateLiteralInfo(Version& version);
+
+        /** Add the symbols of a pending declaration to a version, unless they are there already */
+        void addLoaded(Version& version, const std::string& name, const PendingDeclaration& declaration,
+                       const sptr_v<SortInfo>& sorts, const sptr_v<FunInfo>& funs);
+
+        /** Versions saved when each level after the first was pushed */
+        std::vector<Version> levels;
 
     public:
-        umap<std::string, sptr_t<SortInfo>>& getSorts();
-        umap<std::string, sptr_v<FunInfo>>& getFuns();
-        umap<std::string, sptr_t<VarInfo>>& getVars();
+        inline SymbolTable() : lastSortsStamp(0) { }
+
+        /**
+         * Stamp identifying the current set of sorts.
+         * The sorts of a table are the same whenever its stamp is the same.
+         */
+        inline unsigned long getSortsStamp() { return current.sortsStamp; }
+
+        /** Number of levels, including the first one */
+        inline unsigned long getLevelCount() { return levels.size() + 1; }
+
+        /** Add a new level */
+        void push();
+
+        /** Remove the last level, together with its entries. The first level cannot be removed. */
+        bool pop();
+
+        /** Get the sort with the given name */
+        sptr_t<SortInfo> getSortInfo(const std::string& name);
+
+        /**
+         * Get all functions with the given name, in the order in which they were added.
+         * The result stays valid until the table is changed.
+         */
+        const sptr_v<FunInfo>& getFunInfo(const std::string& name);
+
+        /**
+         * Get all functions with the given name, indexed for overload resolution.
+         * The result stays valid until the table is changed.
+         */
+        const FunOverloads& getFunOverloads(const std::string& name);
+
+        /** Get the functions giving the sort of numerals (NUMERAL) */
+        const sptr_v<FunInfo>& getNumeralInfo();
+
+        /** Get the functions giving the sort of decimals (DECIMAL) */
+        const sptr_v<FunInfo>& getDecimalInfo();
+
+        /** Get the functions giving the sort of string literals (STRING) */
+        const sptr_v<FunInfo>& getStringInfo();
+
+        /** Get the innermost variable with the given name */
+        sptr_t<VarInfo> getVarInfo(const std::string& name);
+
+        /** Get the variable with the given name, if it was added in the last level */
+        sptr_t<VarInfo> getLocalVarInfo(const std::string& name);
+
+        void add(sptr_t<SortInfo> info);
+        void add(sptr_t<FunInfo> info);
+        void add(sptr_t<VarInfo> info);
+
+        /** Keep a theory declaration of a sort or of a function aside, until its name is first looked up */
+        void addPendingSort(const std::string& name, const PendingDeclaration& declaration);
+        void addPendingFun(const std::string& name, const PendingDeclaration& declaration);
 
-        sptr_t<SortInfo> getSortInfo(std::string name);
-        sptr_v<FunInfo> getFunInfo(std::string name);
-        sptr_t<VarInfo> getVarInfo(std::string name);
+        /**
+         * Take the pending declarations of sorts or of functions with a given name,
+         * which are then no longer pending
+         * \return Whether there were any
+         */
+        bool takePendingSorts(const std::string& name, std::vector<PendingDeclaration>& declarations);
+        bool takePendingFuns(const std::string& name, std::vector<PendingDeclaration>& declarations);
 
-        bool add(sptr_t<SortInfo> info);
-        bool add(sptr_t<FunInfo> info);
-        bool add(sptr_t<VarInfo> info);
+        /**
+         * Add the symbols of a pending declaration that has been taken. They are added to the level
+         * in which the declaration was kept aside, so that popping the levels pushed since then
+         * does not make the declaration pending again.
+         */
+        void addLoaded(const std::string& name, const PendingDeclaration& declaration,
+                       const sptr_v<SortInfo>& sorts, const sptr_v<FunInfo>& funs);
 
+        /**
+         * Remove all levels but the first, all variables and all sorts and
+         * functions that do not come from theory files
+         */
         void reset();
     };
 }
 
-#endif //SMTLIB_PARSER_SMT_SYMBOL_TABLE_H
\ No newline at end of file
+#endif //SMTLIB_PARSER_SMT_SYMBOL_TABLE_H
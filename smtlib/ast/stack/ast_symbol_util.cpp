@@ -1,5 +1,89 @@
 #include "ast_symbol_util.h"
 
+using namespace std;
 using namespace smtlib;
+using namespace smtlib::ast;
 
-SymbolInfo::~SymbolInfo() { }
\ No newline at end of file
+SymbolInfo::~SymbolInfo() { }
+
+/* ===================================== FunInfo ====================================== */
+
+bool FunInfo::acceptsArgs(unsigned long count) {
+    if (count >= 2 && (assocL || assocR || chainable || pairwise))
+        return true;
+    return signature.size() == count + 1;
+}
+
+unsigned long FunInfo::getArgPosition(unsigned long index, unsigned long count) {
+    if (count >= 2) {
+        if (assocL)
+            return index == 0 ? 0 : 1;
+        if (assocR)
+            return index < count - 1 ? 0 : 1;
+        if (chainable || pairwise)
+            return 0;
+    }
+    return index;
+}
+
+unsigned long FunInfo::getReturnPosition(unsigned long count) {
+    if (count >= 2 && (assocL || assocR || chainable || pairwise))
+        return 2;
+    return signature.size() - 1;
+}
+
+/** Append the positions of the sort parameters at each node of a sort, in preorder */
+static void indexParams(Sort* sort, sptr_v<Symbol>& params, vector<long>& indices) {
+    long index = -1;
+    if (!sort->hasArgs() && !sort->getIdentifier()->isIndexed()) {
+        const string& name = sort->getIdentifier()->getSymbol()->getValue();
+        for (unsigned long i = 0; i < params.size() && index < 0; i++) {
+            if (params[i]->getValue() == name)
+                index = (long) i;
+        }
+    }
+    indices.push_back(index);
+
+    sptr_v<Sort>& args = sort->getArgs();
+    for (auto argIt = args.begin(); argIt != args.end(); argIt++) {
+        indexParams((*argIt).get(), params, indices);
+    }
+}
+
+void FunInfo::indexParams() {
+    paramIndices.clear();
+    if (params.empty())
+        return;
+
+    paramIndices.resize(signature.size());
+    for (unsigned long i = 0; i < signature.size(); i++) {
+        if (signature[i])
+            ::indexParams(signature[i].get(), params, paramIndices[i]);
+    }
+}
+
+/* =================================== FunOverloads =================================== */
+
+const vector<unsigned long>& FunOverloads::getByFirstArg(Sort* sort) const {
+    static const vector<unsigned long> empty;
+
+    if (byFirstArg.empty())
+        return empty;
+
+    auto it = byFirstArg.find(sort->hash());
+    if (it != byFirstArg.end()) {
+        return it->second;
+    } else {
+        return empty;
+    }
+}
+
+void FunOverloads::add(sptr_t<FunInfo> info) {
+    unsigned long pos = infos.size();
+    infos.push_back(info);
+
+    if (info->params.empty() && info->signature.size() >= 2 && info->signature[0])
+        byFirstArg[info->signature[0]->hash()].push_back(pos);
+    else
+        others.push_back(pos);
+}
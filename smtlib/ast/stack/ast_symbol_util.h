@@ -9,9 +9,11 @@
 
 #include "ast/ast_basic.h"
 #include "ast/ast_term.h"
+#include "ast/ast_sort.h"
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace smtlib {
 
@@ -94,9 +96,19 @@ namespace smtlib {
             pairwise = false;
         }
 
+        /** Resolve the sort parameters in the signature to their positions in params */
+        void indexParams();
+
     public:
         sptr_v<ast::Sort> signature;
         sptr_v<ast::Symbol> params;
+
+        /**
+         * For each sort in the signature, the positions in params of the sort parameters
+         * at each of its nodes, in preorder (-1 for the nodes that are not sort parameters).
+         * Empty if the function has no sort parameters.
+         */
+        std::vector<std::vector<long>> paramIndices;
         sptr_t<ast::Term> body;
         sptr_v<ast::Attribute> attributes;
 
@@ -124,6 +136,7 @@ namespace smtlib {
                 sptr_t<ast::AstNode> source) {
             init(name, signature, source);
             this->params.insert(this->params.begin(), params.begin(), params.end());
+            indexParams();
         }
 
         FunInfo(std::string name,
@@ -133,6 +146,7 @@ namespace smtlib {
                 sptr_t<ast::AstNode> source) : body(body) {
             init(name, signature, source);
             this->params.insert(this->params.begin(), params.begin(), params.end());
+            indexParams();
         }
 
         FunInfo(std::string name,
@@ -160,6 +174,7 @@ namespace smtlib {
             init(name, signature, source);
             this->params.insert(this->params.begin(), params.begin(), params.end());
             this->attributes.insert(this->attributes.begin(), attributes.begin(), attributes.end());
+            indexParams();
         }
 
         FunInfo(std::string name,
@@ -171,9 +186,62 @@ namespace smtlib {
             init(name, signature, source);
             this->params.insert(this->params.begin(), params.begin(), params.end());
             this->attributes.insert(this->attributes.begin(), attributes.begin(), attributes.end());
+            indexParams();
+        }
+
+        /** Checks whether the function can be applied to the given number of arguments */
+        bool acceptsArgs(unsigned long count);
+
+        /**
+         * Get the position in the signature of the expected sort of an argument, taking
+         * into account the :left-assoc, :right-assoc, :chainable and :pairwise attributes
+         * \param index    Position of the argument
+         * \param count    Number of arguments in the application
+         */
+        unsigned long getArgPosition(unsigned long index, unsigned long count);
+
+        /** Get the position in the signature of the return sort of an application with the given number of arguments */
+        unsigned long getReturnPosition(unsigned long count);
+
+        /** Get the expected sort of an argument (see getArgPosition()) */
+        inline sptr_t<ast::Sort>& getArgSort(unsigned long index, unsigned long count) {
+            return signature[getArgPosition(index, count)];
+        }
+
+        /** Get the return sort of an application with the given number of arguments */
+        inline sptr_t<ast::Sort>& getReturnSort(unsigned long count) {
+            return signature[getReturnPosition(count)];
         }
     };
 
+    /* =================================== FunOverloads =================================== */
+    /**
+     * All functions with the same name, indexed by the sort of their first argument.
+     * Functions with sort parameters or without arguments are kept apart, since
+     * they can match any first argument.
+     */
+    class FunOverloads {
+    private:
+        sptr_v<FunInfo> infos;
+        umap<size_t, std::vector<unsigned long>> byFirstArg;
+        std::vector<unsigned long> others;
+
+    public:
+        /** Get all functions, in the order in which they were added */
+        inline const sptr_v<FunInfo>& getInfos() const { return infos; }
+
+        /**
+         * Get the positions of the functions whose first argument may have the given sort,
+         * in increasing order. Functions returned by getOthers() are not included.
+         */
+        const std::vector<unsigned long>& getByFirstArg(ast::Sort* sort) const;
+
+        /** Get the positions of the functions with sort parameters or without arguments, in increasing order */
+        inline const std::vector<unsigned long>& getOthers() const { return others; }
+
+        void add(sptr_t<FunInfo> info);
+    };
+
     /* ===================================== VarInfo ====================================== */
     class VarInfo : public SymbolInfo {
     public:
@@ -0,0 +1,569 @@
+#include "ast_printer.h"
+
+#include "ast/ast_attribute.h"
+#include "ast/ast_command.h"
+#include "ast/ast_logic.h"
+#include "ast/ast_theory.h"
+#include "ast/ast_script.h"
+#include "ast/ast_sexp.h"
+#include "ast/ast_symbol_decl.h"
+#include "ast/ast_term.h"
+#include "util/global_values.h"
+
+#include <cstdio>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+void AstPrinter::flush() {
+    if (out && !buffer.empty()) {
+        out->write(buffer.data(), buffer.size());
+        buffer.clear();
+    }
+}
+
+void AstPrinter::visit0(AstNode* node) {
+    if (node == NULL || truncated) {
+        return;
+    }
+
+    if (maxLength && buffer.size() >= maxLength) {
+        truncated = true;
+        return;
+    }
+
+    if (maxDepth && depth >= maxDepth) {
+        write("[...]");
+        return;
+    }
+
+    depth++;
+    node->accept(this);
+    depth--;
+}
+
+string AstPrinter::toString(AstNode* node) {
+    AstPrinter printer;
+    printer.print(node);
+    return std::move(printer.buffer);
+}
+
+string AstPrinter::toString(AstNode* node, unsigned long maxLength, unsigned long maxDepth) {
+    AstPrinter printer(maxLength, maxDepth);
+    printer.print(node);
+
+    // The last node printed may have run past the limit
+    if (maxLength && (printer.truncated || printer.buffer.size() > maxLength)) {
+        printer.buffer.resize(maxLength);
+        printer.buffer.append("[...]");
+    }
+
+    return std::move(printer.buffer);
+}
+
+void AstPrinter::visit(Attribute* node) {
+    visit0(node->getKeyword());
+    if (node->getValue()) {
+        write(' ');
+        visit0(node->getValue());
+    }
+}
+
+void AstPrinter::visit(CompAttributeValue* node) {
+    write('(');
+    printList(node->getValues());
+    write(')');
+}
+
+void AstPrinter::visit(Symbol* node) {
+    write(node->getValue());
+}
+
+void AstPrinter::visit(Keyword* node) {
+    write(node->getValue());
+}
+
+void AstPrinter::visit(MetaSpecConstant* node) {
+    if (node->getType() == MetaSpecConstant::META_SPEC_STRING)
+        write(MSCONST_STRING);
+    else if (node->getType() == MetaSpecConstant::META_SPEC_NUMERAL)
+        write(MSCONST_NUMERAL);
+    else
+        write(MSCONST_DECIMAL);
+}
+
+void AstPrinter::visit(BooleanValue* node) {
+    write(node->getValue() ? CONST_TRUE : CONST_FALSE);
+}
+
+void AstPrinter::visit(PropLiteral* node) {
+    if (node->isNegated()) {
+        write("(not ");
+        visit0(node->getSymbol());
+        write(')');
+    } else {
+        visit0(node->getSymbol());
+    }
+}
+
+void AstPrinter::visit(AssertCommand* node) {
+    write("(assert ");
+    visit0(node->getTerm());
+    write(')');
+}
+
+void AstPrinter::visit(CheckSatCommand* node) {
+    write("(check-sat)");
+}
+
+void AstPrinter::visit(CheckSatAssumCommand* node) {
+    write("(check-sat-assuming (");
+    printList(node->getAssumptions());
+    write("))");
+}
+
+void AstPrinter::visit(DeclareConstCommand* node) {
+    write("(declare-const ");
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getSort());
+    write(')');
+}
+
+void AstPrinter::visit(DeclareDatatypeCommand* node) {
+    write("(declare-datatype ");
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getDeclaration());
+    write(')');
+}
+
+void AstPrinter::visit(DeclareDatatypesCommand* node) {
+    write("( declare-datatypes (");
+    printList(node->getSorts());
+    write(") (");
+    printList(node->getDeclarations());
+}
+
+void AstPrinter::visit(DeclareFunCommand* node) {
+    write("(declare-fun ");
+    visit0(node->getSymbol());
+    write(" (");
+    printList(node->getParams());
+    write(") ");
+    visit0(node->getSort());
+    write(')');
+}
+
+void AstPrinter::visit(DeclareSortCommand* node) {
+    write("(declare-sort ");
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getArity());
+    write(')');
+}
+
+void AstPrinter::visit(DefineFunCommand* node) {
+    write("(define-fun ");
+    visit0(node->getDefinition());
+    write(')');
+}
+
+void AstPrinter::visit(DefineFunRecCommand* node) {
+    write("(define-fun-rec ");
+    visit0(node->getDefinition());
+    write(')');
+}
+
+void AstPrinter::visit(DefineFunsRecCommand* node) {
+    write("(define-funs-rec (");
+    printParenList(node->getDeclarations());
+    write(") (");
+    printParenList(node->getBodies());
+    write("))");
+}
+
+void AstPrinter::visit(DefineSortCommand* node) {
+    write("(define-sort ");
+    visit0(node->getSymbol());
+    write(" (");
+    printList(node->getParams());
+    write(") ");
+    visit0(node->getSort());
+    write(')');
+}
+
+void AstPrinter::visit(EchoCommand* node) {
+    write("(echo ");
+    write(node->getMessage());
+    write(')');
+}
+
+void AstPrinter::visit(ExitCommand* node) {
+    write("(exit)");
+}
+
+void AstPrinter::visit(GetAssertsCommand* node) {
+    write("(get-assertions)");
+}
+
+void AstPrinter::visit(GetAssignsCommand* node) {
+    write("(get-assignments)");
+}
+
+void AstPrinter::visit(GetInfoCommand* node) {
+    write("(get-info ");
+    visit0(node->getFlag());
+    write(')');
+}
+
+void AstPrinter::visit(GetModelCommand* node) {
+    write("(get-model)");
+}
+
+void AstPrinter::visit(GetOptionCommand* node) {
+    write("(get-option ");
+    visit0(node->getOption());
+    write(')');
+}
+
+void AstPrinter::visit(GetProofCommand* node) {
+    write("(get-proof)");
+}
+
+void AstPrinter::visit(GetUnsatAssumsCommand* node) {
+    write("(get-unsat-assumptions)");
+}
+
+void AstPrinter::visit(GetUnsatCoreCommand* node) {
+    write("(get-unsat-core)");
+}
+
+void AstPrinter::visit(GetValueCommand* node) {
+    write("(get-value (");
+    printList(node->getTerms());
+    write("))");
+}
+
+void AstPrinter::visit(PopCommand* node) {
+    write("(pop ");
+    visit0(node->getNumeral());
+    write(')');
+}
+
+void AstPrinter::visit(PushCommand* node) {
+    write("(push ");
+    visit0(node->getNumeral());
+    write(')');
+}
+
+void AstPrinter::visit(ResetCommand* node) {
+    write("(reset)");
+}
+
+void AstPrinter::visit(ResetAssertsCommand* node) {
+    write("(reset-assertions)");
+}
+
+void AstPrinter::visit(SetInfoCommand* node) {
+    write("(set-info ");
+    visit0(node->getInfo()->getKeyword());
+    write(' ');
+    visit0(node->getInfo()->getValue());
+    write(')');
+}
+
+void AstPrinter::visit(SetLogicCommand* node) {
+    write("(set-logic ");
+    visit0(node->getLogic());
+    write(')');
+}
+
+void AstPrinter::visit(SetOptionCommand* node) {
+    write("(set-option ");
+    visit0(node->getOption()->getKeyword());
+    write(' ');
+    visit0(node->getOption()->getValue());
+    write(')');
+}
+
+void AstPrinter::visit(FunctionDeclaration* node) {
+    visit0(node->getSymbol());
+    write(" (");
+    printParenList(node->getParams());
+    write(") ");
+    visit0(node->getSort());
+}
+
+void AstPrinter::visit(FunctionDefinition* node) {
+    visit0(node->getSignature());
+    write(' ');
+    visit0(node->getBody());
+}
+
+void AstPrinter::visit(SimpleIdentifier* node) {
+    if (!node->isIndexed()) {
+        visit0(node->getSymbol());
+    } else {
+        write("( _ ");
+        visit0(node->getSymbol());
+        write(' ');
+        printList(node->getIndices());
+        write(')');
+    }
+}
+
+void AstPrinter::visit(QualifiedIdentifier* node) {
+    write("(as ");
+    visit0(node->getIdentifier());
+    write(' ');
+    visit0(node->getSort());
+    write(')');
+}
+
+void AstPrinter::visit(DecimalLiteral* node) {
+    // Same format as the default output of a double on a stream
+    char str[32];
+    snprintf(str, sizeof(str), "%g", node->getValue());
+    write(str);
+}
+
+void AstPrinter::visit(NumeralLiteral* node) {
+    long value = node->getValue();
+    char str[72];
+
+    if (node->getBase() == 2 || node->getBase() == 16) {
+        unsigned long bits = (unsigned long) value;
+        unsigned int shift = node->getBase() == 2 ? 1 : 4;
+        char* digit = str + sizeof(str) - 1;
+        *digit = '\0';
+        do {
+            *(--digit) = "0123456789abcdef"[bits & (node->getBase() - 1)];
+            bits >>= shift;
+        } while (bits != 0);
+
+        write(node->getBase() == 2 ? "#b" : "#x");
+
+        // Leading zeros give the width of the literal
+        unsigned long length = (unsigned long) (str + sizeof(str) - 1 - digit);
+        for (unsigned long i = length; i < node->getDigits(); i++) {
+            write('0');
+        }
+        write(digit);
+    } else {
+        snprintf(str, sizeof(str), "%ld", value);
+        write(str);
+    }
+}
+
+void AstPrinter::visit(StringLiteral* node) {
+    write(node->getValue());
+}
+
+void AstPrinter::visit(Logic* node) {
+    write("(logic  ");
+    visit0(node->getName());
+    write(' ');
+    printList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(Theory* node) {
+    write("(theory  ");
+    visit0(node->getName());
+    write(' ');
+    printList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(Script* node) {
+    sptr_v<Command>& commands = node->getCommands();
+    for (auto commandIt = commands.begin(); commandIt != commands.end() && !truncated; commandIt++) {
+        visit0(*commandIt);
+        write('\n');
+    }
+}
+
+void AstPrinter::visit(Sort* node) {
+    if (!node->hasArgs()) {
+        visit0(node->getIdentifier());
+    } else {
+        write('(');
+        visit0(node->getIdentifier());
+        write(' ');
+        printList(node->getArgs());
+        write(')');
+    }
+}
+
+void AstPrinter::visit(CompSExpression* node) {
+    write('(');
+    printList(node->getExpressions());
+    write(')');
+}
+
+void AstPrinter::visit(SortSymbolDeclaration* node) {
+    write('(');
+    visit0(node->getIdentifier());
+    write(' ');
+    visit0(node->getArity());
+    printTrailingList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(SpecConstFunDeclaration* node) {
+    write('(');
+    visit0(node->getConstant());
+    write(' ');
+    visit0(node->getSort());
+    printTrailingList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(MetaSpecConstFunDeclaration* node) {
+    write('(');
+    visit0(node->getConstant());
+    write(' ');
+    visit0(node->getSort());
+    printTrailingList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(SimpleFunDeclaration* node) {
+    write('(');
+    visit0(node->getIdentifier());
+    printTrailingList(node->getSignature());
+    printTrailingList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(ParametricFunDeclaration* node) {
+    write("(par (");
+    printList(node->getParams());
+    write(") (");
+    visit0(node->getIdentifier());
+    printTrailingList(node->getSignature());
+    printTrailingList(node->getAttributes());
+    write("))");
+}
+
+void AstPrinter::visit(SortDeclaration* node) {
+    write('(');
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getArity());
+    write(')');
+}
+
+void AstPrinter::visit(SelectorDeclaration* node) {
+    write('(');
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getSort());
+    write(')');
+}
+
+void AstPrinter::visit(ConstructorDeclaration* node) {
+    write('(');
+    visit0(node->getSymbol());
+    printTrailingList(node->getSelectors());
+    write(')');
+}
+
+void AstPrinter::visit(SimpleDatatypeDeclaration* node) {
+    write('(');
+    printList(node->getConstructors());
+    write(')');
+}
+
+void AstPrinter::visit(ParametricDatatypeDeclaration* node) {
+    write("(par (");
+    printList(node->getParams());
+    write(") (");
+    printList(node->getConstructors());
+    write("))");
+}
+
+void AstPrinter::visit(QualifiedConstructor* node) {
+    write("(as ");
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getSort());
+    write(')');
+}
+
+void AstPrinter::visit(QualifiedPattern* node) {
+    write('(');
+    visit0(node->getConstructor());
+    printTrailingList(node->getSymbols());
+    write(')');
+}
+
+void AstPrinter::visit(MatchCase* node) {
+    write('(');
+    visit0(node->getPattern());
+    write(' ');
+    visit0(node->getTerm());
+    write(')');
+}
+
+void AstPrinter::visit(QualifiedTerm* node) {
+    write('(');
+    visit0(node->getIdentifier());
+    write(' ');
+    printList(node->getTerms());
+    write(')');
+}
+
+void AstPrinter::visit(LetTerm* node) {
+    write("(let (");
+    printParenList(node->getBindings());
+    write(") ");
+    visit0(node->getTerm());
+    write(')');
+}
+
+void AstPrinter::visit(ForallTerm* node) {
+    write("(forall (");
+    printParenList(node->getBindings());
+    write(") ");
+    visit0(node->getTerm());
+    write(')');
+}
+
+void AstPrinter::visit(ExistsTerm* node) {
+    write("(exists (");
+    printParenList(node->getBindings());
+    write(") ");
+    visit0(node->getTerm());
+    write(')');
+}
+
+void AstPrinter::visit(MatchTerm* node) {
+    write("(match ");
+    visit0(node->getTerm());
+    printTrailingList(node->getCases());
+    write(')');
+}
+
+void AstPrinter::visit(AnnotatedTerm* node) {
+    write("( ! ");
+    visit0(node->getTerm());
+    write(' ');
+    printList(node->getAttributes());
+    write(')');
+}
+
+void AstPrinter::visit(SortedVariable* node) {
+    visit0(node->getSymbol());
+    write(' ');
+    visit0(node->getSort());
+}
+
+void AstPrinter::visit(VarBinding* node) {
+    visit0(node->getSymbol());
+    write(" (");
+    visit0(node->getTerm());
+    write(')');
+}
@@ -0,0 +1,225 @@
+/**
+ * \file ast_printer.h
+ * \brief Visitor for printing the SMT-LIB AST.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_AST_PRINTER_H
+#define SMTLIB_PARSER_AST_PRINTER_H
+
+#include "ast_visitor.h"
+
+#include <ostream>
+#include <string>
+
+namespace smtlib {
+    namespace ast {
+        /**
+         * Visitor that prints nodes in SMT-LIB syntax, in a single pass.
+         * Output is appended to an internal buffer, which is either returned as a
+         * string or flushed to an output stream whenever it grows past a fixed size.
+         * A printer can be bounded in length (it stops visiting nodes once the buffer
+         * reaches the limit) and in depth (deeper subtrees are printed as "[...]"),
+         * so that diagnostics on huge terms cost time proportional to the limits.
+         */
+        class AstPrinter : public virtual AstVisitor0 {
+        private:
+            /** Buffer size after which the buffer is flushed to the output stream */
+            static const size_t FLUSH_SIZE = 1 << 16;
+
+            std::ostream* out;
+            std::string buffer;
+
+            unsigned long maxLength;
+            unsigned long maxDepth;
+            unsigned long depth;
+            bool truncated;
+
+            inline void write(const std::string& str) {
+                buffer.append(str);
+                if (out && buffer.size() >= FLUSH_SIZE)
+                    flush();
+            }
+
+            inline void write(const char* str) {
+                buffer.append(str);
+            }
+
+            inline void write(char c) {
+                buffer.push_back(c);
+            }
+
+            /** Print the nodes in a list, separated by spaces */
+            template<class T>
+            void printList(sptr_v<T>& nodes) {
+                for (auto nodeIt = nodes.begin(); nodeIt != nodes.end() && !truncated; nodeIt++) {
+                    if (nodeIt != nodes.begin())
+                        write(' ');
+                    visit0(*nodeIt);
+                }
+            }
+
+            /** Print the nodes in a list, each in parentheses, separated by spaces */
+            template<class T>
+            void printParenList(sptr_v<T>& nodes) {
+                for (auto nodeIt = nodes.begin(); nodeIt != nodes.end() && !truncated; nodeIt++) {
+                    if (nodeIt != nodes.begin())
+                        write(' ');
+                    write('(');
+                    visit0(*nodeIt);
+                    write(')');
+                }
+            }
+
+            /** Print the nodes in a list, each preceded by a space */
+            template<class T>
+            void printTrailingList(sptr_v<T>& nodes) {
+                for (auto nodeIt = nodes.begin(); nodeIt != nodes.end() && !truncated; nodeIt++) {
+                    write(' ');
+                    visit0(*nodeIt);
+                }
+            }
+
+        protected:
+            /** Visit a node, unless one of the limits has been reached */
+            virtual void visit0(AstNode* node);
+
+            using AstVisitor0::visit0;
+
+        public:
+            /** Printer whose output is collected in its buffer */
+            inline AstPrinter() : out(NULL), maxLength(0), maxDepth(0), depth(0), truncated(false) { }
+
+            /** Printer whose output is written to a stream */
+            inline AstPrinter(std::ostream& out)
+                    : out(&out), maxLength(0), maxDepth(0), depth(0), truncated(false) { }
+
+            /**
+             * Printer whose output is collected in its buffer and is bounded
+             * \param maxLength Number of characters after which printing stops (0 for no limit)
+             * \param maxDepth  Nesting depth below which subtrees are elided (0 for no limit)
+             */
+            inline AstPrinter(unsigned long maxLength, unsigned long maxDepth)
+                    : out(NULL), maxLength(maxLength), maxDepth(maxDepth), depth(0), truncated(false) { }
+
+            inline ~AstPrinter() {
+                flush();
+            }
+
+            /** Print a node */
+            inline void print(AstNode* node) {
+                visit0(node);
+            }
+
+            template<class T>
+            inline void print(const sptr_t<T>& node) {
+                visit0(node.get());
+            }
+
+            /** Write the contents of the buffer to the output stream, if there is one */
+            void flush();
+
+            /** Get the printed text not yet flushed to the output stream */
+            inline std::string& getBuffer() { return buffer; }
+
+            /** Whether printing stopped because the length limit was reached */
+            inline bool isTruncated() { return truncated; }
+
+            /** Get the SMT-LIB representation of a node */
+            static std::string toString(AstNode* node);
+
+            /**
+             * Get the SMT-LIB representation of a node, cut to at most maxLength characters
+             * (followed by "[...]" if anything was left out) and with the subtrees deeper
+             * than maxDepth elided. Zero means no limit.
+             */
+            static std::string toString(AstNode* node, unsigned long maxLength, unsigned long maxDepth = 0);
+
+            virtual void visit(Attribute* node);
+            virtual void visit(CompAttributeValue* node);
+
+            virtual void visit(Symbol* node);
+            virtual void visit(Keyword* node);
+            virtual void visit(MetaSpecConstant* node);
+            virtual void visit(BooleanValue* node);
+            virtual void visit(PropLiteral* node);
+
+            virtual void visit(AssertCommand* node);
+            virtual void visit(CheckSatCommand* node);
+            virtual void visit(CheckSatAssumCommand* node);
+            virtual void visit(DeclareConstCommand* node);
+            virtual void visit(DeclareDatatypeCommand* node);
+            virtual void visit(DeclareDatatypesCommand* node);
+            virtual void visit(DeclareFunCommand* node);
+            virtual void visit(DeclareSortCommand* node);
+            virtual void visit(DefineFunCommand* node);
+            virtual void visit(DefineFunRecCommand* node);
+            virtual void visit(DefineFunsRecCommand* node);
+            virtual void visit(DefineSortCommand* node);
+            virtual void visit(EchoCommand* node);
+            virtual void visit(ExitCommand* node);
+            virtual void visit(GetAssertsCommand* node);
+            virtual void visit(GetAssignsCommand* node);
+            virtual void visit(GetInfoCommand* node);
+            virtual void visit(GetModelCommand* node);
+            virtual void visit(GetOptionCommand* node);
+            virtual void visit(GetProofCommand* node);
+            virtual void visit(GetUnsatAssumsCommand* node);
+            virtual void visit(GetUnsatCoreCommand* node);
+            virtual void visit(GetValueCommand* node);
+            virtual void visit(PopCommand* node);
+            virtual void visit(PushCommand* node);
+            virtual void visit(ResetCommand* node);
+            virtual void visit(ResetAssertsCommand* node);
+            virtual void visit(SetInfoCommand* node);
+            virtual void visit(SetLogicCommand* node);
+            virtual void visit(SetOptionCommand* node);
+
+            virtual void visit(FunctionDeclaration* node);
+            virtual void visit(FunctionDefinition* node);
+
+            virtual void visit(SimpleIdentifier* node);
+            virtual void visit(QualifiedIdentifier* node);
+
+            virtual void visit(DecimalLiteral* node);
+            virtual void visit(NumeralLiteral* node);
+            virtual void visit(StringLiteral* node);
+
+            virtual void visit(Logic* node);
+            virtual void visit(Theory* node);
+            virtual void visit(Script* node);
+
+            virtual void visit(Sort* node);
+
+            virtual void visit(CompSExpression* node);
+
+            virtual void visit(SortSymbolDeclaration* node);
+            virtual void visit(SpecConstFunDeclaration* node);
+            virtual void visit(MetaSpecConstFunDeclaration* node);
+            virtual void visit(SimpleFunDeclaration* node);
+            virtual void visit(ParametricFunDeclaration* node);
+
+            virtual void visit(SortDeclaration* node);
+            virtual void visit(SelectorDeclaration* node);
+            virtual void visit(ConstructorDeclaration* node);
+            virtual void visit(SimpleDatatypeDeclaration* node);
+            virtual void visit(ParametricDatatypeDeclaration* node);
+
+            virtual void visit(QualifiedConstructor* node);
+            virtual void visit(QualifiedPattern* node);
+            virtual void visit(MatchCase* node);
+
+            virtual void visit(QualifiedTerm* node);
+            virtual void visit(LetTerm* node);
+            virtual void visit(ForallTerm* node);
+            virtual void visit(ExistsTerm* node);
+            virtual void visit(MatchTerm* node);
+            virtual void visit(AnnotatedTerm* node);
+
+            virtual void visit(SortedVariable* node);
+            virtual void visit(VarBinding* node);
+        };
+    }
+}
+
+#endif //SMTLIB_PARSER_AST_PRINTER_H
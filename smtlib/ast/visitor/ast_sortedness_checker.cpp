@@ -1,4 +1,5 @@
 #include "ast_sortedness_checker.h"
+#include "ast_printer.h"
 #include "ast_syntax_checker.h"
 #include "ast/ast_logic.h"
 #include "ast/ast_script.h"
@@ -6,6 +7,8 @@
 #include "smtlib/parser/smtlib_parser.h"
 #include "util/error_messages.h"
 #include "util/global_values.h"
+#include "util/stats.h"
+#include "util/thread_pool.h"
 #include "exec/execution.h"
 
 using namespace std;
@@ -22,6 +25,9 @@ SortednessCheckerContext::SortednessCheckerContext() {
 SortednessCheckerContext::SortednessCheckerContext(sptr_t<SymbolStack> stack)
         : stack(stack) { }
 
+SortednessCheckerContext::SortednessCheckerContext(sptr_t<SymbolStack> stack, sptr_t<Configuration> config)
+        : stack(stack), config(config) { }
+
 sptr_t<SymbolStack> SortednessCheckerContext::getStack() {
     return stack;
 }
@@ -42,99 +48,240 @@ void SortednessCheckerContext::setCurrentLogic(string logic) {
     currentLogic = logic;
 }
 
+sptr_t<TheoryDeclarationLoader> SortednessCheckerContext::getTheoryLoader() {
+    if (!theoryLoader)
+        theoryLoader = make_shared<TheoryDeclarationLoader>(config);
+    return theoryLoader;
+}
+
+/* ============================= TheoryDeclarationLoader ============================== */
+
+void TheoryDeclarationLoader::WeakLoader::load(const string& name, sptr_t<AstNode> declaration,
+                                               sptr_v<SortInfo>& sorts, sptr_v<FunInfo>& funs) {
+    if (sptr_t<TheoryDeclarationLoader> target = loader.lock()) {
+        const Symbols& declared = target->check(name, declaration);
+        sorts = declared.sorts;
+        funs = declared.funs;
+    }
+}
+
+TheoryDeclarationLoader::TheoryDeclarationLoader(sptr_t<Configuration> config)
+        : stack(make_shared<SymbolStack>()), config(config) { }
+
+void TheoryDeclarationLoader::enableBuiltins(const string& theory) {
+    lock_guard<recursive_mutex> lock(mutex);
+    stack->enableBuiltins(theory);
+}
+
+void TheoryDeclarationLoader::addPendingSort(sptr_t<SymbolStack> stack, const string& name,
+                                             sptr_t<AstNode> declaration) {
+    lock_guard<recursive_mutex> lock(mutex);
+    if (!weakLoader)
+        weakLoader = make_shared<WeakLoader>(shared_from_this());
+
+    stack->addPendingSort(name, declaration, shared_from_this());
+    this->stack->addPendingSort(name, declaration, weakLoader);
+}
+
+void TheoryDeclarationLoader::addPendingFun(sptr_t<SymbolStack> stack, const string& name,
+                                            sptr_t<AstNode> declaration) {
+    lock_guard<recursive_mutex> lock(mutex);
+    if (!weakLoader)
+        weakLoader = make_shared<WeakLoader>(shared_from_this());
+
+    stack->addPendingFun(name, declaration, shared_from_this());
+    this->stack->addPendingFun(name, declaration, weakLoader);
+}
+
+void TheoryDeclarationLoader::load(const string& name, sptr_t<AstNode> declaration,
+                                   sptr_v<SortInfo>& sorts, sptr_v<FunInfo>& funs) {
+    lock_guard<recursive_mutex> lock(mutex);
+
+    // Check all the declarations of the name in the order in which they were kept aside,
+    // so that the same ones are found to be duplicates, whichever stack loads them first
+    if (symbols.find(declaration) == symbols.end()) {
+        if (dynamic_cast<SortSymbolDeclaration*>(declaration.get()))
+            stack->getSortInfo(name);
+        else
+            stack->getFunOverloads(name);
+    }
+
+    const Symbols& declared = check(name, declaration);
+    sorts = declared.sorts;
+    funs = declared.funs;
+}
+
+const TheoryDeclarationLoader::Symbols& TheoryDeclarationLoader::check(const string& name,
+                                                                       sptr_t<AstNode> declaration) {
+    lock_guard<recursive_mutex> lock(mutex);
+
+    // The entry is there while the declaration is checked, so that looking up its own name gives nothing
+    auto inserted = symbols.insert(make_pair(declaration, Symbols()));
+    Symbols& declared = inserted.first->second;
+
+    if (inserted.second) {
+        sptr_t<SortednessChecker> chk =
+                make_shared<SortednessChecker>(make_shared<SortednessCheckerContext>(stack, config));
+        if (!chk->check(declaration)) {
+            if (declaration->getFilename()) {
+                Logger::sortednessError("TheoryDeclarationLoader::load()",
+                                        declaration->getFilename()->c_str(), chk->getErrors().c_str());
+            } else {
+                Logger::sortednessError("TheoryDeclarationLoader::load()", chk->getErrors().c_str());
+            }
+        }
+
+        // Keep the symbols the check has added for this declaration
+        sptr_t<SortInfo> sortInfo = stack->getSortInfo(name);
+        if (sortInfo && sortInfo->source == declaration)
+            declared.sorts.push_back(sortInfo);
+
+        const sptr_v<FunInfo>& funInfos = stack->getFunOverloads(name).getInfos();
+        for (auto infoIt = funInfos.begin(); infoIt != funInfos.end(); infoIt++) {
+            if ((*infoIt)->source == declaration)
+                declared.funs.push_back(*infoIt);
+        }
+    }
+
+    return declared;
+}
+
 /* ================================ SortednessChecker ================================= */
 
+// Runs are split among at most one task for every this many commands, so that
+// taking a snapshot and handing it over to a worker is worth it
+static const unsigned long MIN_TASK_COMMANDS = 32;
+
+// Runs are split into this many parts for each task, so that a task that is done
+// early can take over parts from slower ones
+static const unsigned long PARTS_PER_TASK = 8;
+
+void SortednessChecker::keepError(sptr_t<NodeError> err, AstNode* node) {
+    if (!isErrorLimitReached()) {
+        if (node && node->getFilename())
+            errors[*node->getFilename()].push_back(err);
+        else
+            errors[""].push_back(err);
+
+        err->kept = true;
+        for (auto errIt = err->errs.begin(); errIt != err->errs.end(); errIt++) {
+            report(*errIt, node);
+        }
+    }
+
+    errorCount++;
+}
+
+void SortednessChecker::report(sptr_t<Error> err, AstNode* node) {
+    if (!diagnostics)
+        return;
+
+    if (holdingDiagnostics) {
+        heldDiagnostics.push_back(make_pair(err, node));
+        return;
+    }
+
+    if (node) {
+        diagnostics->write(err->code, node->getFilename(), node->getRowLeft(), node->getColLeft(),
+                           node->getRowRight(), node->getColRight(), err->message());
+    } else {
+        diagnostics->write(err->code, NULL, 0, 0, 0, 0, err->message());
+    }
+}
+
+void SortednessChecker::writeHeldDiagnostics() {
+    holdingDiagnostics = false;
+    for (auto heldIt = heldDiagnostics.begin(); heldIt != heldDiagnostics.end(); heldIt++) {
+        report(heldIt->first, heldIt->second);
+    }
+    heldDiagnostics.clear();
+}
+
 sptr_t<SortednessChecker::NodeError>
-SortednessChecker::addError(string message, sptr_t<AstNode> node,
+SortednessChecker::addError(ErrorCode code, MessageBuilder message, AstNode* node,
                             sptr_t<SortednessChecker::NodeError> err) {
+    sptr_t<Error> errInfo = make_shared<Error>(code, message);
     if (!err) {
-        sptr_t<Error> errInfo =
-                make_shared<Error>(message);
         err = make_shared<NodeError>(errInfo, node);
-        if (node && node->getFilename())
-            errors[string(node->getFilename()->c_str())].push_back(err);
-        else
-            errors[""].push_back(err);
+        keepError(err, node);
     } else {
-        sptr_t<Error> errInfo =
-                make_shared<Error>(message);
         err->errs.push_back(errInfo);
+        if (err->kept)
+            report(errInfo, err->node);
     }
 
     return err;
 }
 
 sptr_t<SortednessChecker::NodeError>
-SortednessChecker::addError(string message, sptr_t<AstNode> node,
+SortednessChecker::addError(ErrorCode code, MessageBuilder message, AstNode* node,
                             sptr_t<SymbolInfo> info,
                             sptr_t<SortednessChecker::NodeError> err) {
+    sptr_t<Error> errInfo = make_shared<Error>(code, message, info);
     if (!err) {
-        sptr_t<Error> errInfo =
-                make_shared<Error>(message, info);
         err = make_shared<NodeError>(errInfo, node);
-        if (node && node->getFilename())
-            errors[string(node->getFilename()->c_str())].push_back(err);
-        else
-            errors[""].push_back(err);
+        keepError(err, node);
     } else {
-        sptr_t<Error> errInfo =
-                make_shared<Error>(message, info);
         err->errs.push_back(errInfo);
+        if (err->kept)
+            report(errInfo, err->node);
     }
 
     return err;
 }
 
-void SortednessChecker::addError(string message, sptr_t<AstNode> node) {
-    sptr_t<Error> errInfo =
-            make_shared<Error>(message);
-    sptr_t<NodeError> err =
-            make_shared<NodeError>(errInfo, node);
-    if (node && node->getFilename())
-        errors[string(node->getFilename()->c_str())].push_back(err);
-    else
-        errors[""].push_back(err);
+void SortednessChecker::addError(ErrorCode code, MessageBuilder message, AstNode* node) {
+    keepError(make_shared<NodeError>(make_shared<Error>(code, message), node), node);
 }
 
-void SortednessChecker::addError(string message, sptr_t<AstNode> node,
+void SortednessChecker::addError(ErrorCode code, MessageBuilder message, AstNode* node,
                                  sptr_t<SymbolInfo> info) {
-    sptr_t<Error> errInfo =
-            make_shared<Error>(message, info);
-    sptr_t<NodeError> err =
-            make_shared<NodeError>(errInfo, node);
-    errors[string(node->getFilename()->c_str())].push_back(err);
+    keepError(make_shared<NodeError>(make_shared<Error>(code, message, info), node), node);
+}
+
+void SortednessChecker::addErrors(sptr_t<SortednessChecker> other) {
+    unsigned long kept = 0;
+    for (auto errIt = other->errors.begin(); errIt != other->errors.end(); errIt++) {
+        for (auto nodeErrIt = errIt->second.begin(); nodeErrIt != errIt->second.end(); nodeErrIt++) {
+            keepError(*nodeErrIt, (*nodeErrIt)->node);
+            kept++;
+        }
+    }
+
+    // Errors the other checker found but did not keep
+    errorCount += other->errorCount - kept;
 }
 
-sptr_t<SortInfo> SortednessChecker::getInfo(sptr_t<DeclareSortCommand> node) {
-    return make_shared<SortInfo>(node->getSymbol()->toString(), node->getArity()->getValue(), node);
+sptr_t<SortInfo> SortednessChecker::getInfo(DeclareSortCommand* node) {
+    return make_shared<SortInfo>(node->getSymbol()->toString(), node->getArity()->getValue(), node->shared_from_this());
 }
 
-sptr_t<SortInfo> SortednessChecker::getInfo(sptr_t<DefineSortCommand> node) {
+sptr_t<SortInfo> SortednessChecker::getInfo(DefineSortCommand* node) {
     return make_shared<SortInfo>(node->getSymbol()->toString(), node->getParams().size(),
-                                 node->getParams(), ctx->getStack()->expand(node->getSort()), node);
+                                 node->getParams(), ctx->getStack()->expand(node->getSort()), node->shared_from_this());
 }
 
 
-sptr_t<SortInfo> SortednessChecker::getInfo(sptr_t<SortSymbolDeclaration> node) {
+sptr_t<SortInfo> SortednessChecker::getInfo(SortSymbolDeclaration* node) {
     return make_shared<SortInfo>(node->getIdentifier()->toString(),
                                  node->getArity()->getValue(),
-                                 node->getAttributes(), node);
+                                 node->getAttributes(), node->shared_from_this());
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<SpecConstFunDeclaration> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(SpecConstFunDeclaration* node) {
     sptr_v<Sort> sig;
     sig.push_back(ctx->getStack()->expand(node->getSort()));
 
-    return make_shared<FunInfo>(node->getConstant()->toString(), sig, node->getAttributes(), node);
+    return make_shared<FunInfo>(node->getConstant()->toString(), sig, node->getAttributes(), node->shared_from_this());
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<MetaSpecConstFunDeclaration> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(MetaSpecConstFunDeclaration* node) {
     sptr_v<Sort> sig;
     sig.push_back(ctx->getStack()->expand(node->getSort()));
-    return make_shared<FunInfo>(node->getConstant()->toString(), sig, node->getAttributes(), node);
+    return make_shared<FunInfo>(node->getConstant()->toString(), sig, node->getAttributes(), node->shared_from_this());
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<SimpleFunDeclaration> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(SimpleFunDeclaration* node) {
     sptr_v<Sort> &sig = node->getSignature();
     sptr_v<Sort> newsig;
 
@@ -143,7 +290,7 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<SimpleFunDeclaration> node) {
     }
 
     sptr_t<FunInfo> funInfo = make_shared<FunInfo>(node->getIdentifier()->toString(), newsig,
-                                                       node->getAttributes(), node);
+                                                       node->getAttributes(), node->shared_from_this());
 
     sptr_v<Attribute> attrs = node->getAttributes();
     for (auto attr = attrs.begin(); attr != attrs.end(); attr++) {
@@ -167,7 +314,7 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<SimpleFunDeclaration> node) {
     return funInfo;
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<ParametricFunDeclaration> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(ParametricFunDeclaration* node) {
     sptr_v<Sort> &sig = node->getSignature();
     sptr_v<Sort> newsig;
 
@@ -176,7 +323,8 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<ParametricFunDeclaration> node
     }
 
     sptr_t<FunInfo> funInfo = make_shared<FunInfo>(node->getIdentifier()->toString(), newsig,
-                                                       node->getParams(), node->getAttributes(), node);
+                                                       node->getParams(), node->getAttributes(),
+                                                       node->shared_from_this());
 
     sptr_v<Attribute> attrs = node->getAttributes();
     for (auto attr = attrs.begin(); attr != attrs.end(); attr++) {
@@ -200,14 +348,14 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<ParametricFunDeclaration> node
     return funInfo;
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DeclareConstCommand> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(DeclareConstCommand* node) {
     sptr_v<Sort> sig;
     sig.push_back(ctx->getStack()->expand(node->getSort()));
 
-    return make_shared<FunInfo>(node->getSymbol()->toString(), sig, node);
+    return make_shared<FunInfo>(node->getSymbol()->toString(), sig, node->shared_from_this());
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DeclareFunCommand> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(DeclareFunCommand* node) {
     sptr_v<Sort> &sig = node->getParams();
     sptr_v<Sort> newsig;
 
@@ -218,10 +366,10 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DeclareFunCommand> node) {
     sptr_t<Sort> retsort = ctx->getStack()->expand(node->getSort());
     newsig.push_back(retsort);
 
-    return make_shared<FunInfo>(node->getSymbol()->toString(), newsig, node);
+    return make_shared<FunInfo>(node->getSymbol()->toString(), newsig, node->shared_from_this());
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DefineFunCommand> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(DefineFunCommand* node) {
     sptr_v<Sort> newsig;
     sptr_v<SortedVariable> &params = node->getDefinition()->getSignature()->getParams();
     for (auto paramIt = params.begin(); paramIt != params.end(); paramIt++) {
@@ -230,10 +378,10 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DefineFunCommand> node) {
     newsig.push_back(ctx->getStack()->expand(node->getDefinition()->getSignature()->getSort()));
 
     return make_shared<FunInfo>(node->getDefinition()->getSignature()->getSymbol()->toString(),
-                                newsig, node->getDefinition()->getBody(), node);
+                                newsig, node->getDefinition()->getBody(), node->shared_from_this());
 }
 
-sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DefineFunRecCommand> node) {
+sptr_t<FunInfo> SortednessChecker::getInfo(DefineFunRecCommand* node) {
     sptr_v<Sort> newsig;
     sptr_v<SortedVariable> &params = node->getDefinition()->getSignature()->getParams();
     for (auto paramIt = params.begin(); paramIt != params.end(); paramIt++) {
@@ -242,10 +390,10 @@ sptr_t<FunInfo> SortednessChecker::getInfo(sptr_t<DefineFunRecCommand> node) {
     newsig.push_back(ctx->getStack()->expand(node->getDefinition()->getSignature()->getSort()));
 
     return make_shared<FunInfo>(node->getDefinition()->getSignature()->getSymbol()->toString(),
-                                newsig, node->getDefinition()->getBody(), node);
+                                newsig, node->getDefinition()->getBody(), node->shared_from_this());
 }
 
-sptr_v<FunInfo> SortednessChecker::getInfo(sptr_t<DefineFunsRecCommand> node) {
+sptr_v<FunInfo> SortednessChecker::getInfo(DefineFunsRecCommand* node) {
     sptr_v<FunInfo> infos;
     for (unsigned long i = 0; i < node->getDeclarations().size(); i++) {
         sptr_v<Sort> newsig;
@@ -256,13 +404,13 @@ sptr_v<FunInfo> SortednessChecker::getInfo(sptr_t<DefineFunsRecCommand> node) {
         newsig.push_back(ctx->getStack()->expand(node->getDeclarations()[i]->getSort()));
 
         infos.push_back(make_shared<FunInfo>(node->getDeclarations()[i]->getSymbol()->toString(),
-                                             newsig, node->getBodies()[i], node));
+                                             newsig, node->getBodies()[i], node->shared_from_this()));
     }
 
     return infos;
 }
 
-sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypeCommand> node) {
+sptr_v<SymbolInfo> SortednessChecker::getInfo(DeclareDatatypeCommand* node) {
     sptr_v<SymbolInfo> infos;
     string typeName = node->getSymbol()->toString();
 
@@ -271,7 +419,7 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypeCommand> nod
 
     if (pdecl) {
         // Add datatype (parametric) sort info
-        infos.push_back(make_shared<SortInfo>(typeName, pdecl->getParams().size(), node));
+        infos.push_back(make_shared<SortInfo>(typeName, pdecl->getParams().size(), node->shared_from_this()));
 
         // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
         sptr_t<Sort> typeSort = make_shared<Sort>(make_shared<SimpleIdentifier>(node->getSymbol()));
@@ -301,17 +449,17 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypeCommand> nod
                 selSig.push_back(ctx->getStack()->expand((*selIt)->getSort()));
 
                 // Add selector function info
-                infos.push_back(make_shared<FunInfo>(selName, selSig, pdecl->getParams(), node));
+                infos.push_back(make_shared<FunInfo>(selName, selSig, pdecl->getParams(), node->shared_from_this()));
             }
 
             // Add constructor function info
             consSig.push_back(typeSort);
-            infos.push_back(make_shared<FunInfo>(consName, consSig, pdecl->getParams(), node));
+            infos.push_back(make_shared<FunInfo>(consName, consSig, pdecl->getParams(), node->shared_from_this()));
         }
 
     } else {
         // Add datatype (non-parametric) sort info
-        infos.push_back(make_shared<SortInfo>(typeName, 0, node));
+        infos.push_back(make_shared<SortInfo>(typeName, 0, node->shared_from_this()));
 
         // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
         sptr_t<Sort> typeSort = make_shared<Sort>(make_shared<SimpleIdentifier>(node->getSymbol()));
@@ -339,19 +487,19 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypeCommand> nod
                 selSig.push_back(ctx->getStack()->expand((*selIt)->getSort()));
 
                 // Add selector function info
-                infos.push_back(make_shared<FunInfo>(selName, selSig, node));
+                infos.push_back(make_shared<FunInfo>(selName, selSig, node->shared_from_this()));
             }
 
             // Add constructor function info
             consSig.push_back(typeSort);
-            infos.push_back(make_shared<FunInfo>(consName, consSig, node));
+            infos.push_back(make_shared<FunInfo>(consName, consSig, node->shared_from_this()));
         }
     }
 
     return infos;
 }
 
-sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypesCommand> node) {
+sptr_v<SymbolInfo> SortednessChecker::getInfo(DeclareDatatypesCommand* node) {
     sptr_v<SymbolInfo> infos;
 
     sptr_v<SortDeclaration> datatypeSorts = node->getSorts();
@@ -360,7 +508,7 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypesCommand> no
         unsigned long arity = (unsigned long) (*sortIt)->getArity()->getValue();
 
         // Add datatype sort info
-        infos.push_back(make_shared<SortInfo>(typeName, arity, node));
+        infos.push_back(make_shared<SortInfo>(typeName, arity, node->shared_from_this()));
     }
 
     for (unsigned long i = 0; i < node->getSorts().size(); i++) {
@@ -370,13 +518,15 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypesCommand> no
             // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
             sptr_t<Sort> typeSort =
                     make_shared<Sort>(make_shared<SimpleIdentifier>(node->getSorts()[i]->getSymbol()));
-            typeSort = ctx->getStack()->expand(typeSort);
 
             sptr_v<Symbol> params = pdecl->getParams();
             for (auto paramIt = params.begin(); paramIt != params.end(); paramIt++) {
                 typeSort->getArgs().push_back(make_shared<Sort>(make_shared<SimpleIdentifier>(*paramIt)));
             }
 
+            // Expanded sorts are cached by their text, so the sort is complete before it is expanded
+            typeSort = ctx->getStack()->expand(typeSort);
+
             sptr_v<ConstructorDeclaration> constructors = pdecl->getConstructors();
 
             for (auto consIt = constructors.begin(); consIt != constructors.end(); consIt++) {
@@ -396,12 +546,13 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypesCommand> no
                     selSig.push_back(ctx->getStack()->expand((*selIt)->getSort()));
 
                     // Add selector function info
-                    infos.push_back(make_shared<FunInfo>(selName, selSig, pdecl->getParams(), node));
+                    infos.push_back(make_shared<FunInfo>(selName, selSig, pdecl->getParams(),
+                                                         node->shared_from_this()));
                 }
 
                 // Add constructor function info
                 consSig.push_back(typeSort);
-                infos.push_back(make_shared<FunInfo>(consName, consSig, pdecl->getParams(), node));
+                infos.push_back(make_shared<FunInfo>(consName, consSig, pdecl->getParams(), node->shared_from_this()));
             }
         } else {
             // Build a sort representing the datatype (to be used in the signatures of the constructors and selectors)
@@ -432,12 +583,12 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypesCommand> no
                     selSig.push_back(ctx->getStack()->expand((*selIt)->getSort()));
 
                     // Add selector function info
-                    infos.push_back(make_shared<FunInfo>(selName, selSig, node));
+                    infos.push_back(make_shared<FunInfo>(selName, selSig, node->shared_from_this()));
                 }
 
                 // Add constructor function info
                 consSig.push_back(typeSort);
-                infos.push_back(make_shared<FunInfo>(consName, consSig, node));
+                infos.push_back(make_shared<FunInfo>(consName, consSig, node->shared_from_this()));
             }
         }
     }
@@ -446,41 +597,74 @@ sptr_v<SymbolInfo> SortednessChecker::getInfo(sptr_t<DeclareDatatypesCommand> no
 }
 
 void SortednessChecker::loadTheory(string theory) {
-    sptr_t<AstNode> node;
+    AstNode* node = NULL;
     sptr_t<NodeError> err;
     loadTheory(theory, node, err);
 }
 
 void SortednessChecker::loadTheory(string theory,
-                                   sptr_t<AstNode> node,
+                                   AstNode* node,
                                    sptr_t<NodeError> err) {
-    string path = ctx->getConfiguration()->get(Configuration::Property::LOC_THEORIES) + theory
-                  + ctx->getConfiguration()->get(Configuration::Property::FILE_EXT_THEORY);
-    FILE *f = fopen(path.c_str(), "r");
+    TheoryLoad load = startLoad(theory);
+    finishLoad(load, node, err);
+}
+
+SortednessChecker::TheoryLoad SortednessChecker::startLoad(string theory) {
+    Stats::Timer timer("theory parse", theory);
+    TheoryLoad load;
+    load.theory = theory;
+    load.path = ctx->getConfiguration()->get(Configuration::Property::LOC_THEORIES) + theory
+                + ctx->getConfiguration()->get(Configuration::Property::FILE_EXT_THEORY);
+
+    FILE *f = fopen(load.path.c_str(), "r");
     if (f) {
         fclose(f);
+        load.found = true;
+
+        // The parser is not reentrant, so only the syntax check is left to the shared pool
+        sptr_t<Parser> parser = make_shared<Parser>();
+        sptr_t<AstNode> ast = parser->parse(load.path);
+        if (ast) {
+            load.ast = ast;
+            load.syntaxErrors = ThreadPool::getShared().submit([ast] {
+                sptr_t<SyntaxChecker> chk = make_shared<SyntaxChecker>();
+                return chk->check(ast) ? string() : chk->getErrors();
+            });
+        }
+    } else {
+        load.found = false;
+    }
 
-        sptr_t<SmtExecutionSettings> settings = make_shared<SmtExecutionSettings>();
-        settings->setInputFromFile(path);
-        settings->setCoreTheoryEnabled(false);
-        settings->setSortCheckContext(ctx);
+    return load;
+}
 
-        SmtExecution exec(settings);
-        if(exec.parse()) {
-            if(exec.checkSortedness()) {
-                //currentTheories[theory] = true;
-            }
-        } else {
-            addError(ErrorMessages::buildTheoryUnloadable(theory), node, err);
-        }
+void SortednessChecker::finishLoad(TheoryLoad& load,
+                                   AstNode* node,
+                                   sptr_t<NodeError> err) {
+    if (!load.found) {
+        addError(ERROR_THEORY_UNKNOWN, message(ErrorMessages::buildTheoryUnknown, load.theory), node, err);
+    } else if (!load.ast) {
+        addError(ERROR_THEORY_UNLOADABLE, message(ErrorMessages::buildTheoryUnloadable, load.theory), node, err);
     } else {
-        addError(ErrorMessages::buildTheoryUnknown(theory), node, err);
+        Stats::Timer timer("theory check", load.theory);
+        string syntaxErrors = load.syntaxErrors.get();
+        if (!syntaxErrors.empty()) {
+            Logger::syntaxError("SortednessChecker::loadTheory()", load.path.c_str(), syntaxErrors.c_str());
+            return;
+        }
+
+        sptr_t<SortednessChecker> chk = make_shared<SortednessChecker>(ctx);
+        chk->setLazyTheoryLoading(true);
+        if (!chk->check(load.ast)) {
+            Logger::sortednessError("SortednessChecker::loadTheory()", load.path.c_str(), chk->getErrors().c_str());
+        }
     }
 }
 
 void SortednessChecker::loadLogic(string logic,
-                                  sptr_t<AstNode> node,
+                                  AstNode* node,
                                   sptr_t<NodeError> err) {
+    Stats::Timer timer("logic", logic);
     string path = ctx->getConfiguration()->get(Configuration::Property::LOC_LOGICS) + logic
                   + ctx->getConfiguration()->get(Configuration::Property::FILE_EXT_LOGIC);
     FILE *f = fopen(path.c_str(), "r");
@@ -496,35 +680,41 @@ void SortednessChecker::loadLogic(string logic,
         if(exec.parse()) {
             exec.checkSortedness();
         } else {
-            addError(ErrorMessages::buildLogicUnloadable(logic), node, err);
+            addError(ERROR_LOGIC_UNLOADABLE, message(ErrorMessages::buildLogicUnloadable, logic), node, err);
         }
     } else {
-        addError(ErrorMessages::buildLogicUnknown(logic), node, err);
+        addError(ERROR_LOGIC_UNKNOWN, message(ErrorMessages::buildLogicUnknown, logic), node, err);
     }
 }
 
 sptr_t<SortednessChecker::NodeError>
 SortednessChecker::checkSort(sptr_t<Sort> sort,
-                             sptr_t<AstNode> source,
+                             AstNode* source,
                              sptr_t<SortednessChecker::NodeError> err) {
+    if (ctx->getStack()->getBuiltins().isSort(sort.get()))
+        return err;
+
     string name = sort->getIdentifier()->toString();
     sptr_t<SortInfo> info = ctx->getStack()->getSortInfo(name);
     if (!info) {
-        err = addError(ErrorMessages::buildSortUnknown(name, sort->getRowLeft(), sort->getColLeft(),
-                                                       sort->getRowRight(), sort->getColRight()), source, err);
+        err = addError(ERROR_SORT_UNKNOWN, [name, sort] {
+            return ErrorMessages::buildSortUnknown(name, sort->getRowLeft(), sort->getColLeft(),
+                                                   sort->getRowRight(), sort->getColRight());
+        }, source, err);
 
-        sptr_v<Sort> argSorts = sort->getArgs();
+        sptr_v<Sort>& argSorts = sort->getArgs();
         for (auto sortIt = argSorts.begin(); sortIt != argSorts.end(); sortIt++) {
             checkSort(*sortIt, source, err);
         }
     } else {
         if (sort->getArgs().size() != info->arity) {
-            err = addError(ErrorMessages::buildSortArity(name, info->arity, sort->getArgs().size(),
-                                                         sort->getRowLeft(), sort->getColLeft(),
-                                                         sort->getRowRight(), sort->getColRight()),
-                           source, info, err);
+            err = addError(ERROR_SORT_ARITY, [name, info, sort] {
+                return ErrorMessages::buildSortArity(name, info->arity, sort->getArgs().size(),
+                                                     sort->getRowLeft(), sort->getColLeft(),
+                                                     sort->getRowRight(), sort->getColRight());
+            }, source, info, err);
         } else {
-            sptr_v<Sort> argSorts = sort->getArgs();
+            sptr_v<Sort>& argSorts = sort->getArgs();
             for (auto sortIt = argSorts.begin(); sortIt != argSorts.end(); sortIt++) {
                 checkSort(*sortIt, source, err);
             }
@@ -536,8 +726,11 @@ SortednessChecker::checkSort(sptr_t<Sort> sort,
 sptr_t<SortednessChecker::NodeError>
 SortednessChecker::checkSort(sptr_v<Symbol> &params,
                              sptr_t<Sort> sort,
-                             sptr_t<AstNode> source,
+                             AstNode* source,
                              sptr_t<SortednessChecker::NodeError> err) {
+    if (ctx->getStack()->getBuiltins().isSort(sort.get()))
+        return err;
+
     string name = sort->getIdentifier()->toString();
     bool isParam = false;
     for (auto paramIt = params.begin(); paramIt != params.end(); paramIt++) {
@@ -548,10 +741,12 @@ SortednessChecker::checkSort(sptr_v<Symbol> &params,
     if (!isParam) {
         sptr_t<SortInfo> info = ctx->getStack()->getSortInfo(name);
         if (!info) {
-            err = addError(ErrorMessages::buildSortUnknown(name, sort->getRowLeft(), sort->getColLeft(),
-                                                           sort->getRowRight(), sort->getColRight()), source, err);
+            err = addError(ERROR_SORT_UNKNOWN, [name, sort] {
+                return ErrorMessages::buildSortUnknown(name, sort->getRowLeft(), sort->getColLeft(),
+                                                       sort->getRowRight(), sort->getColRight());
+            }, source, err);
 
-            sptr_v<Sort> argSorts = sort->getArgs();
+            sptr_v<Sort>& argSorts = sort->getArgs();
             for (auto sortIt = argSorts.begin(); sortIt != argSorts.end(); sortIt++) {
                 checkSort(params, *sortIt, source, err);
             }
@@ -560,12 +755,13 @@ SortednessChecker::checkSort(sptr_v<Symbol> &params,
                 return err;
 
             if (sort->getArgs().size() != info->arity) {
-                err = addError(ErrorMessages::buildSortArity(name, info->arity, sort->getArgs().size(),
-                                                             sort->getRowLeft(), sort->getColLeft(),
-                                                             sort->getRowRight(), sort->getColRight()),
-                               source, info, err);
+                err = addError(ERROR_SORT_ARITY, [name, info, sort] {
+                    return ErrorMessages::buildSortArity(name, info->arity, sort->getArgs().size(),
+                                                         sort->getRowLeft(), sort->getColLeft(),
+                                                         sort->getRowRight(), sort->getColRight());
+                }, source, info, err);
             } else {
-                sptr_v<Sort> argSorts = sort->getArgs();
+                sptr_v<Sort>& argSorts = sort->getArgs();
                 for (auto sortIt = argSorts.begin(); sortIt != argSorts.end(); sortIt++) {
                     checkSort(params, *sortIt, source, err);
                 }
@@ -576,26 +772,32 @@ SortednessChecker::checkSort(sptr_v<Symbol> &params,
     return err;
 }
 
-void SortednessChecker::visit(sptr_t<AssertCommand> node) {
+void SortednessChecker::visit(AssertCommand* node) {
     TermSorter sorter(shared_from_this());
-    sptr_t<Sort> result = sorter.run(node->getTerm());
+    sptr_t<Sort> result = sorter.run(node->getTerm().get());
     if (result) {
         string resstr = result->toString();
         if (resstr != SORT_BOOL) {
             sptr_t<Term> term = node->getTerm();
-            addError(ErrorMessages::buildAssertTermNotBool(term->toString(), resstr,
-                                                           term->getRowLeft(), term->getColLeft(),
-                                                           term->getRowRight(), term->getColRight()), node);
+            addError(ERROR_ASSERT_TERM_NOT_BOOL, [term, resstr] {
+                string termstr = AstPrinter::toString(term.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                return ErrorMessages::buildAssertTermNotBool(termstr, resstr,
+                                                             term->getRowLeft(), term->getColLeft(),
+                                                             term->getRowRight(), term->getColRight());
+            }, node);
         }
     } else {
         sptr_t<Term> term = node->getTerm();
-        addError(ErrorMessages::buildAssertTermNotWellSorted(term->toString(),
-                                                             term->getRowLeft(), term->getColLeft(),
-                                                             term->getRowRight(), term->getColRight()), node);
+        addError(ERROR_ASSERT_TERM_NOT_WELL_SORTED, [term] {
+            string termstr = AstPrinter::toString(term.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+            return ErrorMessages::buildAssertTermNotWellSorted(termstr,
+                                                               term->getRowLeft(), term->getColLeft(),
+                                                               term->getRowRight(), term->getColRight());
+        }, node);
     }
 }
 
-void SortednessChecker::visit(sptr_t<DeclareConstCommand> node) {
+void SortednessChecker::visit(DeclareConstCommand* node) {
     sptr_t<NodeError> err;
     err = checkSort(node->getSort(), node, err);
 
@@ -603,11 +805,11 @@ void SortednessChecker::visit(sptr_t<DeclareConstCommand> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildConstAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_CONST_ALREADY_EXISTS, message(ErrorMessages::buildConstAlreadyExists, nodeInfo->name), node, dupInfo, err);
     }
 }
 
-void SortednessChecker::visit(sptr_t<DeclareFunCommand> node) {
+void SortednessChecker::visit(DeclareFunCommand* node) {
     sptr_t<NodeError> err;
 
     sptr_v<Sort> params = node->getParams();
@@ -621,11 +823,11 @@ void SortednessChecker::visit(sptr_t<DeclareFunCommand> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, nodeInfo->name), node, dupInfo, err);
     }
 }
 
-void SortednessChecker::visit(sptr_t<DeclareDatatypeCommand> node) {
+void SortednessChecker::visit(DeclareDatatypeCommand* node) {
     sptr_t<NodeError> err;
 
     sptr_t<ParametricDatatypeDeclaration> pdecl =
@@ -638,7 +840,7 @@ void SortednessChecker::visit(sptr_t<DeclareDatatypeCommand> node) {
             sptr_t<SortInfo> dupInfo = ctx->getStack()->tryAdd(sortInfo);
 
             if (dupInfo) {
-                err = addError(ErrorMessages::buildSortAlreadyExists(sortInfo->name), node, dupInfo, err);
+                err = addError(ERROR_SORT_ALREADY_EXISTS, message(ErrorMessages::buildSortAlreadyExists, sortInfo->name), node, dupInfo, err);
             }
         }
     }
@@ -674,14 +876,14 @@ void SortednessChecker::visit(sptr_t<DeclareDatatypeCommand> node) {
             sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(funInfo);
 
             if (dupInfo) {
-                err = addError(ErrorMessages::buildFunAlreadyExists(funInfo->name), node, dupInfo, err);
+                err = addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, funInfo->name), node, dupInfo, err);
             }
 
         }
     }
 }
 
-void SortednessChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
+void SortednessChecker::visit(DeclareDatatypesCommand* node) {
     sptr_t<NodeError> err;
 
     sptr_v<SymbolInfo> infos = getInfo(node);
@@ -690,7 +892,7 @@ void SortednessChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
         if (sortInfo) {
             sptr_t<SortInfo> dupInfo = ctx->getStack()->tryAdd(sortInfo);
             if (dupInfo) {
-                err = addError(ErrorMessages::buildSortAlreadyExists(sortInfo->name), node, dupInfo, err);
+                err = addError(ERROR_SORT_ALREADY_EXISTS, message(ErrorMessages::buildSortAlreadyExists, sortInfo->name), node, dupInfo, err);
             }
         }
     }
@@ -708,7 +910,7 @@ void SortednessChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
                 sptr_v<SelectorDeclaration> selectors = (*consIt)->getSelectors();
 
                 for (auto selIt = selectors.begin(); selIt != selectors.end(); selIt++) {
-                    declerr = checkSort(pdecl->getParams(), (*selIt)->getSort(), pdecl, declerr);
+                    declerr = checkSort(pdecl->getParams(), (*selIt)->getSort(), pdecl.get(), declerr);
                 }
             }
         } else {
@@ -720,7 +922,7 @@ void SortednessChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
                 sptr_v<SelectorDeclaration> selectors = (*consIt)->getSelectors();
 
                 for (auto selIt = selectors.begin(); selIt != selectors.end(); selIt++) {
-                    declerr = checkSort((*selIt)->getSort(), sdecl, declerr);
+                    declerr = checkSort((*selIt)->getSort(), sdecl.get(), declerr);
                 }
             }
         }
@@ -733,22 +935,22 @@ void SortednessChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
         if (funInfo) {
             sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(funInfo);
             if (dupInfo) {
-                err = addError(ErrorMessages::buildFunAlreadyExists(funInfo->name), node, dupInfo, err);
+                err = addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, funInfo->name), node, dupInfo, err);
             }
         }
     }
 }
 
-void SortednessChecker::visit(sptr_t<DeclareSortCommand> node) {
+void SortednessChecker::visit(DeclareSortCommand* node) {
     sptr_t<SortInfo> nodeInfo = getInfo(node);
     sptr_t<SortInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildSortAlreadyExists(nodeInfo->name), node, dupInfo);
+        addError(ERROR_SORT_ALREADY_EXISTS, message(ErrorMessages::buildSortAlreadyExists, nodeInfo->name), node, dupInfo);
     }
 }
 
-void SortednessChecker::visit(sptr_t<DefineFunCommand> node) {
+void SortednessChecker::visit(DefineFunCommand* node) {
     sptr_t<NodeError> err;
 
     sptr_v<SortedVariable> sig = node->getDefinition()->getSignature()->getParams();
@@ -761,40 +963,47 @@ void SortednessChecker::visit(sptr_t<DefineFunCommand> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->findDuplicate(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, nodeInfo->name), node, dupInfo, err);
     } else {
         ctx->getStack()->push();
 
         sptr_v<SortedVariable> &bindings = node->getDefinition()->getSignature()->getParams();
         for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
             ctx->getStack()->tryAdd(make_shared<VarInfo>((*bindingIt)->getSymbol()->toString(),
-                                               ctx->getStack()->expand((*bindingIt)->getSort()), node));
+                                               ctx->getStack()->expand((*bindingIt)->getSort()),
+                                               node->shared_from_this()));
         }
 
         TermSorter sorter(shared_from_this());
-        sptr_t<Sort> result = sorter.run(node->getDefinition()->getBody());
+        sptr_t<Sort> result = sorter.run(node->getDefinition()->getBody().get());
 
         if (result) {
             string retstr = nodeInfo->signature[nodeInfo->signature.size() - 1]->toString();
             string resstr = result->toString();
             if (resstr != retstr) {
                 sptr_t<Term> body = node->getDefinition()->getBody();
-                addError(ErrorMessages::buildFunBodyWrongSort(body->toString(), resstr, retstr,
-                                                              body->getRowLeft(), body->getColLeft(),
-                                                              body->getRowRight(), body->getColRight()), node);
+                addError(ERROR_FUN_BODY_WRONG_SORT, [body, resstr, retstr] {
+                    string bodystr = AstPrinter::toString(body.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                    return ErrorMessages::buildFunBodyWrongSort(bodystr, resstr, retstr,
+                                                                body->getRowLeft(), body->getColLeft(),
+                                                                body->getRowRight(), body->getColRight());
+                }, node);
             }
         } else {
             sptr_t<Term> body = node->getDefinition()->getBody();
-            addError(ErrorMessages::buildFunBodyNotWellSorted(body->toString(),
-                                                              body->getRowLeft(), body->getColLeft(),
-                                                              body->getRowRight(), body->getColRight()), node);
+            addError(ERROR_FUN_BODY_NOT_WELL_SORTED, [body] {
+                string bodystr = AstPrinter::toString(body.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                return ErrorMessages::buildFunBodyNotWellSorted(bodystr,
+                                                                body->getRowLeft(), body->getColLeft(),
+                                                                body->getRowRight(), body->getColRight());
+            }, node);
         }
 
         ctx->getStack()->pop();        ctx->getStack()->tryAdd(nodeInfo);
     }
 }
 
-void SortednessChecker::visit(sptr_t<DefineFunRecCommand> node) {
+void SortednessChecker::visit(DefineFunRecCommand* node) {
     sptr_t<NodeError> err;
 
     sptr_v<SortedVariable> sig = node->getDefinition()->getSignature()->getParams();
@@ -807,7 +1016,7 @@ void SortednessChecker::visit(sptr_t<DefineFunRecCommand> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->findDuplicate(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, nodeInfo->name), node, dupInfo, err);
     } else {
         ctx->getStack()->push();
         ctx->getStack()->tryAdd(nodeInfo);
@@ -815,26 +1024,33 @@ void SortednessChecker::visit(sptr_t<DefineFunRecCommand> node) {
         sptr_v<SortedVariable> &bindings = node->getDefinition()->getSignature()->getParams();
         for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
             ctx->getStack()->tryAdd(make_shared<VarInfo>((*bindingIt)->getSymbol()->toString(),
-                                               ctx->getStack()->expand((*bindingIt)->getSort()), node));
+                                               ctx->getStack()->expand((*bindingIt)->getSort()),
+                                               node->shared_from_this()));
         }
 
         TermSorter sorter(shared_from_this());
-        sptr_t<Sort> result = sorter.run(node->getDefinition()->getBody());
+        sptr_t<Sort> result = sorter.run(node->getDefinition()->getBody().get());
 
         if (result) {
             string retstr = nodeInfo->signature[nodeInfo->signature.size() - 1]->toString();
             string resstr = result->toString();
             if (resstr != retstr) {
                 sptr_t<Term> body = node->getDefinition()->getBody();
-                addError(ErrorMessages::buildFunBodyWrongSort(body->toString(), resstr, retstr,
-                                                              body->getRowLeft(), body->getColLeft(),
-                                                              body->getRowRight(), body->getColRight()), node);
+                addError(ERROR_FUN_BODY_WRONG_SORT, [body, resstr, retstr] {
+                    string bodystr = AstPrinter::toString(body.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                    return ErrorMessages::buildFunBodyWrongSort(bodystr, resstr, retstr,
+                                                                body->getRowLeft(), body->getColLeft(),
+                                                                body->getRowRight(), body->getColRight());
+                }, node);
             }
         } else {
             sptr_t<Term> body = node->getDefinition()->getBody();
-            addError(ErrorMessages::buildFunBodyNotWellSorted(body->toString(),
-                                                              body->getRowLeft(), body->getColLeft(),
-                                                              body->getRowRight(), body->getColRight()), node);
+            addError(ERROR_FUN_BODY_NOT_WELL_SORTED, [body] {
+                string bodystr = AstPrinter::toString(body.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                return ErrorMessages::buildFunBodyNotWellSorted(bodystr,
+                                                                body->getRowLeft(), body->getColLeft(),
+                                                                body->getRowRight(), body->getColRight());
+            }, node);
         }
 
         ctx->getStack()->pop();
@@ -842,7 +1058,7 @@ void SortednessChecker::visit(sptr_t<DefineFunRecCommand> node) {
     }
 }
 
-void SortednessChecker::visit(sptr_t<DefineFunsRecCommand> node) {
+void SortednessChecker::visit(DefineFunsRecCommand* node) {
     sptr_t<NodeError> err;
     sptr_v<FunctionDeclaration> &decls = node->getDeclarations();
     sptr_v<Term> &bodies = node->getBodies();
@@ -862,7 +1078,7 @@ void SortednessChecker::visit(sptr_t<DefineFunsRecCommand> node) {
         sptr_t<FunInfo> dupInfo = ctx->getStack()->findDuplicate(*infoIt);
         if (dupInfo) {
             dup = true;
-            err = addError(ErrorMessages::buildFunAlreadyExists((*infoIt)->name), node, *infoIt, err);
+            err = addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, (*infoIt)->name), node, *infoIt, err);
         }
     }
 
@@ -878,28 +1094,37 @@ void SortednessChecker::visit(sptr_t<DefineFunsRecCommand> node) {
             sptr_v<SortedVariable> &bindings = decls[i]->getParams();
             for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
                 ctx->getStack()->tryAdd(make_shared<VarInfo>((*bindingIt)->getSymbol()->toString(),
-                                                   ctx->getStack()->expand((*bindingIt)->getSort()), node));
+                                                   ctx->getStack()->expand((*bindingIt)->getSort()),
+                                               node->shared_from_this()));
             }
 
             TermSorter sorter(shared_from_this());
-            sptr_t<Sort> result = sorter.run(bodies[i]);
+            sptr_t<Sort> result = sorter.run(bodies[i].get());
 
             if (result) {
                 string retstr = infos[i]->signature[infos[i]->signature.size() - 1]->toString();
                 string resstr = result->toString();
                 if (resstr != retstr) {
-                    err = addError(ErrorMessages::buildFunBodyWrongSort(infos[i]->name, infos[i]->body->toString(),
-                                                                        resstr, retstr, infos[i]->body->getRowLeft(),
-                                                                        infos[i]->body->getColLeft(),
-                                                                        infos[i]->body->getRowRight(),
-                                                                        infos[i]->body->getColRight()), node, err);
+                    sptr_t<FunInfo> info = infos[i];
+                    err = addError(ERROR_FUN_BODY_WRONG_SORT, [info, resstr, retstr] {
+                        string bodystr = AstPrinter::toString(info->body.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                        return ErrorMessages::buildFunBodyWrongSort(info->name, bodystr, resstr, retstr,
+                                                                    info->body->getRowLeft(),
+                                                                    info->body->getColLeft(),
+                                                                    info->body->getRowRight(),
+                                                                    info->body->getColRight());
+                    }, node, err);
                 }
             } else {
-                err = addError(ErrorMessages::buildFunBodyNotWellSorted(infos[i]->name, infos[i]->body->toString(),
-                                                                        infos[i]->body->getRowLeft(),
-                                                                        infos[i]->body->getColLeft(),
-                                                                        infos[i]->body->getRowRight(),
-                                                                        infos[i]->body->getColRight()), node, err);
+                sptr_t<FunInfo> info = infos[i];
+                err = addError(ERROR_FUN_BODY_NOT_WELL_SORTED, [info] {
+                    string bodystr = AstPrinter::toString(info->body.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                    return ErrorMessages::buildFunBodyNotWellSorted(info->name, bodystr,
+                                                                    info->body->getRowLeft(),
+                                                                    info->body->getColLeft(),
+                                                                    info->body->getRowRight(),
+                                                                    info->body->getColRight());
+                }, node, err);
             }
             ctx->getStack()->pop();
         }
@@ -911,7 +1136,7 @@ void SortednessChecker::visit(sptr_t<DefineFunsRecCommand> node) {
     }
 }
 
-void SortednessChecker::visit(sptr_t<DefineSortCommand> node) {
+void SortednessChecker::visit(DefineSortCommand* node) {
     sptr_t<NodeError> err;
     err = checkSort(node->getParams(), node->getSort(), node, err);
 
@@ -919,47 +1144,49 @@ void SortednessChecker::visit(sptr_t<DefineSortCommand> node) {
     sptr_t<SortInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildSortAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_SORT_ALREADY_EXISTS, message(ErrorMessages::buildSortAlreadyExists, nodeInfo->name), node, dupInfo, err);
     }
 }
 
-void SortednessChecker::visit(sptr_t<GetValueCommand> node) {
+void SortednessChecker::visit(GetValueCommand* node) {
     sptr_t<NodeError> err;
 
     sptr_v<Term> terms = node->getTerms();
     for (auto termIt = terms.begin(); termIt != terms.end(); termIt++) {
         TermSorter sorter(shared_from_this());
-        sptr_t<Sort> result = sorter.run(*termIt);
+        sptr_t<Sort> result = sorter.run((*termIt).get());
         if (!result) {
-            err = addError(ErrorMessages::buildTermNotWellSorted(
-                    (*termIt)->toString(), (*termIt)->getRowLeft(),
-                    (*termIt)->getColLeft(), (*termIt)->getRowRight(),
-                    (*termIt)->getColRight()), node, err);
+            sptr_t<Term> term = *termIt;
+            err = addError(ERROR_TERM_NOT_WELL_SORTED, [term] {
+                string termstr = AstPrinter::toString(term.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                return ErrorMessages::buildTermNotWellSorted(termstr, term->getRowLeft(), term->getColLeft(),
+                                                             term->getRowRight(), term->getColRight());
+            }, node, err);
         }
     }
 }
 
-void SortednessChecker::visit(sptr_t<PopCommand> node) {
+void SortednessChecker::visit(PopCommand* node) {
     unsigned long levels = (unsigned long) node->getNumeral()->getValue();
     if (!ctx->getStack()->pop(levels)) {
-        addError(ErrorMessages::buildStackUnpoppable(levels), node);
+        addError(ERROR_STACK_UNPOPPABLE, [levels] { return ErrorMessages::buildStackUnpoppable(levels); }, node);
     }
 }
 
-void SortednessChecker::visit(sptr_t<PushCommand> node) {
+void SortednessChecker::visit(PushCommand* node) {
     ctx->getStack()->push((unsigned long) node->getNumeral()->getValue());
 }
 
-void SortednessChecker::visit(sptr_t<ResetCommand> node) {
+void SortednessChecker::visit(ResetCommand* node) {
     ctx->getStack()->reset();
     ctx->setCurrentLogic("");
     ctx->getCurrentTheories().clear();
 }
 
-void SortednessChecker::visit(sptr_t<SetLogicCommand> node) {
+void SortednessChecker::visit(SetLogicCommand* node) {
     sptr_t<NodeError> err;
     if (ctx->getCurrentLogic() != "") {
-        addError(ErrorMessages::buildLogicAlreadySet(ctx->getCurrentLogic()), node);
+        addError(ERROR_LOGIC_ALREADY_SET, message(ErrorMessages::buildLogicAlreadySet, ctx->getCurrentLogic()), node);
     } else {
         string logic = node->getLogic()->toString();
         ctx->setCurrentLogic(logic);
@@ -967,7 +1194,7 @@ void SortednessChecker::visit(sptr_t<SetLogicCommand> node) {
     }
 }
 
-void SortednessChecker::visit(sptr_t<Logic> node) {
+void SortednessChecker::visit(Logic* node) {
     sptr_v<Attribute> attrs = node->getAttributes();
     for (auto attrIt = attrs.begin(); attrIt != attrs.end(); attrIt++) {
         sptr_t<Attribute> attr = *attrIt;
@@ -978,47 +1205,142 @@ void SortednessChecker::visit(sptr_t<Logic> node) {
                     dynamic_pointer_cast<CompAttributeValue>(attr->getValue());
             sptr_v<AttributeValue> compValues = attrValue->getValues();
 
+            // Start loading all the theories, so that their files are checked concurrently
+            vector<TheoryLoad> loads;
+            vector<bool> loaded;
             for (auto valIt = compValues.begin(); valIt != compValues.end(); valIt++) {
                 string theory = dynamic_cast<Symbol *>((*valIt).get())->toString();
                 auto found = find(ctx->getCurrentTheories().begin(), ctx->getCurrentTheories().end(), theory);
 
-                if (found != ctx->getCurrentTheories().end()) {
-                    err = addError(ErrorMessages::buildTheoryAlreadyLoaded(theory), attr, err);
-                } else {
+                loaded.push_back(found != ctx->getCurrentTheories().end());
+                if (found == ctx->getCurrentTheories().end()) {
                     ctx->getCurrentTheories().push_back(theory);
-                    loadTheory(theory, attr, err);
+                    loads.push_back(startLoad(theory));
+                }
+            }
+
+            // Add their symbols in the order in which they are listed
+            auto loadIt = loads.begin();
+            for (unsigned long i = 0; i < compValues.size(); i++) {
+                if (loaded[i]) {
+                    string theory = dynamic_cast<Symbol *>(compValues[i].get())->toString();
+                    err = addError(ERROR_THEORY_ALREADY_LOADED, message(ErrorMessages::buildTheoryAlreadyLoaded, theory), attr.get(), err);
+                } else {
+                    finishLoad(*loadIt, attr.get(), err);
+                    loadIt++;
                 }
             }
         }
     }
 }
 
-void SortednessChecker::visit(sptr_t<Theory> node) {
+void SortednessChecker::visit(Theory* node) {
+    ctx->getStack()->enableBuiltins(node->getName()->toString());
+    if (lazyTheoryLoading)
+        ctx->getTheoryLoader()->enableBuiltins(node->getName()->toString());
+
     sptr_v<Attribute> attrs = node->getAttributes();
     for (auto attrIt = attrs.begin(); attrIt != attrs.end(); attrIt++) {
         sptr_t<Attribute> attr = *attrIt;
 
         if (attr->getKeyword()->getValue() == KW_SORTS || attr->getKeyword()->getValue() == KW_FUNS) {
             CompAttributeValue *val = dynamic_cast<CompAttributeValue *>(attr->getValue().get());
-            visit0(val->getValues());
+            if (lazyTheoryLoading)
+                addPending(val->getValues());
+            else
+                visit0(val->getValues());
+        }
+    }
+}
+
+void SortednessChecker::addPending(sptr_v<AttributeValue>& declarations) {
+    sptr_t<SymbolStack> stack = ctx->getStack();
+    sptr_t<TheoryDeclarationLoader> loader = ctx->getTheoryLoader();
+
+    for (auto declIt = declarations.begin(); declIt != declarations.end(); declIt++) {
+        AttributeValue* decl = (*declIt).get();
+
+        if (SortSymbolDeclaration* sortDecl = dynamic_cast<SortSymbolDeclaration*>(decl)) {
+            loader->addPendingSort(stack, sortDecl->getIdentifier()->toString(), *declIt);
+        } else if (SpecConstFunDeclaration* constDecl = dynamic_cast<SpecConstFunDeclaration*>(decl)) {
+            loader->addPendingFun(stack, constDecl->getConstant()->toString(), *declIt);
+        } else if (MetaSpecConstFunDeclaration* metaDecl = dynamic_cast<MetaSpecConstFunDeclaration*>(decl)) {
+            loader->addPendingFun(stack, metaDecl->getConstant()->toString(), *declIt);
+        } else if (SimpleFunDeclaration* funDecl = dynamic_cast<SimpleFunDeclaration*>(decl)) {
+            loader->addPendingFun(stack, funDecl->getIdentifier()->toString(), *declIt);
+        } else if (ParametricFunDeclaration* parDecl = dynamic_cast<ParametricFunDeclaration*>(decl)) {
+            loader->addPendingFun(stack, parDecl->getIdentifier()->toString(), *declIt);
+        } else {
+            visit0(*declIt);
         }
     }
 }
 
-void SortednessChecker::visit(sptr_t<Script> node) {
-    visit0(node->getCommands());
+void SortednessChecker::visit(Script* node) {
+    sptr_v<Command>& commands = node->getCommands();
+    for (auto cmdIt = commands.begin(); cmdIt != commands.end() && !isErrorLimitReached(); cmdIt++) {
+        visitPart((*cmdIt).get());
+    }
+    checkBatch();
+}
+
+void SortednessChecker::checkBatch() {
+    if (batch.empty())
+        return;
+
+    ThreadPool& pool = ThreadPool::getShared();
+    unsigned long taskCount = min(pool.getSize() + 1, batch.size() / MIN_TASK_COMMANDS);
+
+    if (taskCount < 2) {
+        for (auto cmdIt = batch.begin(); cmdIt != batch.end() && !isErrorLimitReached(); cmdIt++) {
+            visit0(*cmdIt);
+        }
+        batch.clear();
+        return;
+    }
+
+    // Each part is checked by a checker of its own, so that errors can be merged in command order
+    unsigned long size = batch.size();
+    unsigned long partCount = min(size, taskCount * PARTS_PER_TASK);
+    vector<sptr_t<SortednessChecker>> results(partCount);
+
+    // Workers check against snapshots taken beforehand, since checking may load pending symbols into the stack
+    vector<sptr_t<ISortCheckContext>> contexts;
+    contexts.push_back(ctx);
+    for (unsigned long i = 1; i < taskCount; i++) {
+        contexts.push_back(make_shared<SortednessCheckerContext>(ctx->getStack()->snapshot(),
+                                                                 ctx->getConfiguration()));
+    }
+
+    pool.forEach(partCount, taskCount, [this, size, partCount, &contexts, &results](unsigned long task,
+                                                                                  unsigned long part) {
+        sptr_t<SortednessChecker> chk = make_shared<SortednessChecker>(contexts[task]);
+        chk->setParallelChecking(true);
+        chk->setErrorLimit(errorLimit);
+        for (unsigned long i = part * size / partCount;
+             i < (part + 1) * size / partCount && !chk->isErrorLimitReached(); i++) {
+            chk->visit0(batch[i]);
+        }
+        results[part] = chk;
+    });
+
+    for (auto resultIt = results.begin(); resultIt != results.end(); resultIt++) {
+        addErrors(*resultIt);
+    }
+
+    batch.clear();
 }
 
-void SortednessChecker::visit(sptr_t<SortSymbolDeclaration> node) {
+void SortednessChecker::visit(SortSymbolDeclaration* node) {
     sptr_t<SortInfo> nodeInfo = getInfo(node);
     sptr_t<SortInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildSortAlreadyExists(nodeInfo->name), node, dupInfo);
+        addError(ERROR_SORT_ALREADY_EXISTS, message(ErrorMessages::buildSortAlreadyExists, nodeInfo->name), node, dupInfo);
     }
 }
 
-void SortednessChecker::visit(sptr_t<SpecConstFunDeclaration> node) {
+void SortednessChecker::visit(SpecConstFunDeclaration* node) {
     sptr_t<NodeError> err;
     err = checkSort(node->getSort(), node, err);
 
@@ -1026,11 +1348,11 @@ void SortednessChecker::visit(sptr_t<SpecConstFunDeclaration> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildSpecConstAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_SPEC_CONST_ALREADY_EXISTS, message(ErrorMessages::buildSpecConstAlreadyExists, nodeInfo->name), node, dupInfo, err);
     }
 }
 
-void SortednessChecker::visit(sptr_t<MetaSpecConstFunDeclaration> node) {
+void SortednessChecker::visit(MetaSpecConstFunDeclaration* node) {
     sptr_t<NodeError> err;
     err = checkSort(node->getSort(), node, err);
 
@@ -1038,13 +1360,13 @@ void SortednessChecker::visit(sptr_t<MetaSpecConstFunDeclaration> node) {
     sptr_v<FunInfo> dupInfo = ctx->getStack()->getFunInfo(nodeInfo->name);
 
     if (!dupInfo.empty()) {
-        err = addError(ErrorMessages::buildMetaSpecConstAlreadyExists(nodeInfo->name), node, dupInfo[0], err);
+        err = addError(ERROR_META_SPEC_CONST_ALREADY_EXISTS, message(ErrorMessages::buildMetaSpecConstAlreadyExists, nodeInfo->name), node, dupInfo[0], err);
     } else {
         ctx->getStack()->tryAdd(nodeInfo);
     }
 }
 
-void SortednessChecker::visit(sptr_t<SimpleFunDeclaration> node) {
+void SortednessChecker::visit(SimpleFunDeclaration* node) {
     sptr_t<NodeError> err;
 
     sptr_v<Sort> sig = node->getSignature();
@@ -1056,14 +1378,14 @@ void SortednessChecker::visit(sptr_t<SimpleFunDeclaration> node) {
 
     if (nodeInfo->assocL) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildLeftAssocParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_LEFT_ASSOC_PARAM_COUNT, message(ErrorMessages::buildLeftAssocParamCount, nodeInfo->name), node, err);
             nodeInfo->assocL = false;
         } else {
             sptr_t<Sort> firstSort = sig[0];
             sptr_t<Sort> returnSort = sig[2];
 
             if (firstSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildLeftAssocRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_LEFT_ASSOC_RET_SORT, message(ErrorMessages::buildLeftAssocRetSort, nodeInfo->name), node, err);
                 nodeInfo->assocL = false;
             }
         }
@@ -1071,26 +1393,26 @@ void SortednessChecker::visit(sptr_t<SimpleFunDeclaration> node) {
 
     if (nodeInfo->assocR) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildRightAssocParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_RIGHT_ASSOC_PARAM_COUNT, message(ErrorMessages::buildRightAssocParamCount, nodeInfo->name), node, err);
             nodeInfo->assocR = false;
         } else {
             sptr_t<Sort> secondSort = sig[1];
             sptr_t<Sort> returnSort = sig[2];
 
             if (secondSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildRightAssocRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_RIGHT_ASSOC_RET_SORT, message(ErrorMessages::buildRightAssocRetSort, nodeInfo->name), node, err);
                 nodeInfo->assocR = false;
             }
         }
     }
 
     if (nodeInfo->chainable && nodeInfo->pairwise) {
-        err = addError(ErrorMessages::buildChainableAndPairwise(nodeInfo->name), node, err);
+        err = addError(ERROR_CHAINABLE_AND_PAIRWISE, message(ErrorMessages::buildChainableAndPairwise, nodeInfo->name), node, err);
         nodeInfo->chainable = false;
         nodeInfo->pairwise = false;
     } else if (nodeInfo->chainable) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildChainableParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_CHAINABLE_PARAM_COUNT, message(ErrorMessages::buildChainableParamCount, nodeInfo->name), node, err);
             nodeInfo->chainable = false;
         } else {
             sptr_t<Sort> firstSort = sig[0];
@@ -1098,18 +1420,18 @@ void SortednessChecker::visit(sptr_t<SimpleFunDeclaration> node) {
             sptr_t<Sort> returnSort = sig[2];
 
             if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildChainableParamSort(nodeInfo->name), node, err);
+                err = addError(ERROR_CHAINABLE_PARAM_SORT, message(ErrorMessages::buildChainableParamSort, nodeInfo->name), node, err);
                 nodeInfo->chainable = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildChainableRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_CHAINABLE_RET_SORT, message(ErrorMessages::buildChainableRetSort, nodeInfo->name), node, err);
                 nodeInfo->chainable = false;
             }
         }
     } else if (nodeInfo->pairwise) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildPairwiseParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_PAIRWISE_PARAM_COUNT, message(ErrorMessages::buildPairwiseParamCount, nodeInfo->name), node, err);
             nodeInfo->pairwise = false;
         } else {
             sptr_t<Sort> firstSort = sig[0];
@@ -1117,12 +1439,12 @@ void SortednessChecker::visit(sptr_t<SimpleFunDeclaration> node) {
             sptr_t<Sort> returnSort = sig[2];
 
             if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildPairwiseParamSort(nodeInfo->name), node, err);
+                err = addError(ERROR_PAIRWISE_PARAM_SORT, message(ErrorMessages::buildPairwiseParamSort, nodeInfo->name), node, err);
                 nodeInfo->pairwise = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildPairwiseRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_PAIRWISE_RET_SORT, message(ErrorMessages::buildPairwiseRetSort, nodeInfo->name), node, err);
                 nodeInfo->pairwise = false;
             }
         }
@@ -1131,11 +1453,11 @@ void SortednessChecker::visit(sptr_t<SimpleFunDeclaration> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, nodeInfo->name), node, dupInfo, err);
     }
 }
 
-void SortednessChecker::visit(sptr_t<ParametricFunDeclaration> node) {
+void SortednessChecker::visit(ParametricFunDeclaration* node) {
     sptr_t<NodeError> err;
 
     sptr_v<Sort> sig = node->getSignature();
@@ -1147,14 +1469,14 @@ void SortednessChecker::visit(sptr_t<ParametricFunDeclaration> node) {
 
     if (nodeInfo->assocL) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildLeftAssocParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_LEFT_ASSOC_PARAM_COUNT, message(ErrorMessages::buildLeftAssocParamCount, nodeInfo->name), node, err);
             nodeInfo->assocL = false;
         } else {
             sptr_t<Sort> firstSort = sig[0];
             sptr_t<Sort> returnSort = sig[2];
 
             if (firstSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildLeftAssocRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_LEFT_ASSOC_RET_SORT, message(ErrorMessages::buildLeftAssocRetSort, nodeInfo->name), node, err);
                 nodeInfo->assocL = false;
             }
         }
@@ -1162,26 +1484,26 @@ void SortednessChecker::visit(sptr_t<ParametricFunDeclaration> node) {
 
     if (nodeInfo->assocR) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildRightAssocParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_RIGHT_ASSOC_PARAM_COUNT, message(ErrorMessages::buildRightAssocParamCount, nodeInfo->name), node, err);
             nodeInfo->assocR = false;
         } else {
             sptr_t<Sort> secondSort = sig[1];
             sptr_t<Sort> returnSort = sig[2];
 
             if (secondSort->toString() != returnSort->toString()) {
-                err = addError(ErrorMessages::buildRightAssocRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_RIGHT_ASSOC_RET_SORT, message(ErrorMessages::buildRightAssocRetSort, nodeInfo->name), node, err);
                 nodeInfo->assocR = false;
             }
         }
     }
 
     if (nodeInfo->chainable && nodeInfo->pairwise) {
-        err = addError(ErrorMessages::buildChainableAndPairwise(nodeInfo->name), node, err);
+        err = addError(ERROR_CHAINABLE_AND_PAIRWISE, message(ErrorMessages::buildChainableAndPairwise, nodeInfo->name), node, err);
         nodeInfo->chainable = false;
         nodeInfo->pairwise = false;
     } else if (nodeInfo->chainable) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildChainableParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_CHAINABLE_PARAM_COUNT, message(ErrorMessages::buildChainableParamCount, nodeInfo->name), node, err);
             nodeInfo->chainable = false;
         } else {
             sptr_t<Sort> firstSort = sig[0];
@@ -1189,18 +1511,18 @@ void SortednessChecker::visit(sptr_t<ParametricFunDeclaration> node) {
             sptr_t<Sort> returnSort = sig[2];
 
             if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildChainableParamSort(nodeInfo->name), node, err);
+                err = addError(ERROR_CHAINABLE_PARAM_SORT, message(ErrorMessages::buildChainableParamSort, nodeInfo->name), node, err);
                 nodeInfo->chainable = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildChainableRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_CHAINABLE_RET_SORT, message(ErrorMessages::buildChainableRetSort, nodeInfo->name), node, err);
                 nodeInfo->chainable = false;
             }
         }
     } else if (nodeInfo->pairwise) {
         if (sig.size() != 3) {
-            err = addError(ErrorMessages::buildPairwiseParamCount(nodeInfo->name), node, err);
+            err = addError(ERROR_PAIRWISE_PARAM_COUNT, message(ErrorMessages::buildPairwiseParamCount, nodeInfo->name), node, err);
             nodeInfo->pairwise = false;
         } else {
             sptr_t<Sort> firstSort = sig[0];
@@ -1208,12 +1530,12 @@ void SortednessChecker::visit(sptr_t<ParametricFunDeclaration> node) {
             sptr_t<Sort> returnSort = sig[2];
 
             if (firstSort->toString() != secondSort->toString()) {
-                err = addError(ErrorMessages::buildPairwiseParamSort(nodeInfo->name), node, err);
+                err = addError(ERROR_PAIRWISE_PARAM_SORT, message(ErrorMessages::buildPairwiseParamSort, nodeInfo->name), node, err);
                 nodeInfo->pairwise = false;
             }
 
             if (returnSort->toString() != SORT_BOOL) {
-                err = addError(ErrorMessages::buildPairwiseRetSort(nodeInfo->name), node, err);
+                err = addError(ERROR_PAIRWISE_RET_SORT, message(ErrorMessages::buildPairwiseRetSort, nodeInfo->name), node, err);
                 nodeInfo->pairwise = false;
             }
         }
@@ -1222,7 +1544,7 @@ void SortednessChecker::visit(sptr_t<ParametricFunDeclaration> node) {
     sptr_t<FunInfo> dupInfo = ctx->getStack()->tryAdd(nodeInfo);
 
     if (dupInfo) {
-        addError(ErrorMessages::buildFunAlreadyExists(nodeInfo->name), node, dupInfo, err);
+        addError(ERROR_FUN_ALREADY_EXISTS, message(ErrorMessages::buildFunAlreadyExists, nodeInfo->name), node, dupInfo, err);
     }
 }
 
@@ -1233,15 +1555,15 @@ bool SortednessChecker::check(sptr_t<AstNode> node) {
         Logger::warning("SortednessChecker::run()", "Attempting to check an empty abstract syntax tree");
         return false;
     }
-    return errors.empty();
+    return errorCount == 0;
 }
 
 string SortednessChecker::getErrors() {
     stringstream ss;
 
     for (auto errIt = errors.begin(); errIt != errors.end(); errIt++) {
-        string file = errIt->first;
-        sptr_v<NodeError> errs = errIt->second;
+        const string& file = errIt->first;
+        sptr_v<NodeError>& errs = errIt->second;
 
         if (file != "") {
             long length = 11 + file.length();
@@ -1259,11 +1581,7 @@ string SortednessChecker::getErrors() {
                 ss << err->node->getRowLeft() << ":" << err->node->getColLeft()
                 << " - " << err->node->getRowRight() << ":" << err->node->getColRight() << "   ";
 
-                string nodestr = err->node->toString();
-                if (nodestr.length() > 100)
-                    ss << string(nodestr, 0, 100) << "[...]";
-                else
-                    ss << nodestr;
+                ss << AstPrinter::toString(err->node, 100);
 
                 ss << endl;
             }
@@ -1278,18 +1596,14 @@ string SortednessChecker::getErrors() {
                 if (infoIt != err->errs.begin() && source)
                     ss << endl;
 
-                ss << "\t" << (*infoIt)->message << "." << endl;
+                ss << "\t" << (*infoIt)->message() << "." << endl;
 
                 if (source) {
                     ss << "\t\tPreviously, in file '" << source->getFilename()->c_str() << "'\n\t\t"
                     << source->getRowLeft() << ":" << source->getColLeft() << " - "
                     << source->getRowRight() << ":" << source->getColRight() << "   ";
 
-                    string sourcestr = source->toString();
-                    if (sourcestr.length() > 100)
-                        ss << string(sourcestr, 0, 100);
-                    else
-                        ss << sourcestr;
+                    ss << AstPrinter::toString(source.get(), 100);
 
                     ss << endl;
 
@@ -1302,6 +1616,9 @@ string SortednessChecker::getErrors() {
         }
     }
 
+    if (isErrorLimitReached())
+        ss << "Stopped after reaching the limit of " << errorLimit << " errors." << endl;
+
     ss << endl;
 
     return ss.str();
@@ -1319,3 +1636,25 @@ sptr_t<Configuration> SortednessChecker::getConfiguration() {
     return ctx->getConfiguration();
 }
 
+void SortednessChecker::visitPart(AstNode* part) {
+    if (isErrorLimitReached())
+        return;
+
+    // Only assertions and get-value commands leave the context as it is
+    if (parallelChecking
+        && (part->getKind() == NODE_ASSERT_COMMAND || part->getKind() == NODE_GET_VALUE_COMMAND)) {
+        batch.push_back(part);
+    } else {
+        checkBatch();
+        visit0(part);
+    }
+}
+
+void SortednessChecker::leave() {
+    checkBatch();
+}
+
+unsigned long SortednessChecker::getErrorCount() {
+    return errorCount;
+}
+
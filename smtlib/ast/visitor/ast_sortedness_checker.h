@@ -8,17 +8,26 @@
 #define SMTLIB_PARSER_AST_SORTEDNESS_CHECKER_H
 
 #include "ast_visitor_extra.h"
+#include "ast_visitor_fused.h"
 #include "ast_term_sorter.h"
 #include "ast/ast_symbol_decl.h"
 #include "ast/ast_command.h"
 #include "ast/stack/ast_symbol_stack.h"
 #include "util/logger.h"
 #include "util/configuration.h"
+#include "util/diagnostic_writer.h"
+#include "util/error_messages.h"
 
+#include <functional>
+#include <future>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 
 namespace smtlib {
     namespace ast {
+        class TheoryDeclarationLoader;
+
         /* ============================= SortednessCheckerContext ============================= */
         /** Context for checking sortedness */
         class ISortCheckContext {
@@ -28,6 +37,9 @@ namespace smtlib {
             virtual std::string getCurrentLogic() = 0;
             virtual sptr_t<Configuration> getConfiguration() = 0;
             virtual void setCurrentLogic(std::string logic) = 0;
+
+            /** Get the loader of the declarations of the theories loaded in this context */
+            virtual sptr_t<TheoryDeclarationLoader> getTheoryLoader() = 0;
         };
 
         class SortednessCheckerContext : public ISortCheckContext,
@@ -37,45 +49,116 @@ namespace smtlib {
             std::vector<std::string> currentTheories;
             std::string currentLogic;
             sptr_t<Configuration> config;
+            sptr_t<TheoryDeclarationLoader> theoryLoader;
         public:
             SortednessCheckerContext();
 
             SortednessCheckerContext(sptr_t<smtlib::SymbolStack> stack);
 
+            SortednessCheckerContext(sptr_t<smtlib::SymbolStack> stack, sptr_t<Configuration> config);
+
             virtual sptr_t<SymbolStack> getStack();
             virtual std::vector<std::string>& getCurrentTheories();
             virtual std::string getCurrentLogic();
             virtual sptr_t<Configuration> getConfiguration();
             virtual void setCurrentLogic(std::string logic);
+            virtual sptr_t<TheoryDeclarationLoader> getTheoryLoader();
+        };
+
+        /* ============================= TheoryDeclarationLoader ============================== */
+        /**
+         * Keeps the declarations of theories aside and checks each of them once its symbols are
+         * first needed. Declarations are checked against a stack of their own, which only holds
+         * the symbols of theories, so that the sorts of a script never change what a theory
+         * declares. Each declaration is checked once, and every stack that loads it, possibly
+         * at the same time, is given the same symbols.
+         */
+        class TheoryDeclarationLoader : public ISymbolLoader,
+                                        public std::enable_shared_from_this<TheoryDeclarationLoader> {
+        private:
+            /** Forwards to a loader without keeping it alive, for the declarations kept in the loader's own stack */
+            class WeakLoader : public ISymbolLoader {
+            private:
+                std::weak_ptr<TheoryDeclarationLoader> loader;
+            public:
+                inline WeakLoader(sptr_t<TheoryDeclarationLoader> loader) : loader(loader) { }
+
+                virtual void load(const std::string& name, sptr_t<AstNode> declaration,
+                                  sptr_v<SortInfo>& sorts, sptr_v<FunInfo>& funs);
+            };
+
+            /** Symbols added by a declaration (none yet while it is being checked) */
+            struct Symbols {
+                sptr_v<SortInfo> sorts;
+                sptr_v<FunInfo> funs;
+            };
+
+            sptr_t<SymbolStack> stack;
+            sptr_t<Configuration> config;
+            sptr_t<ISymbolLoader> weakLoader;
+            std::unordered_map<sptr_t<AstNode>, Symbols> symbols;
+
+            /** Held while a declaration is checked, which may need other declarations to be checked first */
+            std::recursive_mutex mutex;
+
+            /** Check a declaration against the stack of the loader, unless it was checked before, and get its symbols */
+            const Symbols& check(const std::string& name, sptr_t<AstNode> declaration);
+
+        public:
+            TheoryDeclarationLoader(sptr_t<Configuration> config);
+
+            /** Enable the built-in sorts and functions of a theory in the stack of the loader */
+            void enableBuiltins(const std::string& theory);
+
+            /** Keep a theory declaration aside in a stack and in the stack of the loader */
+            void addPendingSort(sptr_t<SymbolStack> stack, const std::string& name, sptr_t<AstNode> declaration);
+            void addPendingFun(sptr_t<SymbolStack> stack, const std::string& name, sptr_t<AstNode> declaration);
+
+            virtual void load(const std::string& name, sptr_t<AstNode> declaration,
+                              sptr_v<SortInfo>& sorts, sptr_v<FunInfo>& funs);
         };
 
         /* ================================ SortednessChecker ================================= */
         /** Visitor for checking sortedness */
         class SortednessChecker : public DummyAstVisitor0,
                                   public ITermSorterContext,
+                                  public IFusableVisitor,
                                   public std::enable_shared_from_this<SortednessChecker>{
         public:
+            /** Builds the message of an error from the arguments recorded when it was found */
+            typedef std::function<std::string()> MessageBuilder;
+
+            /** Error, kept as its code and its arguments until its message is needed */
             struct Error {
-                std::string message;
+                ErrorCode code;
+                MessageBuilder message;
                 sptr_t<SymbolInfo> info;
 
-                Error(std::string message) : message(message) { }
+                Error(ErrorCode code, MessageBuilder message) : code(code), message(message) { }
 
-                Error(std::string message, sptr_t<SymbolInfo> info)
-                        : message(message), info(info) { }
+                Error(ErrorCode code, MessageBuilder message, sptr_t<SymbolInfo> info)
+                        : code(code), message(message), info(info) { }
             };
 
+            /** Message built by a function taking a single string, such as ErrorMessages::buildFunAlreadyExists() */
+            static inline MessageBuilder message(std::string (*build)(std::string), std::string arg) {
+                return [build, arg] { return build(arg); };
+            }
+
             struct NodeError {
                 sptr_v<Error> errs;
-                sptr_t<AstNode> node;
+                AstNode* node;
+
+                /** Whether the errors are kept, rather than only counted because of the limit */
+                bool kept;
 
-                NodeError() { }
+                NodeError() : kept(false) { }
 
-                NodeError(sptr_t<Error> err, sptr_t<AstNode> node) : node(node) {
+                NodeError(sptr_t<Error> err, AstNode* node) : node(node), kept(false) {
                     errs.push_back(err);
                 }
 
-                NodeError(sptr_v<Error> &errs, sptr_t<AstNode> node) : node(node) {
+                NodeError(sptr_v<Error> &errs, AstNode* node) : node(node), kept(false) {
                     this->errs.insert(this->errs.begin(), errs.begin(), errs.end());
                 }
             };
@@ -83,77 +166,191 @@ namespace smtlib {
         private:
             sptr_t<ISortCheckContext> ctx;
             std::map<std::string, sptr_v<NodeError>> errors;
+            bool lazyTheoryLoading;
+            bool parallelChecking;
+
+            /** Number of errors found, including those not kept because of the limit */
+            unsigned long errorCount;
+
+            /** Maximum number of errors kept (none if 0) */
+            unsigned long errorLimit;
+
+            /** Keep an error found for a node, unless the limit has been reached */
+            void keepError(sptr_t<NodeError> err, AstNode* node);
+
+            /** Where errors are written as soon as they are kept (none if empty) */
+            sptr_t<DiagnosticWriter> diagnostics;
+
+            /** Write a kept error to the diagnostics, if there are any */
+            void report(sptr_t<Error> err, AstNode* node);
+
+            /** Whether errors are held back from the diagnostics, until writeHeldDiagnostics() */
+            bool holdingDiagnostics;
+
+            /** Errors held back from the diagnostics, in the order in which they were kept */
+            std::vector<std::pair<sptr_t<Error>, AstNode*>> heldDiagnostics;
+
+            /** Commands kept aside to be checked together, none of which changes the context */
+            std::vector<AstNode*> batch;
+
+            /**
+             * Check the commands kept aside, in order. Long runs are split into parts checked
+             * concurrently by the shared pool, each thread against its own snapshot of the stack.
+             */
+            void checkBatch();
+
+            sptr_t<SortInfo> getInfo(SortSymbolDeclaration* node);
+            sptr_t<SortInfo> getInfo(DeclareSortCommand* node);
+            sptr_t<SortInfo> getInfo(DefineSortCommand* node);
+
+            sptr_t<FunInfo> getInfo(SpecConstFunDeclaration* node);
+            sptr_t<FunInfo> getInfo(MetaSpecConstFunDeclaration* node);
+            sptr_t<FunInfo> getInfo(SimpleFunDeclaration* node);
+            sptr_t<FunInfo> getInfo(ParametricFunDeclaration* node);
+            sptr_t<FunInfo> getInfo(DeclareConstCommand* node);
+            sptr_t<FunInfo> getInfo(DeclareFunCommand* node);
+            sptr_t<FunInfo> getInfo(DefineFunCommand* node);
+            sptr_t<FunInfo> getInfo(DefineFunRecCommand* node);
+            sptr_v<FunInfo> getInfo(DefineFunsRecCommand* node);
+
+            sptr_v<SymbolInfo> getInfo(DeclareDatatypeCommand* node);
+            sptr_v<SymbolInfo> getInfo(DeclareDatatypesCommand* node);
+
+            /**
+             * Theory whose file has been parsed and is having its syntax checked. A load that
+             * is dropped (when parsing another theory fails) waits for its check to be done.
+             */
+            struct TheoryLoad {
+                std::string theory;
+                std::string path;
+                bool found;
+                sptr_t<AstNode> ast;
+                std::future<std::string> syntaxErrors;
+
+                TheoryLoad() : found(false) { }
+                TheoryLoad(TheoryLoad&&) = default;
+                TheoryLoad& operator=(TheoryLoad&&) = default;
+
+                ~TheoryLoad() {
+                    if (syntaxErrors.valid())
+                        syntaxErrors.wait();
+                }
+            };
 
-            sptr_t<SortInfo> getInfo(sptr_t<SortSymbolDeclaration> node);
-            sptr_t<SortInfo> getInfo(sptr_t<DeclareSortCommand> node);
-            sptr_t<SortInfo> getInfo(sptr_t<DefineSortCommand> node);
+            void loadTheory(std::string theory, AstNode* node, sptr_t<NodeError> err);
 
-            sptr_t<FunInfo> getInfo(sptr_t<SpecConstFunDeclaration> node);
-            sptr_t<FunInfo> getInfo(sptr_t<MetaSpecConstFunDeclaration> node);
-            sptr_t<FunInfo> getInfo(sptr_t<SimpleFunDeclaration> node);
-            sptr_t<FunInfo> getInfo(sptr_t<ParametricFunDeclaration> node);
-            sptr_t<FunInfo> getInfo(sptr_t<DeclareConstCommand> node);
-            sptr_t<FunInfo> getInfo(sptr_t<DeclareFunCommand> node);
-            sptr_t<FunInfo> getInfo(sptr_t<DefineFunCommand> node);
-            sptr_t<FunInfo> getInfo(sptr_t<DefineFunRecCommand> node);
-            sptr_v<FunInfo> getInfo(sptr_t<DefineFunsRecCommand> node);
+            /** Parse the file of a theory and start checking its syntax in the background */
+            TheoryLoad startLoad(std::string theory);
 
-            sptr_v<SymbolInfo> getInfo(sptr_t<DeclareDatatypeCommand> node);
-            sptr_v<SymbolInfo> getInfo(sptr_t<DeclareDatatypesCommand> node);
+            /** Wait for the syntax check of a theory file, then add its symbols */
+            void finishLoad(TheoryLoad& load, AstNode* node, sptr_t<NodeError> err);
 
-            void loadTheory(std::string theory, sptr_t<AstNode> node, sptr_t<NodeError> err);
+            void loadLogic(std::string logic, AstNode* node, sptr_t<NodeError> err);
 
-            void loadLogic(std::string logic, sptr_t<AstNode> node, sptr_t<NodeError> err);
+            /** Keep the sort and function declarations of a theory aside, until their symbols are needed */
+            void addPending(sptr_v<AttributeValue>& declarations);
 
         public:
-            inline SortednessChecker() : ctx(std::make_shared<SortednessCheckerContext>()) { }
-
-            inline SortednessChecker(sptr_t<ISortCheckContext> ctx) : ctx(ctx) { }
-
-            sptr_t<NodeError> addError(std::string message, sptr_t<AstNode> node, sptr_t<NodeError> err);
-
-            sptr_t<NodeError> addError(std::string message, sptr_t<AstNode> node,
+            inline SortednessChecker()
+                    : ctx(std::make_shared<SortednessCheckerContext>()), lazyTheoryLoading(false),
+                      parallelChecking(false), errorCount(0), errorLimit(0), holdingDiagnostics(false) { }
+
+            inline SortednessChecker(sptr_t<ISortCheckContext> ctx)
+                    : ctx(ctx), lazyTheoryLoading(false), parallelChecking(false), errorCount(0), errorLimit(0),
+                      holdingDiagnostics(false) { }
+
+            /** Set whether theory declarations are only checked once their symbols are needed */
+            inline void setLazyTheoryLoading(bool lazy) { lazyTheoryLoading = lazy; }
+
+            /**
+             * Set whether runs of assertions (and get-value commands) of a script are checked
+             * concurrently, and so are the arguments of large terms (see TermSorter). The commands
+             * of a run are only checked once the run ends, so the nodes given to visitPart() must
+             * stay alive until the next command changing the context, or until leave().
+             */
+            inline void setParallelChecking(bool parallel) { parallelChecking = parallel; }
+
+            /** Whether runs of assertions, and the arguments of large terms, are checked concurrently */
+            inline bool isParallelChecking() { return parallelChecking; }
+
+            /**
+             * Set the maximum number of errors kept (none if 0). Once it has been reached,
+             * further errors are only counted and no further parts are checked.
+             */
+            inline void setErrorLimit(unsigned long limit) { errorLimit = limit; }
+
+            inline unsigned long getErrorLimit() { return errorLimit; }
+
+            /** Whether as many errors as the limit allows have been kept */
+            inline bool isErrorLimitReached() { return errorLimit > 0 && errorCount >= errorLimit; }
+
+            /**
+             * Set where errors are written as soon as they are kept. Errors found concurrently
+             * are written once they are put together with the others, in order.
+             */
+            inline void setDiagnostics(sptr_t<DiagnosticWriter> writer) { diagnostics = writer; }
+
+            /**
+             * Set whether errors are held back from the diagnostics until writeHeldDiagnostics()
+             * is called, for when they should only be written if another check succeeds
+             */
+            inline void setHoldingDiagnostics(bool hold) { holdingDiagnostics = hold; }
+
+            /** Write the errors held back to the diagnostics */
+            void writeHeldDiagnostics();
+
+            /**
+             * Add an error found for a node, or another error to the ones already found for it
+             * \return The errors found for the node so far
+             */
+            sptr_t<NodeError> addError(ErrorCode code, MessageBuilder message, AstNode* node, sptr_t<NodeError> err);
+
+            sptr_t<NodeError> addError(ErrorCode code, MessageBuilder message, AstNode* node,
                                        sptr_t<SymbolInfo> symbolInfo, sptr_t<NodeError> err);
 
-            void addError(std::string message, sptr_t<AstNode> node);
-            void addError(std::string message, sptr_t<AstNode> node, sptr_t<SymbolInfo> err);
+            void addError(ErrorCode code, MessageBuilder message, AstNode* node);
+            void addError(ErrorCode code, MessageBuilder message, AstNode* node, sptr_t<SymbolInfo> err);
+
+            /** Add the errors found by another checker, after those found so far */
+            void addErrors(sptr_t<SortednessChecker> other);
 
             void loadTheory(std::string theory);
 
-            sptr_t<NodeError> checkSort(sptr_t<Sort> sort, sptr_t<AstNode> source,
+            sptr_t<NodeError> checkSort(sptr_t<Sort> sort, AstNode* source,
                                         sptr_t<NodeError> err);
 
             sptr_t<NodeError> checkSort(sptr_v<Symbol> &params, sptr_t<Sort> sort,
-                                        sptr_t<AstNode> source, sptr_t<NodeError> err);
-
-            virtual void visit(sptr_t<AssertCommand> node);
-            virtual void visit(sptr_t<DeclareConstCommand> node);
-            virtual void visit(sptr_t<DeclareFunCommand> node);
-            virtual void visit(sptr_t<DeclareDatatypeCommand> node);
-            virtual void visit(sptr_t<DeclareDatatypesCommand> node);
-            virtual void visit(sptr_t<DeclareSortCommand> node);
-            virtual void visit(sptr_t<DefineFunCommand> node);
-            virtual void visit(sptr_t<DefineFunRecCommand> node);
-            virtual void visit(sptr_t<DefineFunsRecCommand> node);
-            virtual void visit(sptr_t<DefineSortCommand> node);
-            virtual void visit(sptr_t<GetValueCommand> node);
-            virtual void visit(sptr_t<PopCommand> node);
-            virtual void visit(sptr_t<PushCommand> node);
-            virtual void visit(sptr_t<ResetCommand> node);
-            virtual void visit(sptr_t<SetLogicCommand> node);
-
-            virtual void visit(sptr_t<Logic> node);
-            virtual void visit(sptr_t<Theory> node);
-            virtual void visit(sptr_t<Script> node);
-
-            virtual void visit(sptr_t<SortSymbolDeclaration> node);
-            virtual void visit(sptr_t<SpecConstFunDeclaration> node);
-            virtual void visit(sptr_t<MetaSpecConstFunDeclaration> node);
-            virtual void visit(sptr_t<SimpleFunDeclaration> node);
-            virtual void visit(sptr_t<ParametricFunDeclaration> node);
+                                        AstNode* source, sptr_t<NodeError> err);
+
+            virtual void visit(AssertCommand* node);
+            virtual void visit(DeclareConstCommand* node);
+            virtual void visit(DeclareFunCommand* node);
+            virtual void visit(DeclareDatatypeCommand* node);
+            virtual void visit(DeclareDatatypesCommand* node);
+            virtual void visit(DeclareSortCommand* node);
+            virtual void visit(DefineFunCommand* node);
+            virtual void visit(DefineFunRecCommand* node);
+            virtual void visit(DefineFunsRecCommand* node);
+            virtual void visit(DefineSortCommand* node);
+            virtual void visit(GetValueCommand* node);
+            virtual void visit(PopCommand* node);
+            virtual void visit(PushCommand* node);
+            virtual void visit(ResetCommand* node);
+            virtual void visit(SetLogicCommand* node);
+
+            virtual void visit(Logic* node);
+            virtual void visit(Theory* node);
+            virtual void visit(Script* node);
+
+            virtual void visit(SortSymbolDeclaration* node);
+            virtual void visit(SpecConstFunDeclaration* node);
+            virtual void visit(MetaSpecConstFunDeclaration* node);
+            virtual void visit(SimpleFunDeclaration* node);
+            virtual void visit(ParametricFunDeclaration* node);
 
             bool check(sptr_t<AstNode> node);
 
+            /** Report of the errors kept, with their messages built at this point */
             std::string getErrors();
 
             // ITermSorterContext implementation
@@ -162,6 +359,13 @@ namespace smtlib {
             virtual sptr_t<SortednessChecker> getChecker();
 
             virtual sptr_t<Configuration> getConfiguration();
+
+            // IFusableVisitor implementation
+            virtual void visitPart(AstNode* part);
+
+            virtual void leave();
+
+            virtual unsigned long getErrorCount();
         };
     }
 }
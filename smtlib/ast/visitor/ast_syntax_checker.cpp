@@ -1,4 +1,5 @@
 #include "ast_syntax_checker.h"
+#include "ast_printer.h"
 #include "ast/ast_attribute.h"
 #include "ast/ast_command.h"
 #include "ast/ast_logic.h"
@@ -9,6 +10,8 @@
 #include "ast/ast_theory.h"
 #include "util/error_messages.h"
 #include "util/global_values.h"
+#include "util/symbol_syntax.h"
+#include "util/thread_pool.h"
 
 #include <iostream>
 
@@ -16,8 +19,16 @@ using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
+// Scripts are split among at most one task for every this many commands, so that
+// handing commands over to a worker is worth it
+static const unsigned long MIN_TASK_COMMANDS = 256;
+
+// Scripts are split into this many parts for each task, so that a task that is done
+// early can take over parts from slower ones
+static const unsigned long PARTS_PER_TASK = 8;
+
 sptr_t<SyntaxChecker::Error>
-SyntaxChecker::addError(string message, sptr_t<AstNode> node,
+SyntaxChecker::addError(string message, AstNode* node,
                         sptr_t<SyntaxChecker::Error> err) {
     if (!err) {
         err = make_shared<Error>(message, node);
@@ -26,14 +37,27 @@ SyntaxChecker::addError(string message, sptr_t<AstNode> node,
         err->messages.push_back(message);
     }
 
+    report(message, err->node);
     return err;
 }
 
+void SyntaxChecker::report(const string& message, AstNode* node) {
+    if (!diagnostics)
+        return;
+
+    if (node) {
+        diagnostics->write(ERROR_SYNTAX, node->getFilename(), node->getRowLeft(), node->getColLeft(),
+                           node->getRowRight(), node->getColRight(), message);
+    } else {
+        diagnostics->write(ERROR_SYNTAX, NULL, 0, 0, 0, 0, message);
+    }
+}
+
 sptr_t<SyntaxChecker::Error>
 SyntaxChecker::checkParamUsage(sptr_v<Symbol> &params,
                                unordered_map<string, bool> &paramUsage,
                                sptr_t<Sort> sort,
-                               sptr_t<AstNode> source,
+                               AstNode* source,
                                sptr_t<Error> err) {
     if (!sort)
         return err;
@@ -61,7 +85,7 @@ SyntaxChecker::checkParamUsage(sptr_v<Symbol> &params,
     return err;
 }
 
-void SyntaxChecker::visit(sptr_t<Attribute> node) {
+void SyntaxChecker::visit(Attribute* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -78,7 +102,7 @@ void SyntaxChecker::visit(sptr_t<Attribute> node) {
     visit0(node->getValue());
 }
 
-void SyntaxChecker::visit(sptr_t<CompAttributeValue> node) {
+void SyntaxChecker::visit(CompAttributeValue* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -89,7 +113,7 @@ void SyntaxChecker::visit(sptr_t<CompAttributeValue> node) {
     visit0(node->getValues());
 }
 
-void SyntaxChecker::visit(sptr_t<Symbol> node) {
+void SyntaxChecker::visit(Symbol* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -97,12 +121,12 @@ void SyntaxChecker::visit(sptr_t<Symbol> node) {
         return;
     }
 
-    if (!regex_match(node->getValue(), regexSymbol)) {
+    if (!node->isValidated() && !SymbolSyntax::isSymbol(node->getValue())) {
         err = addError(ErrorMessages::ERR_SYMBOL_MALFORMED, node, err);
     }
 }
 
-void SyntaxChecker::visit(sptr_t<Keyword> node) {
+void SyntaxChecker::visit(Keyword* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -110,12 +134,12 @@ void SyntaxChecker::visit(sptr_t<Keyword> node) {
         return;
     }
 
-    if (!regex_match(node->getValue(), regexKeyword)) {
+    if (!node->isValidated() && !SymbolSyntax::isKeyword(node->getValue())) {
         err = addError(ErrorMessages::ERR_KEYWORD_MALFORMED, node, err);
     }
 }
 
-void SyntaxChecker::visit(sptr_t<MetaSpecConstant> node) {
+void SyntaxChecker::visit(MetaSpecConstant* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -124,7 +148,7 @@ void SyntaxChecker::visit(sptr_t<MetaSpecConstant> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<BooleanValue> node) {
+void SyntaxChecker::visit(BooleanValue* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -133,7 +157,7 @@ void SyntaxChecker::visit(sptr_t<BooleanValue> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<PropLiteral> node) {
+void SyntaxChecker::visit(PropLiteral* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -148,7 +172,7 @@ void SyntaxChecker::visit(sptr_t<PropLiteral> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<AssertCommand> node) {
+void SyntaxChecker::visit(AssertCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -163,7 +187,7 @@ void SyntaxChecker::visit(sptr_t<AssertCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<CheckSatCommand> node) {
+void SyntaxChecker::visit(CheckSatCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -172,7 +196,7 @@ void SyntaxChecker::visit(sptr_t<CheckSatCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<CheckSatAssumCommand> node) {
+void SyntaxChecker::visit(CheckSatAssumCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -183,7 +207,7 @@ void SyntaxChecker::visit(sptr_t<CheckSatAssumCommand> node) {
     visit0(node->getAssumptions());
 }
 
-void SyntaxChecker::visit(sptr_t<DeclareConstCommand> node) {
+void SyntaxChecker::visit(DeclareConstCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -205,7 +229,7 @@ void SyntaxChecker::visit(sptr_t<DeclareConstCommand> node) {
 }
 
 
-void SyntaxChecker::visit(sptr_t<DeclareDatatypeCommand> node) {
+void SyntaxChecker::visit(DeclareDatatypeCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -226,7 +250,7 @@ void SyntaxChecker::visit(sptr_t<DeclareDatatypeCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
+void SyntaxChecker::visit(DeclareDatatypesCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -270,7 +294,7 @@ void SyntaxChecker::visit(sptr_t<DeclareDatatypesCommand> node) {
     visit0(node->getDeclarations());
 }
 
-void SyntaxChecker::visit(sptr_t<DeclareFunCommand> node) {
+void SyntaxChecker::visit(DeclareFunCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -293,7 +317,7 @@ void SyntaxChecker::visit(sptr_t<DeclareFunCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<DeclareSortCommand> node) {
+void SyntaxChecker::visit(DeclareSortCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -314,7 +338,7 @@ void SyntaxChecker::visit(sptr_t<DeclareSortCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<DefineFunCommand> node) {
+void SyntaxChecker::visit(DefineFunCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -329,7 +353,7 @@ void SyntaxChecker::visit(sptr_t<DefineFunCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<DefineFunRecCommand> node) {
+void SyntaxChecker::visit(DefineFunRecCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -344,7 +368,7 @@ void SyntaxChecker::visit(sptr_t<DefineFunRecCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<DefineFunsRecCommand> node) {
+void SyntaxChecker::visit(DefineFunsRecCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -373,7 +397,7 @@ void SyntaxChecker::visit(sptr_t<DefineFunsRecCommand> node) {
     visit0(node->getDeclarations());
 }
 
-void SyntaxChecker::visit(sptr_t<DefineSortCommand> node) {
+void SyntaxChecker::visit(DefineSortCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -415,7 +439,7 @@ void SyntaxChecker::visit(sptr_t<DefineSortCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<EchoCommand> node) {
+void SyntaxChecker::visit(EchoCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -429,7 +453,7 @@ void SyntaxChecker::visit(sptr_t<EchoCommand> node) {
 
 }
 
-void SyntaxChecker::visit(sptr_t<ExitCommand> node) {
+void SyntaxChecker::visit(ExitCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -438,7 +462,7 @@ void SyntaxChecker::visit(sptr_t<ExitCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetAssertsCommand> node) {
+void SyntaxChecker::visit(GetAssertsCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -447,7 +471,7 @@ void SyntaxChecker::visit(sptr_t<GetAssertsCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetAssignsCommand> node) {
+void SyntaxChecker::visit(GetAssignsCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -456,7 +480,7 @@ void SyntaxChecker::visit(sptr_t<GetAssignsCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetInfoCommand> node) {
+void SyntaxChecker::visit(GetInfoCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -471,7 +495,7 @@ void SyntaxChecker::visit(sptr_t<GetInfoCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetModelCommand> node) {
+void SyntaxChecker::visit(GetModelCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -480,7 +504,7 @@ void SyntaxChecker::visit(sptr_t<GetModelCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetOptionCommand> node) {
+void SyntaxChecker::visit(GetOptionCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -495,7 +519,7 @@ void SyntaxChecker::visit(sptr_t<GetOptionCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetProofCommand> node) {
+void SyntaxChecker::visit(GetProofCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -504,7 +528,7 @@ void SyntaxChecker::visit(sptr_t<GetProofCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetUnsatAssumsCommand> node) {
+void SyntaxChecker::visit(GetUnsatAssumsCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -513,7 +537,7 @@ void SyntaxChecker::visit(sptr_t<GetUnsatAssumsCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetUnsatCoreCommand> node) {
+void SyntaxChecker::visit(GetUnsatCoreCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -522,7 +546,7 @@ void SyntaxChecker::visit(sptr_t<GetUnsatCoreCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<GetValueCommand> node) {
+void SyntaxChecker::visit(GetValueCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -537,7 +561,7 @@ void SyntaxChecker::visit(sptr_t<GetValueCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<PopCommand> node) {
+void SyntaxChecker::visit(PopCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -552,7 +576,7 @@ void SyntaxChecker::visit(sptr_t<PopCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<PushCommand> node) {
+void SyntaxChecker::visit(PushCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -567,7 +591,7 @@ void SyntaxChecker::visit(sptr_t<PushCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<ResetCommand> node) {
+void SyntaxChecker::visit(ResetCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -576,7 +600,7 @@ void SyntaxChecker::visit(sptr_t<ResetCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<ResetAssertsCommand> node) {
+void SyntaxChecker::visit(ResetAssertsCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -585,7 +609,7 @@ void SyntaxChecker::visit(sptr_t<ResetAssertsCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<SetInfoCommand> node) {
+void SyntaxChecker::visit(SetInfoCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -600,7 +624,7 @@ void SyntaxChecker::visit(sptr_t<SetInfoCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<SetLogicCommand> node) {
+void SyntaxChecker::visit(SetLogicCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -613,7 +637,7 @@ void SyntaxChecker::visit(sptr_t<SetLogicCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<SetOptionCommand> node) {
+void SyntaxChecker::visit(SetOptionCommand* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -628,12 +652,12 @@ void SyntaxChecker::visit(sptr_t<SetOptionCommand> node) {
         if ((option->getKeyword()->getValue() == KW_DIAG_OUTPUT_CHANNEL
              || option->getKeyword()->getValue() == KW_REGULAR_OUTPUT_CHANNEL)
             && !dynamic_cast<StringLiteral *>(option->getValue().get())) {
-            err = addError(ErrorMessages::ERR_OPT_VALUE_STRING, option, err);
+            err = addError(ErrorMessages::ERR_OPT_VALUE_STRING, option.get(), err);
         } else if ((option->getKeyword()->getValue() == KW_RANDOM_SEED
                     || option->getKeyword()->getValue() == KW_VERBOSITY
                     || option->getKeyword()->getValue() == KW_REPROD_RESOURCE_LIMIT)
                    && !dynamic_cast<NumeralLiteral *>(option->getValue().get())) {
-            err = addError(ErrorMessages::ERR_OPT_VALUE_NUMERAL, option, err);
+            err = addError(ErrorMessages::ERR_OPT_VALUE_NUMERAL, option.get(), err);
         } else if ((option->getKeyword()->getValue() == KW_EXPAND_DEFS
                     || option->getKeyword()->getValue() == KW_GLOBAL_DECLS
                     || option->getKeyword()->getValue() == KW_INTERACTIVE_MODE
@@ -646,7 +670,7 @@ void SyntaxChecker::visit(sptr_t<SetOptionCommand> node) {
                     || option->getKeyword()->getValue() == KW_PROD_UNSAT_CORES)) {
             if (!option->getValue() || (option->getValue()->toString() != CONST_TRUE
                                         && option->getValue()->toString() != CONST_FALSE)) {
-                err = addError(ErrorMessages::ERR_OPT_VALUE_BOOLEAN, option, err);
+                err = addError(ErrorMessages::ERR_OPT_VALUE_BOOLEAN, option.get(), err);
             }
         }
 
@@ -654,7 +678,7 @@ void SyntaxChecker::visit(sptr_t<SetOptionCommand> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<FunctionDeclaration> node) {
+void SyntaxChecker::visit(FunctionDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -677,7 +701,7 @@ void SyntaxChecker::visit(sptr_t<FunctionDeclaration> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<FunctionDefinition> node) {
+void SyntaxChecker::visit(FunctionDefinition* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -698,7 +722,7 @@ void SyntaxChecker::visit(sptr_t<FunctionDefinition> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<SimpleIdentifier> node) {
+void SyntaxChecker::visit(SimpleIdentifier* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -719,7 +743,7 @@ void SyntaxChecker::visit(sptr_t<SimpleIdentifier> node) {
     visit0(node->getIndices());
 }
 
-void SyntaxChecker::visit(sptr_t<QualifiedIdentifier> node) {
+void SyntaxChecker::visit(QualifiedIdentifier* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -740,7 +764,7 @@ void SyntaxChecker::visit(sptr_t<QualifiedIdentifier> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<DecimalLiteral> node) {
+void SyntaxChecker::visit(DecimalLiteral* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -749,7 +773,7 @@ void SyntaxChecker::visit(sptr_t<DecimalLiteral> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<NumeralLiteral> node) {
+void SyntaxChecker::visit(NumeralLiteral* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -758,7 +782,7 @@ void SyntaxChecker::visit(sptr_t<NumeralLiteral> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<StringLiteral> node) {
+void SyntaxChecker::visit(StringLiteral* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -767,7 +791,7 @@ void SyntaxChecker::visit(sptr_t<StringLiteral> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<Logic> node) {
+void SyntaxChecker::visit(Logic* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -797,11 +821,11 @@ void SyntaxChecker::visit(sptr_t<Logic> node) {
             || attr->getKeyword()->getValue() == KW_VALUES
             || attr->getKeyword()->getValue() == KW_NOTES) {
             if (!dynamic_cast<StringLiteral *>(attr->getValue().get())) {
-                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_STRING, attr, attrerr);
+                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_STRING, attr.get(), attrerr);
             }
         } else if (attr->getKeyword()->getValue() == KW_THEORIES) {
             if (!dynamic_cast<CompAttributeValue *>(attr->getValue().get())) {
-                err = addError(ErrorMessages::ERR_ATTR_VALUE_THEORIES, attr, err);
+                err = addError(ErrorMessages::ERR_ATTR_VALUE_THEORIES, attr.get(), err);
             } else {
                 CompAttributeValue *val = dynamic_cast<CompAttributeValue *>(attr->getValue().get());
                 sptr_v<AttributeValue> values = val->getValues();
@@ -813,7 +837,8 @@ void SyntaxChecker::visit(sptr_t<Logic> node) {
 
                 for (auto valueIt = values.begin(); valueIt != values.begin(); valueIt++) {
                     if ((*valueIt) && !dynamic_cast<Symbol *>((*valueIt).get())) {
-                        attrerr = addError(ErrorMessages::buildAttrValueSymbol((*valueIt)->toString()), attr, attrerr);
+                        attrerr = addError(ErrorMessages::buildAttrValueSymbol((*valueIt)->toString()),
+                                           attr.get(), attrerr);
                     }
                 }
             }
@@ -823,7 +848,7 @@ void SyntaxChecker::visit(sptr_t<Logic> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<Theory> node) {
+void SyntaxChecker::visit(Theory* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -854,41 +879,41 @@ void SyntaxChecker::visit(sptr_t<Theory> node) {
             || attr->getKeyword()->getValue() == KW_VALUES
             || attr->getKeyword()->getValue() == KW_NOTES) {
             if (!dynamic_cast<StringLiteral *>(attr->getValue().get())) {
-                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_STRING, attr, attrerr);
+                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_STRING, attr.get(), attrerr);
             }
         } else if (attr->getKeyword()->getValue() == KW_SORTS) {
             if (!dynamic_cast<CompAttributeValue *>(attr->getValue().get())) {
-                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_SORTS, attr, attrerr);
+                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_SORTS, attr.get(), attrerr);
             } else {
                 CompAttributeValue *val = dynamic_cast<CompAttributeValue *>(attr->getValue().get());
                 sptr_v<AttributeValue> values = val->getValues();
 
                 if (values.empty()) {
-                    attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_SORTS_EMPTY, attr, attrerr);
+                    attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_SORTS_EMPTY, attr.get(), attrerr);
                 }
 
                 for (auto valueIt = values.begin(); valueIt != values.begin(); valueIt++) {
                     if ((*valueIt) && !dynamic_cast<SortSymbolDeclaration *>((*valueIt).get())) {
                         attrerr = addError(
-                                ErrorMessages::buildAttrValueSortDecl((*valueIt)->toString()), attr, attrerr);
+                                ErrorMessages::buildAttrValueSortDecl((*valueIt)->toString()), attr.get(), attrerr);
                     }
                 }
             }
         } else if (attr->getKeyword()->getValue() == KW_FUNS) {
             if (!dynamic_cast<CompAttributeValue *>(attr->getValue().get())) {
-                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_FUNS, attr, attrerr);
+                attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_FUNS, attr.get(), attrerr);
             } else {
                 CompAttributeValue *val = dynamic_cast<CompAttributeValue *>(attr->getValue().get());
                 sptr_v<AttributeValue> values = val->getValues();
 
                 if (values.empty()) {
-                    attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_FUNS_EMPTY, attr, attrerr);
+                    attrerr = addError(ErrorMessages::ERR_ATTR_VALUE_FUNS_EMPTY, attr.get(), attrerr);
                 }
 
                 for (auto valueIt = values.begin(); valueIt != values.begin(); valueIt++) {
                     if ((*valueIt) && !dynamic_cast<FunSymbolDeclaration *>((*valueIt).get())) {
                         attrerr = addError(
-                                ErrorMessages::buildAttrValueFunDecl((*valueIt)->toString()), attr, attrerr);
+                                ErrorMessages::buildAttrValueFunDecl((*valueIt)->toString()), attr.get(), attrerr);
                     }
                 }
             }
@@ -898,7 +923,7 @@ void SyntaxChecker::visit(sptr_t<Theory> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<Script> node) {
+void SyntaxChecker::visit(Script* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -906,10 +931,46 @@ void SyntaxChecker::visit(sptr_t<Script> node) {
         return;
     }
 
-    visit0(node->getCommands());
+    if (parallelChecking)
+        checkParallel(node->getCommands());
+    else
+        visit0(node->getCommands());
 }
 
-void SyntaxChecker::visit(sptr_t<Sort> node) {
+void SyntaxChecker::checkParallel(sptr_v<Command>& commands) {
+    ThreadPool& pool = ThreadPool::getShared();
+    unsigned long size = commands.size();
+    unsigned long taskCount = min(pool.getSize() + 1, size / MIN_TASK_COMMANDS);
+
+    if (taskCount < 2) {
+        visit0(commands);
+        return;
+    }
+
+    unsigned long partCount = min(size, taskCount * PARTS_PER_TASK);
+    vector<sptr_t<SyntaxChecker>> results(partCount);
+
+    pool.forEach(partCount, taskCount, [&commands, size, partCount, &results](unsigned long task,
+                                                                            unsigned long part) {
+        sptr_t<SyntaxChecker> chk = make_shared<SyntaxChecker>();
+        for (unsigned long i = part * size / partCount; i < (part + 1) * size / partCount; i++) {
+            chk->visit0(commands[i]);
+        }
+        results[part] = chk;
+    });
+
+    for (auto resultIt = results.begin(); resultIt != results.end(); resultIt++) {
+        errors.insert(errors.end(), (*resultIt)->errors.begin(), (*resultIt)->errors.end());
+
+        for (auto errIt = (*resultIt)->errors.begin(); errIt != (*resultIt)->errors.end(); errIt++) {
+            for (auto msgIt = (*errIt)->messages.begin(); msgIt != (*errIt)->messages.end(); msgIt++) {
+                report(*msgIt, (*errIt)->node);
+            }
+        }
+    }
+}
+
+void SyntaxChecker::visit(Sort* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -930,7 +991,7 @@ void SyntaxChecker::visit(sptr_t<Sort> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<CompSExpression> node) {
+void SyntaxChecker::visit(CompSExpression* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -941,7 +1002,7 @@ void SyntaxChecker::visit(sptr_t<CompSExpression> node) {
     visit0(node->getExpressions());
 }
 
-void SyntaxChecker::visit(sptr_t<SortSymbolDeclaration> node) {
+void SyntaxChecker::visit(SortSymbolDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -964,7 +1025,7 @@ void SyntaxChecker::visit(sptr_t<SortSymbolDeclaration> node) {
     visit0(node->getAttributes());
 }
 
-void SyntaxChecker::visit(sptr_t<SpecConstFunDeclaration> node) {
+void SyntaxChecker::visit(SpecConstFunDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -987,7 +1048,7 @@ void SyntaxChecker::visit(sptr_t<SpecConstFunDeclaration> node) {
     visit0(node->getAttributes());
 }
 
-void SyntaxChecker::visit(sptr_t<MetaSpecConstFunDeclaration> node) {
+void SyntaxChecker::visit(MetaSpecConstFunDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1010,7 +1071,7 @@ void SyntaxChecker::visit(sptr_t<MetaSpecConstFunDeclaration> node) {
     visit0(node->getAttributes());
 }
 
-void SyntaxChecker::visit(sptr_t<SimpleFunDeclaration> node) {
+void SyntaxChecker::visit(SimpleFunDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1033,7 +1094,7 @@ void SyntaxChecker::visit(sptr_t<SimpleFunDeclaration> node) {
     visit0(node->getAttributes());
 }
 
-void SyntaxChecker::visit(sptr_t<ParametricFunDeclaration> node) {
+void SyntaxChecker::visit(ParametricFunDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1086,7 +1147,7 @@ void SyntaxChecker::visit(sptr_t<ParametricFunDeclaration> node) {
     visit0(node->getAttributes());
 }
 
-void SyntaxChecker::visit(sptr_t<SortDeclaration> node) {
+void SyntaxChecker::visit(SortDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1107,7 +1168,7 @@ void SyntaxChecker::visit(sptr_t<SortDeclaration> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<SelectorDeclaration> node) {
+void SyntaxChecker::visit(SelectorDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1128,7 +1189,7 @@ void SyntaxChecker::visit(sptr_t<SelectorDeclaration> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<ConstructorDeclaration> node) {
+void SyntaxChecker::visit(ConstructorDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1149,7 +1210,7 @@ void SyntaxChecker::visit(sptr_t<ConstructorDeclaration> node) {
 }
 
 
-void SyntaxChecker::visit(sptr_t<SimpleDatatypeDeclaration> node) {
+void SyntaxChecker::visit(SimpleDatatypeDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1165,7 +1226,7 @@ void SyntaxChecker::visit(sptr_t<SimpleDatatypeDeclaration> node) {
 
 }
 
-void SyntaxChecker::visit(sptr_t<ParametricDatatypeDeclaration> node) {
+void SyntaxChecker::visit(ParametricDatatypeDeclaration* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1208,7 +1269,7 @@ void SyntaxChecker::visit(sptr_t<ParametricDatatypeDeclaration> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<QualifiedConstructor> node) {
+void SyntaxChecker::visit(QualifiedConstructor* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1229,7 +1290,7 @@ void SyntaxChecker::visit(sptr_t<QualifiedConstructor> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<QualifiedPattern> node) {
+void SyntaxChecker::visit(QualifiedPattern* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1250,7 +1311,7 @@ void SyntaxChecker::visit(sptr_t<QualifiedPattern> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<MatchCase> node) {
+void SyntaxChecker::visit(MatchCase* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1271,7 +1332,7 @@ void SyntaxChecker::visit(sptr_t<MatchCase> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<QualifiedTerm> node) {
+void SyntaxChecker::visit(QualifiedTerm* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1292,7 +1353,7 @@ void SyntaxChecker::visit(sptr_t<QualifiedTerm> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<LetTerm> node) {
+void SyntaxChecker::visit(LetTerm* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1316,7 +1377,7 @@ void SyntaxChecker::visit(sptr_t<LetTerm> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<ForallTerm> node) {
+void SyntaxChecker::visit(ForallTerm* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1340,7 +1401,7 @@ void SyntaxChecker::visit(sptr_t<ForallTerm> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<ExistsTerm> node) {
+void SyntaxChecker::visit(ExistsTerm* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1364,7 +1425,7 @@ void SyntaxChecker::visit(sptr_t<ExistsTerm> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<MatchTerm> node) {
+void SyntaxChecker::visit(MatchTerm* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1388,7 +1449,7 @@ void SyntaxChecker::visit(sptr_t<MatchTerm> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<AnnotatedTerm> node) {
+void SyntaxChecker::visit(AnnotatedTerm* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1409,7 +1470,7 @@ void SyntaxChecker::visit(sptr_t<AnnotatedTerm> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<SortedVariable> node) {
+void SyntaxChecker::visit(SortedVariable* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1430,7 +1491,7 @@ void SyntaxChecker::visit(sptr_t<SortedVariable> node) {
     }
 }
 
-void SyntaxChecker::visit(sptr_t<VarBinding> node) {
+void SyntaxChecker::visit(VarBinding* node) {
     sptr_t<Error> err;
 
     if (!node) {
@@ -1456,6 +1517,14 @@ bool SyntaxChecker::check(sptr_t<AstNode> node) {
     return errors.empty();
 }
 
+void SyntaxChecker::visitPart(AstNode* part) {
+    visit0(part);
+}
+
+unsigned long SyntaxChecker::getErrorCount() {
+    return errors.size();
+}
+
 string SyntaxChecker::getErrors() {
     stringstream ss;
     for (auto errIt = errors.begin(); errIt != errors.end(); errIt++) {
@@ -1464,11 +1533,7 @@ string SyntaxChecker::getErrors() {
             ss << err->node->getRowLeft() << ":" << err->node->getColLeft()
             << " - " << err->node->getRowRight() << ":" << err->node->getColRight() << "   ";
 
-            string nodestr = err->node->toString();
-            if (nodestr.length() > 100)
-                ss << string(nodestr, 0, 100) << "[...]";
-            else
-                ss << nodestr;
+            ss << AstPrinter::toString(err->node, 100);
         } else {
             ss << "NULL";
         }
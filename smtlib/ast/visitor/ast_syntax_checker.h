@@ -8,8 +8,9 @@
 #define SMTLIB_PARSER_AST_SYNTAX_CHECKER_H
 
 #include "ast_visitor.h"
+#include "ast_visitor_fused.h"
+#include "util/diagnostic_writer.h"
 
-#include <regex>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -17,130 +18,152 @@
 namespace smtlib {
     namespace ast {
         /** Visitor for checking syntax correctness */
-        class SyntaxChecker : public DummyAstVisitor0 {
+        class SyntaxChecker : public DummyAstVisitor0,
+                              public IFusableVisitor {
         private:
             struct Error {
                 std::vector<std::string> messages;
-                sptr_t<AstNode> node;
+                AstNode* node;
 
                 Error() { }
 
-                Error(std::string message, sptr_t<AstNode> node) : node(node) {
+                Error(std::string message, AstNode* node) : node(node) {
                     messages.push_back(message);
                 }
 
-                Error(std::vector<std::string>& messages, sptr_t<AstNode> node) : node(node) {
+                Error(std::vector<std::string>& messages, AstNode* node) : node(node) {
                     this->messages.insert(this->messages.begin(), messages.begin(), messages.end());
                 }
             };
 
             sptr_v<Error> errors;
+            bool parallelChecking;
 
-            const std::regex regexSymbol = std::regex(
-                    "^([a-zA-Z+\\-/*=%?!.$_~&^<>@][a-zA-Z0-9+\\-/*=%?!.$_~&^<>@]*)"
-                            "|(\\|[\\x20-\\x5B\\x5D-\\x7B\\x7D\\x7E\\xA0-\\xFF\\x09\\r\\n \\xA0]*\\|)$"
-            );
-            const std::regex regexKeyword = std::regex(
-                    "^:([a-zA-Z+\\-/*=%?!.$_~&^<>@][a-zA-Z0-9+\\-/*=%?!.$_~&^<>@]*)"
-                            "|(\\|[\\x20-\\x5B\\x5D-\\x7B\\x7D\\x7E\\xA0-\\xFF\\x09\\r\\n \\xA0]*\\|)$"
-            );
+            /** Where errors are written as soon as they are found (none if empty) */
+            sptr_t<DiagnosticWriter> diagnostics;
 
-            sptr_t<Error> addError(std::string message, sptr_t<AstNode> node,
+            /** Write an error to the diagnostics, if there are any */
+            void report(const std::string& message, AstNode* node);
+
+            /**
+             * Check the commands of a script, split into parts checked concurrently by the
+             * shared pool. The rules only look at the command being checked, so each part is
+             * checked on its own, and the errors of the parts are put together in order.
+             */
+            void checkParallel(sptr_v<Command>& commands);
+
+            sptr_t<Error> addError(std::string message, AstNode* node,
                                                        sptr_t<Error> err);
 
             sptr_t<Error> checkParamUsage(sptr_v<Symbol> &params,
                                           std::unordered_map<std::string, bool> &paramUsage,
                                           sptr_t<Sort> sort,
-                                          sptr_t<AstNode> source,
+                                          AstNode* source,
                                           sptr_t<Error> err);
         public:
-            virtual void visit(sptr_t<Attribute> node);
-            virtual void visit(sptr_t<CompAttributeValue> node);
-
-            virtual void visit(sptr_t<Symbol> node);
-            virtual void visit(sptr_t<Keyword> node);
-            virtual void visit(sptr_t<MetaSpecConstant> node);
-            virtual void visit(sptr_t<BooleanValue> node);
-            virtual void visit(sptr_t<PropLiteral> node);
-
-            virtual void visit(sptr_t<AssertCommand> node);
-            virtual void visit(sptr_t<CheckSatCommand> node);
-            virtual void visit(sptr_t<CheckSatAssumCommand> node);
-            virtual void visit(sptr_t<DeclareConstCommand> node);
-            virtual void visit(sptr_t<DeclareDatatypeCommand> node);
-            virtual void visit(sptr_t<DeclareDatatypesCommand> node);
-            virtual void visit(sptr_t<DeclareFunCommand> node);
-            virtual void visit(sptr_t<DeclareSortCommand> node);
-            virtual void visit(sptr_t<DefineFunCommand> node);
-            virtual void visit(sptr_t<DefineFunRecCommand> node);
-            virtual void visit(sptr_t<DefineFunsRecCommand> node);
-            virtual void visit(sptr_t<DefineSortCommand> node);
-            virtual void visit(sptr_t<EchoCommand> node);
-            virtual void visit(sptr_t<ExitCommand> node);
-            virtual void visit(sptr_t<GetAssertsCommand> node);
-            virtual void visit(sptr_t<GetAssignsCommand> node);
-            virtual void visit(sptr_t<GetInfoCommand> node);
-            virtual void visit(sptr_t<GetModelCommand> node);
-            virtual void visit(sptr_t<GetOptionCommand> node);
-            virtual void visit(sptr_t<GetProofCommand> node);
-            virtual void visit(sptr_t<GetUnsatAssumsCommand> node);
-            virtual void visit(sptr_t<GetUnsatCoreCommand> node);
-            virtual void visit(sptr_t<GetValueCommand> node);
-            virtual void visit(sptr_t<PopCommand> node);
-            virtual void visit(sptr_t<PushCommand> node);
-            virtual void visit(sptr_t<ResetCommand> node);
-            virtual void visit(sptr_t<ResetAssertsCommand> node);
-            virtual void visit(sptr_t<SetInfoCommand> node);
-            virtual void visit(sptr_t<SetLogicCommand> node);
-            virtual void visit(sptr_t<SetOptionCommand> node);
-
-            virtual void visit(sptr_t<FunctionDeclaration> node);
-            virtual void visit(sptr_t<FunctionDefinition> node);
-
-            virtual void visit(sptr_t<SimpleIdentifier> node);
-            virtual void visit(sptr_t<QualifiedIdentifier> node);
-
-            virtual void visit(sptr_t<DecimalLiteral> node);
-            virtual void visit(sptr_t<NumeralLiteral> node);
-            virtual void visit(sptr_t<StringLiteral> node);
-
-            virtual void visit(sptr_t<Logic> node);
-            virtual void visit(sptr_t<Theory> node);
-            virtual void visit(sptr_t<Script> node);
-
-            virtual void visit(sptr_t<Sort> node);
-
-            virtual void visit(sptr_t<CompSExpression> node);
-
-            virtual void visit(sptr_t<SortSymbolDeclaration> node);
-            virtual void visit(sptr_t<SpecConstFunDeclaration> node);
-            virtual void visit(sptr_t<MetaSpecConstFunDeclaration> node);
-            virtual void visit(sptr_t<SimpleFunDeclaration> node);
-            virtual void visit(sptr_t<ParametricFunDeclaration> node);
-            virtual void visit(sptr_t<SortDeclaration> node);
-
-            virtual void visit(sptr_t<SelectorDeclaration> node);
-            virtual void visit(sptr_t<ConstructorDeclaration> node);
-            virtual void visit(sptr_t<SimpleDatatypeDeclaration> node);
-            virtual void visit(sptr_t<ParametricDatatypeDeclaration> node);
-
-            virtual void visit(sptr_t<QualifiedConstructor> node);
-            virtual void visit(sptr_t<QualifiedPattern> node);
-            virtual void visit(sptr_t<MatchCase> node);
-
-            virtual void visit(sptr_t<QualifiedTerm> node);
-            virtual void visit(sptr_t<LetTerm> node);
-            virtual void visit(sptr_t<ForallTerm> node);
-            virtual void visit(sptr_t<ExistsTerm> node);
-            virtual void visit(sptr_t<MatchTerm> node);
-            virtual void visit(sptr_t<AnnotatedTerm> node);
-
-            virtual void visit(sptr_t<SortedVariable> node);
-            virtual void visit(sptr_t<VarBinding> node);
+            inline SyntaxChecker() : parallelChecking(false) { }
+
+            /** Set whether the commands of a script are checked concurrently */
+            inline void setParallelChecking(bool parallel) { parallelChecking = parallel; }
+
+            /**
+             * Set where errors are written as soon as they are found. Errors found concurrently
+             * are written once they are put together with the others, in order.
+             */
+            inline void setDiagnostics(sptr_t<DiagnosticWriter> writer) { diagnostics = writer; }
+
+            virtual void visit(Attribute* node);
+            virtual void visit(CompAttributeValue* node);
+
+            virtual void visit(Symbol* node);
+            virtual void visit(Keyword* node);
+            virtual void visit(MetaSpecConstant* node);
+            virtual void visit(BooleanValue* node);
+            virtual void visit(PropLiteral* node);
+
+            virtual void visit(AssertCommand* node);
+            virtual void visit(CheckSatCommand* node);
+            virtual void visit(CheckSatAssumCommand* node);
+            virtual void visit(DeclareConstCommand* node);
+            virtual void visit(DeclareDatatypeCommand* node);
+            virtual void visit(DeclareDatatypesCommand* node);
+            virtual void visit(DeclareFunCommand* node);
+            virtual void visit(DeclareSortCommand* node);
+            virtual void visit(DefineFunCommand* node);
+            virtual void visit(DefineFunRecCommand* node);
+            virtual void visit(DefineFunsRecCommand* node);
+            virtual void visit(DefineSortCommand* node);
+            virtual void visit(EchoCommand* node);
+            virtual void visit(ExitCommand* node);
+            virtual void visit(GetAssertsCommand* node);
+            virtual void visit(GetAssignsCommand* node);
+            virtual void visit(GetInfoCommand* node);
+            virtual void visit(GetModelCommand* node);
+            virtual void visit(GetOptionCommand* node);
+            virtual void visit(GetProofCommand* node);
+            virtual void visit(GetUnsatAssumsCommand* node);
+            virtual void visit(GetUnsatCoreCommand* node);
+            virtual void visit(GetValueCommand* node);
+            virtual void visit(PopCommand* node);
+            virtual void visit(PushCommand* node);
+            virtual void visit(ResetCommand* node);
+            virtual void visit(ResetAssertsCommand* node);
+            virtual void visit(SetInfoCommand* node);
+            virtual void visit(SetLogicCommand* node);
+            virtual void visit(SetOptionCommand* node);
+
+            virtual void visit(FunctionDeclaration* node);
+            virtual void visit(FunctionDefinition* node);
+
+            virtual void visit(SimpleIdentifier* node);
+            virtual void visit(QualifiedIdentifier* node);
+
+            virtual void visit(DecimalLiteral* node);
+            virtual void visit(NumeralLiteral* node);
+            virtual void visit(StringLiteral* node);
+
+            virtual void visit(Logic* node);
+            virtual void visit(Theory* node);
+            virtual void visit(Script* node);
+
+            virtual void visit(Sort* node);
+
+            virtual void visit(CompSExpression* node);
+
+            virtual void visit(SortSymbolDeclaration* node);
+            virtual void visit(SpecConstFunDeclaration* node);
+            virtual void visit(MetaSpecConstFunDeclaration* node);
+            virtual void visit(SimpleFunDeclaration* node);
+            virtual void visit(ParametricFunDeclaration* node);
+            virtual void visit(SortDeclaration* node);
+
+            virtual void visit(SelectorDeclaration* node);
+            virtual void visit(ConstructorDeclaration* node);
+            virtual void visit(SimpleDatatypeDeclaration* node);
+            virtual void visit(ParametricDatatypeDeclaration* node);
+
+            virtual void visit(QualifiedConstructor* node);
+            virtual void visit(QualifiedPattern* node);
+            virtual void visit(MatchCase* node);
+
+            virtual void visit(QualifiedTerm* node);
+            virtual void visit(LetTerm* node);
+            virtual void visit(ForallTerm* node);
+            virtual void visit(ExistsTerm* node);
+            virtual void visit(MatchTerm* node);
+            virtual void visit(AnnotatedTerm* node);
+
+            virtual void visit(SortedVariable* node);
+            virtual void visit(VarBinding* node);
 
             bool check(sptr_t<AstNode> node);
 
             std::string getErrors();
+
+            // IFusableVisitor implementation
+            virtual void visitPart(AstNode* part);
+
+            virtual unsigned long getErrorCount();
         };
     }
 }
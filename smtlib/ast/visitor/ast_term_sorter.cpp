@@ -1,4 +1,5 @@
 #include "ast_term_sorter.h"
+#include "ast_printer.h"
 #include "ast_sortedness_checker.h"
 #include "ast/ast_logic.h"
 #include "ast/ast_script.h"
@@ -6,63 +7,227 @@
 #include "smtlib/parser/smtlib_parser.h"
 #include "util/error_messages.h"
 #include "util/global_values.h"
+#include "util/stats.h"
+#include "util/thread_pool.h"
 
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
-void TermSorter::visit(sptr_t<SimpleIdentifier> node) {
-    sptr_t<VarInfo> varInfo = ctx->getStack()->getVarInfo(node->toString());
+/**
+ * Scratch stack for the argument sorts of applications. Each application pushes
+ * the sorts of its arguments above those of the applications enclosing it, and
+ * removes them when done, so the storage is reused from one term to the next.
+ */
+static thread_local sptr_v<Sort> argSortStack;
+
+/** Scratch buffer for the sorts bound to the parameters of a parametric function */
+static thread_local sptr_v<Sort> paramBindings;
+
+// Arguments are sorted concurrently in parts of at least this many terms, so that
+// forking the stack and handing a part over to a worker is worth it
+static const unsigned long MIN_PART_SIZE = 4096;
+
+// Arguments are split into this many parts for each task, so that a task that is done
+// early can take over parts from slower ones
+static const unsigned long PARTS_PER_TASK = 8;
+
+/** String forms of a list of sorts, for error messages */
+static vector<string> toStrings(const sptr_v<Sort>& sorts) {
+    vector<string> strs;
+    for (auto sortIt = sorts.begin(); sortIt != sorts.end(); sortIt++) {
+        strs.push_back((*sortIt)->toString());
+    }
+    return strs;
+}
+
+/** Checks whether all parameters have been bound */
+static bool allBound(const sptr_v<Sort>& bindings) {
+    for (auto sortIt = bindings.begin(); sortIt != bindings.end(); sortIt++) {
+        if (!*sortIt)
+            return false;
+    }
+    return true;
+}
+
+/** Compare two sorts by their textual representation, without printing them */
+static bool equalSorts(const sptr_t<Sort>& sort1, const sptr_t<Sort>& sort2) {
+    Stats::count(Stats::STAT_SORT_COMPARISONS);
+    if (sort1 && sort2)
+        return sort1->equals(sort2.get());
+    else
+        return !sort1 && !sort2;
+}
+
+/** Sort from the signature of a parametric function, instantiated for some sorts of its parameters */
+struct Instance {
+    sptr_t<FunInfo> info;
+    unsigned long pos;
+    sptr_v<Sort> bindings;
+    sptr_t<Sort> sort;
+};
+
+/** Number of cached instances after which the cache is emptied */
+static const unsigned long MAX_INSTANCES = 1 << 16;
+
+/** Instances built so far, grouped by the hash of their function, position and bindings */
+static thread_local umap<size_t, vector<Instance>> instances;
+static thread_local unsigned long instanceCount = 0;
+
+/**
+ * Match a sort from a signature against an actual sort.
+ * \param index    Parameter positions of the nodes of sort1 (see FunInfo::paramIndices),
+ *                 advanced past the nodes that were visited
+ */
+static bool matchSort(const long*& index, sptr_v<Sort>& bindings, Sort* sort1, const sptr_t<Sort>& sort2) {
+    if (!sort2)
+        return false;
+
+    long param = *index++;
+    if (param >= 0) {
+        if (bindings[param]) {
+            return bindings[param]->equals(sort2.get());
+        } else {
+            bindings[param] = sort2;
+            return true;
+        }
+    }
+
+    sptr_v<Sort>& args1 = sort1->getArgs();
+    sptr_v<Sort>& args2 = sort2->getArgs();
+    if (args1.size() != args2.size() || !sort1->getIdentifier()->equals(sort2->getIdentifier().get()))
+        return false;
+
+    for (unsigned long i = 0; i < args1.size(); i++) {
+        if (!matchSort(index, bindings, args1[i].get(), args2[i]))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * Replace the sort parameters in a sort from a signature with the sorts bound to them.
+ * A new sort is built only if some node changes.
+ * \param index    Parameter positions of the nodes of the sort (see FunInfo::paramIndices),
+ *                 advanced past the nodes of the sort
+ */
+static sptr_t<Sort> instantiateSort(const long*& index, const sptr_v<Sort>& bindings, const sptr_t<Sort>& sort) {
+    long param = *index++;
+    if (param >= 0)
+        return bindings[param] ? bindings[param] : sort;
+
+    sptr_v<Sort>& args = sort->getArgs();
+    sptr_v<Sort> newargs;
+    bool changed = false;
+    for (unsigned long i = 0; i < args.size(); i++) {
+        sptr_t<Sort> result = instantiateSort(index, bindings, args[i]);
+        if (!changed && result.get() != args[i].get()) {
+            newargs.insert(newargs.end(), args.begin(), args.begin() + i);
+            changed = true;
+        }
+
+        if (changed)
+            newargs.push_back(result);
+    }
+
+    if (changed)
+        return make_shared<Sort>(sort->getIdentifier(), newargs);
+    else
+        return sort;
+}
+
+TermSorter::TermSorter(sptr_t<ITermSorterContext> ctx)
+        : ctx(ctx), forking(ctx->getChecker()->isParallelChecking()) { }
+
+void TermSorter::visit(SimpleIdentifier* node) {
+    string indexedName;
+    const string* name;
+
+    if (!node->isIndexed()) {
+        // Variables bound inside the term shadow everything else, even when their sort is unknown
+        bool bound;
+        sptr_t<Sort> boundSort = ctx->getStack()->getBinders().getSort(node->getSymbol()->getValue(), bound);
+        if (bound) {
+            ret = boundSort;
+            return;
+        }
+        name = &node->getSymbol()->getValue();
+    } else {
+        sptr_t<Sort> builtinSort = ctx->getStack()->getBuiltins().getConstSort(node);
+        if (builtinSort) {
+            ret = builtinSort;
+            return;
+        }
+
+        indexedName = node->toString();
+        name = &indexedName;
+    }
+
+    sptr_t<VarInfo> varInfo = ctx->getStack()->getVarInfo(*name);
     if (varInfo) {
         ret = varInfo->sort;
-    } else {
-        sptr_v<FunInfo> infos = ctx->getStack()->getFunInfo(node->toString());
+        return;
+    }
+
+    const sptr_v<FunInfo>& infos = ctx->getStack()->getFunOverloads(*name).getInfos();
+    unsigned long matches = 0;
+    for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
+        if ((*infoIt)->signature.size() == 1 && (*infoIt)->params.empty()) {
+            if (matches == 0)
+                ret = (*infoIt)->signature[0];
+            matches++;
+        }
+    }
+
+    if (matches == 0) {
+        string unknown = *name;
+        ctx->getChecker()->addError(ERROR_CONST_UNKNOWN, [unknown] { return unknown; }, node);
+    } else if (matches > 1) {
+        ret.reset();
+
         sptr_v<Sort> possibleSorts;
         for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
             if ((*infoIt)->signature.size() == 1 && (*infoIt)->params.empty())
                 possibleSorts.push_back((*infoIt)->signature[0]);
         }
 
-        if (possibleSorts.size() == 1) {
-            ret = possibleSorts[0];
-        } else if (possibleSorts.empty()) {
-            ctx->getChecker()->addError((node->toString()), node);
-        } else {
-            vector<string> possibleSortsStr;
-            for (auto sort : possibleSorts) {
-                possibleSortsStr.push_back(sort->toString());
-            }
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildConstMultipleSorts(node->toString(),
-                                                           possibleSortsStr), node);
-        }
+        string multiple = *name;
+        ctx->getChecker()->addError(ERROR_CONST_MULTIPLE_SORTS, [multiple, possibleSorts] {
+            return ErrorMessages::buildConstMultipleSorts(multiple, toStrings(possibleSorts));
+        }, node);
     }
 }
 
-void TermSorter::visit(sptr_t<QualifiedIdentifier> node) {
+void TermSorter::visit(QualifiedIdentifier* node) {
     sptr_t<SortednessChecker::NodeError> err;
     err = ctx->getChecker()->checkSort(node->getSort(), node, err);
 
-    sptr_v<FunInfo> infos = ctx->getStack()->getFunInfo(node->getIdentifier()->toString());
+    SimpleIdentifier* id = node->getIdentifier().get();
     sptr_t<Sort> retExpanded = ctx->getStack()->expand(node->getSort());
 
+    sptr_t<Sort> builtinSort = ctx->getStack()->getBuiltins().getConstSort(id);
+    if (builtinSort && equalSorts(builtinSort, retExpanded)) {
+        ret = builtinSort;
+        return;
+    }
+
+    const sptr_v<FunInfo>& infos = id->isIndexed()
+                                   ? ctx->getStack()->getFunOverloads(id->toString()).getInfos()
+                                   : ctx->getStack()->getFunOverloads(id->getSymbol()->getValue()).getInfos();
+
     sptr_v<Sort> retSorts;
     for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
         if ((*infoIt)->signature.size() == 1) {
             if ((*infoIt)->params.empty()) {
                 retSorts.push_back((*infoIt)->signature[0]);
             } else {
-                vector<string> pnames;
-                for (auto p = (*infoIt)->params.begin(); p != (*infoIt)->params.end(); p++) {
-                    pnames.push_back((*p)->toString());
-                }
-
-                unordered_map<string, sptr_t<Sort>> mapping;
-                getParamMapping(pnames, mapping, (*infoIt)->signature[0], retExpanded);
+                paramBindings.assign((*infoIt)->params.size(), sptr_t<Sort>());
+                matchParams((*infoIt).get(), 0, paramBindings, retExpanded);
 
-                if (mapping.size() == pnames.size()) {
-                    sptr_t<Sort> retSort = ctx->getStack()->replace((*infoIt)->signature[0], mapping);
-                    if (retSort->toString() == retExpanded->toString()) {
+                if (allBound(paramBindings)) {
+                    sptr_t<Sort> retSort = instantiate(*infoIt, 0, paramBindings);
+                    if (equalSorts(retSort, retExpanded)) {
                         ret = retSort;
                         return;
                     }
@@ -72,228 +237,321 @@ void TermSorter::visit(sptr_t<QualifiedIdentifier> node) {
         }
     }
 
-    if (retSorts.size() == 1 && retSorts[0]->toString() == retExpanded->toString()) {
+    if (retSorts.size() == 1 && equalSorts(retSorts[0], retExpanded)) {
         ret = retSorts[0];
     } else {
         if (retSorts.empty()) {
             err = ctx->getChecker()->addError(
-                    ErrorMessages::buildConstUnknown(node->getIdentifier()->toString()), node, err);
+                    ERROR_CONST_UNKNOWN, SortednessChecker::message(ErrorMessages::buildConstUnknown, node->getIdentifier()->toString()), node, err);
         } else {
-            vector<string> retSortsStr;
-            for (auto sort : retSorts) {
-                retSortsStr.push_back(sort->toString());
-            }
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildConstWrongSort(node->getIdentifier()->toString(),
-                                                       retExpanded->toString(), retSortsStr), node, err);
+            sptr_t<SimpleIdentifier> identifier = node->getIdentifier();
+            ctx->getChecker()->addError(ERROR_CONST_WRONG_SORT, [identifier, retExpanded, retSorts] {
+                return ErrorMessages::buildConstWrongSort(identifier->toString(), retExpanded->toString(),
+                                                          toStrings(retSorts));
+            }, node, err);
         }
     }
 }
 
-void TermSorter::visit(sptr_t<DecimalLiteral> node) {
-    sptr_v<FunInfo> infos = ctx->getStack()->getFunInfo(MSCONST_DECIMAL);
+void TermSorter::visit(DecimalLiteral* node) {
+    const sptr_v<FunInfo>& infos = ctx->getStack()->getDecimalInfo();
     if (infos.size() == 1) {
         if (infos[0]->signature.size() == 1) {
             ret = infos[0]->signature[0];
         }
     } else {
         if (infos.empty()) {
-            ctx->getChecker()->addError(ErrorMessages::buildLiteralUnknownSort(MSCONST_DECIMAL_REF), node);
+            ctx->getChecker()->addError(ERROR_LITERAL_UNKNOWN_SORT, SortednessChecker::message(ErrorMessages::buildLiteralUnknownSort, MSCONST_DECIMAL_REF), node);
         } else {
-            vector<string> possibleSorts;
+            sptr_v<Sort> possibleSorts;
             for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
                 if ((*infoIt)->signature.size() == 1 && (*infoIt)->params.empty())
-                    possibleSorts.push_back((*infoIt)->signature[0]->toString());
+                    possibleSorts.push_back((*infoIt)->signature[0]);
             }
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildLiteralMultipleSorts(MSCONST_DECIMAL_REF, possibleSorts), node);
+            ctx->getChecker()->addError(ERROR_LITERAL_MULTIPLE_SORTS, [possibleSorts] {
+                return ErrorMessages::buildLiteralMultipleSorts(MSCONST_DECIMAL_REF, toStrings(possibleSorts));
+            }, node);
         }
     }
 }
 
-void TermSorter::visit(sptr_t<NumeralLiteral> node) {
-    sptr_v<FunInfo> infos = ctx->getStack()->getFunInfo(MSCONST_NUMERAL);
+void TermSorter::visit(NumeralLiteral* node) {
+    if (node->getBase() != 10) {
+        sptr_t<Sort> builtinSort = ctx->getStack()->getBuiltins().getLiteralSort(node);
+        if (builtinSort) {
+            ret = builtinSort;
+            return;
+        }
+    }
+
+    const sptr_v<FunInfo>& infos = ctx->getStack()->getNumeralInfo();
     if (infos.size() == 1) {
         if (infos[0]->signature.size() == 1) {
             ret = infos[0]->signature[0];
         }
     } else {
         if (infos.empty()) {
-            ctx->getChecker()->addError(ErrorMessages::buildLiteralUnknownSort(MSCONST_NUMERAL_REF), node);
+            ctx->getChecker()->addError(ERROR_LITERAL_UNKNOWN_SORT, SortednessChecker::message(ErrorMessages::buildLiteralUnknownSort, MSCONST_NUMERAL_REF), node);
         } else {
-            vector<string> possibleSorts;
+            sptr_v<Sort> possibleSorts;
             for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
                 if ((*infoIt)->signature.size() == 1 && (*infoIt)->params.empty())
-                    possibleSorts.push_back((*infoIt)->signature[0]->toString());
+                    possibleSorts.push_back((*infoIt)->signature[0]);
             }
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildLiteralMultipleSorts(MSCONST_NUMERAL_REF, possibleSorts), node);
+            ctx->getChecker()->addError(ERROR_LITERAL_MULTIPLE_SORTS, [possibleSorts] {
+                return ErrorMessages::buildLiteralMultipleSorts(MSCONST_NUMERAL_REF, toStrings(possibleSorts));
+            }, node);
         }
     }
 }
 
-void TermSorter::visit(sptr_t<StringLiteral> node) {
-    sptr_v<FunInfo> infos = ctx->getStack()->getFunInfo(MSCONST_STRING);
+void TermSorter::visit(StringLiteral* node) {
+    const sptr_v<FunInfo>& infos = ctx->getStack()->getStringInfo();
     if (infos.size() == 1) {
         if (infos[0]->signature.size() == 1) {
             ret = infos[0]->signature[0];
         }
     } else {
         if (infos.empty()) {
-            ctx->getChecker()->addError(ErrorMessages::buildLiteralUnknownSort(MSCONST_STRING_REF), node);
+            ctx->getChecker()->addError(ERROR_LITERAL_UNKNOWN_SORT, SortednessChecker::message(ErrorMessages::buildLiteralUnknownSort, MSCONST_STRING_REF), node);
         } else {
-            vector<string> possibleSorts;
+            sptr_v<Sort> possibleSorts;
             for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
                 if ((*infoIt)->signature.size() == 1 && (*infoIt)->params.empty())
-                    possibleSorts.push_back((*infoIt)->signature[0]->toString());
+                    possibleSorts.push_back((*infoIt)->signature[0]);
             }
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildLiteralMultipleSorts(MSCONST_STRING_REF, possibleSorts), node);
+            ctx->getChecker()->addError(ERROR_LITERAL_MULTIPLE_SORTS, [possibleSorts] {
+                return ErrorMessages::buildLiteralMultipleSorts(MSCONST_STRING_REF, toStrings(possibleSorts));
+            }, node);
         }
     }
 }
 
-void TermSorter::visit(sptr_t<QualifiedTerm> node) {
-    sptr_t<SortednessChecker::NodeError> err;
+void TermSorter::visit(QualifiedTerm* node) {
+    unsigned long base = argSortStack.size();
 
-    sptr_v<Sort> argSorts;
-    sptr_v<Term> terms = node->getTerms();
-    for (auto termIt = terms.begin(); termIt != terms.end(); termIt++) {
-        sptr_t<Sort> result = wrappedVisit(*termIt);
-        if (result)
-            argSorts.push_back(result);
-        else {
-            return;
+    sptr_v<Term>& terms = node->getTerms();
+    if (!forking || node->getSize() < 2 * MIN_PART_SIZE || !sortArgsConcurrently(node)) {
+        for (auto termIt = terms.begin(); termIt != terms.end(); termIt++) {
+            sptr_t<Sort> result = wrappedVisit(*termIt);
+            if (!result)
+                break;
+            argSortStack.push_back(result);
         }
     }
 
-    sptr_t<SimpleIdentifier> id = dynamic_pointer_cast<SimpleIdentifier>(node->getIdentifier());
-    sptr_t<QualifiedIdentifier> qid = dynamic_pointer_cast<QualifiedIdentifier>(node->getIdentifier());
+    if (argSortStack.size() - base == terms.size())
+        sortApplication(node, base);
 
-    sptr_t<Sort> retExpanded;
-    string name;
+    argSortStack.erase(argSortStack.begin() + base, argSortStack.end());
+}
+
+bool TermSorter::sortArgsConcurrently(QualifiedTerm* node) {
+    ThreadPool& pool = ThreadPool::getShared();
+    if (pool.getSize() == 0)
+        return false;
+
+    // Consecutive arguments are grouped until their size reaches that of a part
+    sptr_v<Term>& terms = node->getTerms();
+    unsigned long partSize = max(MIN_PART_SIZE, node->getSize() / ((pool.getSize() + 1) * PARTS_PER_TASK));
+    vector<unsigned long> starts;
+    unsigned long size = 0;
+    for (unsigned long i = 0; i < terms.size(); i++) {
+        if (i == 0 || size >= partSize) {
+            starts.push_back(i);
+            size = 0;
+        }
+        size += terms[i]->getSize();
+    }
+    starts.push_back(terms.size());
+
+    unsigned long partCount = starts.size() - 1;
+    if (partCount < 2)
+        return false;
+
+    // Workers sort against forks taken beforehand, since sorting may load pending symbols into the stack
+    unsigned long taskCount = min(pool.getSize() + 1, partCount);
+    vector<sptr_t<ISortCheckContext>> contexts;
+    contexts.push_back(make_shared<SortednessCheckerContext>(ctx->getStack(), ctx->getConfiguration()));
+    for (unsigned long i = 1; i < taskCount; i++) {
+        contexts.push_back(make_shared<SortednessCheckerContext>(ctx->getStack()->fork(), ctx->getConfiguration()));
+    }
 
-    if (id) {
-        name = id->toString();
+    vector<sptr_t<SortednessChecker>> checkers(partCount);
+    sptr_v<Sort> sorts(terms.size());
+
+    unsigned long errorLimit = ctx->getChecker()->getErrorLimit();
+    pool.forEach(partCount, taskCount, [&terms, &starts, &contexts, &checkers, &sorts,
+                                        errorLimit](unsigned long task, unsigned long part) {
+        sptr_t<SortednessChecker> chk = make_shared<SortednessChecker>(contexts[task]);
+        chk->setParallelChecking(true);
+        chk->setErrorLimit(errorLimit);
+
+        TermSorter sorter(chk);
+        for (unsigned long i = starts[part]; i < starts[part + 1]; i++) {
+            sorts[i] = sorter.run(terms[i].get());
+            if (!sorts[i])
+                break;
+        }
+        checkers[part] = chk;
+    });
+
+    // Arguments after the first one that could not be sorted are not looked at, as when sorting them in order
+    sptr_t<SortednessChecker> checker = ctx->getChecker();
+    for (unsigned long part = 0; part < partCount; part++) {
+        checker->addErrors(checkers[part]);
+        for (unsigned long i = starts[part]; i < starts[part + 1]; i++) {
+            if (!sorts[i])
+                return true;
+            argSortStack.push_back(sorts[i]);
+        }
+    }
+
+    return true;
+}
+
+void TermSorter::sortApplication(QualifiedTerm* node, unsigned long base) {
+    sptr_t<SortednessChecker::NodeError> err;
+
+    Identifier* identifier = node->getIdentifier().get();
+    SimpleIdentifier* id = NULL;
+    QualifiedIdentifier* qid = NULL;
+    if (identifier->getKind() == NODE_SIMPLE_IDENTIFIER) {
+        id = static_cast<SimpleIdentifier*>(identifier);
     } else {
+        qid = static_cast<QualifiedIdentifier*>(identifier);
+        id = qid->getIdentifier().get();
+    }
+
+    sptr_t<Sort> retExpanded;
+    if (qid) {
         err = ctx->getChecker()->checkSort(qid->getSort(), node, err);
-        name = qid->getIdentifier()->toString();
         retExpanded = ctx->getStack()->expand(qid->getSort());
     }
 
-    sptr_v<FunInfo> infos = ctx->getStack()->getFunInfo(name);
-    sptr_v<Sort> retSorts;
+    sptr_t<Sort>* argSorts = argSortStack.data() + base;
+    unsigned long count = argSortStack.size() - base;
 
+    // Functions of the indexed theory families are sorted by rules, before looking at declarations
+    sptr_t<Sort> builtinSort = ctx->getStack()->getBuiltins().getReturnSort(id, argSorts, count);
+    if (builtinSort && (!qid || equalSorts(builtinSort, retExpanded))) {
+        ret = builtinSort;
+        return;
+    }
 
-    for (auto infoIt = infos.begin(); infoIt != infos.end(); infoIt++) {
-        sptr_v<Sort> funSig;
-        if (argSorts.size() >= 2) {
-            if ((*infoIt)->assocL) {
-                funSig.push_back((*infoIt)->signature[0]);
-                for (int i = 0; i < argSorts.size() - 1; i++) {
-                    funSig.push_back((*infoIt)->signature[1]);
-                }
-                funSig.push_back((*infoIt)->signature[2]);
-            } else if ((*infoIt)->assocR) {
-                for (int i = 0; i < argSorts.size() - 1; i++) {
-                    funSig.push_back((*infoIt)->signature[0]);
-                }
-                funSig.push_back((*infoIt)->signature[1]);
-                funSig.push_back((*infoIt)->signature[2]);
-            } else if ((*infoIt)->chainable || (*infoIt)->pairwise) {
-                for (int i = 0; i < argSorts.size(); i++) {
-                    funSig.push_back((*infoIt)->signature[0]);
-                }
-                funSig.push_back((*infoIt)->signature[2]);
-            } else {
-                funSig.insert(funSig.begin(), (*infoIt)->signature.begin(), (*infoIt)->signature.end());
-            }
+    string indexedName;
+    const string* name;
+    if (!id->isIndexed()) {
+        name = &id->getSymbol()->getValue();
+    } else {
+        indexedName = id->toString();
+        name = &indexedName;
+    }
+
+    const FunOverloads& overloads = ctx->getStack()->getFunOverloads(*name);
+    const sptr_v<FunInfo>& infos = overloads.getInfos();
+
+    // Candidates are the functions indexed under the sort of the first argument,
+    // merged in declaration order with those that cannot be indexed
+    static const vector<unsigned long> none;
+    const vector<unsigned long>& indexed = count == 0 ? none : overloads.getByFirstArg(argSorts[0].get());
+    const vector<unsigned long>& others = overloads.getOthers();
+
+    // Only the first return sort is kept, unless there are several
+    unsigned long matches = 0;
+    sptr_v<Sort> retSorts;
+
+    auto indexedIt = indexed.begin();
+    auto othersIt = others.begin();
+    while (indexedIt != indexed.end() || othersIt != others.end()) {
+        unsigned long pos;
+        if (othersIt == others.end() || (indexedIt != indexed.end() && *indexedIt < *othersIt)) {
+            pos = *indexedIt;
+            indexedIt++;
         } else {
-            funSig.insert(funSig.begin(), (*infoIt)->signature.begin(), (*infoIt)->signature.end());
+            pos = *othersIt;
+            othersIt++;
         }
 
-        if (argSorts.size() == funSig.size() - 1) {
-            bool fits = true;
-            if ((*infoIt)->params.empty()) {
-                for (unsigned long i = 0; i < funSig.size() - 1; i++) {
-                    if (funSig[i]->toString() != argSorts[i]->toString())
-                        fits = false;
-                }
+        const sptr_t<FunInfo>& info = infos[pos];
+        if (!info->acceptsArgs(count))
+            continue;
 
-                if (id) {
-                    if (fits)
-                        retSorts.push_back(funSig[funSig.size() - 1]);
-                } else {
-                    sptr_t<Sort> retSort = funSig[funSig.size() - 1];
-                    if (fits && retSort->toString() == retExpanded->toString()) {
-                        ret = retSort;
-                        return;
-                    }
-                }
-            } else {
-                vector<string> pnames;
-                for (auto p = (*infoIt)->params.begin(); p != (*infoIt)->params.end(); p++) {
-                    pnames.push_back((*p)->toString());
-                }
-                unordered_map<string, sptr_t<Sort>> mapping;
+        bool fits = true;
+        sptr_t<Sort> retSort;
+        if (info->params.empty()) {
+            for (unsigned long i = 0; i < count && fits; i++) {
+                fits = equalSorts(info->getArgSort(i, count), argSorts[i]);
+            }
 
-                for (unsigned long i = 0; i < funSig.size() - 1; i++) {
-                    fits = fits && getParamMapping(pnames, mapping, funSig[i], argSorts[i]);
-                }
+            if (!fits)
+                continue;
+            retSort = info->getReturnSort(count);
+        } else {
+            paramBindings.assign(info->params.size(), sptr_t<Sort>());
+            for (unsigned long i = 0; i < count && fits; i++) {
+                fits = matchParams(info.get(), info->getArgPosition(i, count), paramBindings, argSorts[i]);
+            }
 
-                if (fits && mapping.size() == (*infoIt)->params.size()) {
-                    sptr_t<Sort> retSort = funSig[funSig.size() - 1];
-                    retSort = ctx->getStack()->replace(retSort, mapping);
-                    string retSortString = retSort->toString();
-                    if (id) {
-                        retSorts.push_back(retSort);
-                    } else {
-                        if (retSortString == retExpanded->toString()) {
-                            ret = retSort;
-                            return;
-                        }
-                    }
-                }
+            if (!fits || !allBound(paramBindings))
+                continue;
+            retSort = instantiate(info, info->getReturnPosition(count), paramBindings);
+        }
+
+        if (qid) {
+            if (equalSorts(retSort, retExpanded)) {
+                ret = retSort;
+                return;
             }
+        } else {
+            if (matches == 0) {
+                ret = retSort;
+            } else {
+                if (matches == 1)
+                    retSorts.push_back(ret);
+                retSorts.push_back(retSort);
+            }
+            matches++;
         }
     }
 
-    vector<string> argSortsStr;
-    for (auto sort : argSorts) {
-        argSortsStr.push_back(sort->toString());
-    }
+    if (!qid && matches == 1)
+        return;
 
-    vector<string> retSortsStr;
-    for (auto sort : retSorts) {
-        retSortsStr.push_back(sort->toString());
-    }
+    // Failure: build the diagnostic
+    ret.reset();
 
-    if (id) {
-        if (retSorts.size() == 1) {
-            ret = retSorts[0];
-        } else if (retSorts.empty()) {
-            err = ctx->getChecker()->addError(
-                    ErrorMessages::buildFunUnknownDecl(name, argSortsStr), node, err);
+    string fun = *name;
+    sptr_v<Sort> funArgSorts(argSorts, argSorts + count);
+
+    if (!qid) {
+        if (matches == 0) {
+            err = ctx->getChecker()->addError(ERROR_FUN_UNKNOWN_DECL, [fun, funArgSorts] {
+                return ErrorMessages::buildFunUnknownDecl(fun, toStrings(funArgSorts));
+            }, node, err);
         } else {
-            err = ctx->getChecker()->addError
-                    (ErrorMessages::buildFunMultipleDecls(name, argSortsStr, retSortsStr), node, err);
+            err = ctx->getChecker()->addError(ERROR_FUN_MULTIPLE_DECLS, [fun, funArgSorts, retSorts] {
+                return ErrorMessages::buildFunMultipleDecls(fun, toStrings(funArgSorts), toStrings(retSorts));
+            }, node, err);
         }
     } else {
-        err = ctx->getChecker()->addError(
-                ErrorMessages::buildFunUnknownDecl(name, argSortsStr, retExpanded->toString()), node, err);
+        err = ctx->getChecker()->addError(ERROR_FUN_UNKNOWN_DECL, [fun, funArgSorts, retExpanded] {
+            return ErrorMessages::buildFunUnknownDecl(fun, toStrings(funArgSorts), retExpanded->toString());
+        }, node, err);
     }
 }
 
-void TermSorter::visit(sptr_t<LetTerm> node) {
-    ctx->getStack()->push();
+void TermSorter::visit(LetTerm* node) {
+    BinderStack& binders = ctx->getStack()->getBinders();
+    binders.push();
 
     sptr_v<VarBinding> &bindings = node->getBindings();
     for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
         sptr_t<Sort> result = wrappedVisit((*bindingIt)->getTerm());
         if (result) {
-            ctx->getStack()->tryAdd(
-                    make_shared<VarInfo>((*bindingIt)->getSymbol()->toString(), result, node));
+            binders.bind((*bindingIt)->getSymbol()->getValue(), result);
         } else {
+            binders.pop();
             return;
         }
     }
@@ -303,17 +561,16 @@ void TermSorter::visit(sptr_t<LetTerm> node) {
         ret = result;
     }
 
-    ctx->getStack()->pop();
+    binders.pop();
 }
 
-void TermSorter::visit(sptr_t<ForallTerm> node) {
-    ctx->getStack()->push();
+void TermSorter::visit(ForallTerm* node) {
+    BinderStack& binders = ctx->getStack()->getBinders();
+    binders.push();
 
     sptr_v<SortedVariable> &bindings = node->getBindings();
     for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
-        ctx->getStack()->tryAdd(
-                make_shared<VarInfo>((*bindingIt)->getSymbol()->toString(),
-                                     ctx->getStack()->expand((*bindingIt)->getSort()), node));
+        binders.bind((*bindingIt)->getSymbol()->getValue(), ctx->getStack()->expand((*bindingIt)->getSort()));
     }
 
     sptr_t<Sort> result = wrappedVisit(node->getTerm());
@@ -322,26 +579,26 @@ void TermSorter::visit(sptr_t<ForallTerm> node) {
         if (resstr == SORT_BOOL) {
             ret = result;
         } else {
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildQuantTermWrongSort(node->getTerm()->toString(), resstr, SORT_BOOL,
-                                                           node->getTerm()->getRowLeft(),
-                                                           node->getTerm()->getColLeft(),
-                                                           node->getTerm()->getRowRight(),
-                                                           node->getTerm()->getColRight()), node);
+            sptr_t<Term> term = node->getTerm();
+            ctx->getChecker()->addError(ERROR_QUANT_TERM_WRONG_SORT, [term, resstr] {
+                string termstr = AstPrinter::toString(term.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                return ErrorMessages::buildQuantTermWrongSort(termstr, resstr, SORT_BOOL,
+                                                              term->getRowLeft(), term->getColLeft(),
+                                                              term->getRowRight(), term->getColRight());
+            }, node);
         }
     }
 
-    ctx->getStack()->pop();
+    binders.pop();
 }
 
-void TermSorter::visit(sptr_t<ExistsTerm> node) {
-    ctx->getStack()->push();
+void TermSorter::visit(ExistsTerm* node) {
+    BinderStack& binders = ctx->getStack()->getBinders();
+    binders.push();
 
     sptr_v<SortedVariable> &bindings = node->getBindings();
     for (auto bindingIt = bindings.begin(); bindingIt != bindings.end(); bindingIt++) {
-        ctx->getStack()->tryAdd(
-                make_shared<VarInfo>((*bindingIt)->getSymbol()->toString(),
-                                     ctx->getStack()->expand((*bindingIt)->getSort()), node));
+        binders.bind((*bindingIt)->getSymbol()->getValue(), ctx->getStack()->expand((*bindingIt)->getSort()));
     }
 
     sptr_t<Sort> result = wrappedVisit(node->getTerm());
@@ -350,19 +607,20 @@ void TermSorter::visit(sptr_t<ExistsTerm> node) {
         if (resstr == SORT_BOOL) {
             ret = result;
         } else {
-            ctx->getChecker()->addError(
-                    ErrorMessages::buildQuantTermWrongSort(node->getTerm()->toString(), resstr, SORT_BOOL,
-                                                           node->getTerm()->getRowLeft(),
-                                                           node->getTerm()->getColLeft(),
-                                                           node->getTerm()->getRowRight(),
-                                                           node->getTerm()->getColRight()), node);
+            sptr_t<Term> term = node->getTerm();
+            ctx->getChecker()->addError(ERROR_QUANT_TERM_WRONG_SORT, [term, resstr] {
+                string termstr = AstPrinter::toString(term.get(), ErrorMessages::TERM_QUOTE_LENGTH);
+                return ErrorMessages::buildQuantTermWrongSort(termstr, resstr, SORT_BOOL,
+                                                              term->getRowLeft(), term->getColLeft(),
+                                                              term->getRowRight(), term->getColRight());
+            }, node);
         }
     }
 
-    ctx->getStack()->pop();
+    binders.pop();
 }
 
-void TermSorter::visit(sptr_t<MatchTerm> node) {
+void TermSorter::visit(MatchTerm* node) {
     sptr_t<Sort> termSort = wrappedVisit(node->getTerm());
     sptr_v<Sort> caseSorts;
 
@@ -370,7 +628,7 @@ void TermSorter::visit(sptr_t<MatchTerm> node) {
         sptr_t<SortednessChecker::NodeError> err;
         string termSortStr = termSort->toString();
 
-        sptr_v<MatchCase> cases = node->getCases();
+        sptr_v<MatchCase>& cases = node->getCases();
         for (auto caseIt = cases.begin(); caseIt != cases.end(); caseIt++) {
             sptr_t<Pattern> pattern = (*caseIt)->getPattern();
 
@@ -404,89 +662,90 @@ void TermSorter::visit(sptr_t<MatchTerm> node) {
             // Get known information about functions with the name caseId
             sptr_v<FunInfo> funInfos = ctx->getStack()->getFunInfo(caseId);
             sptr_v<FunInfo> matchingInfos;
-            vector<unordered_map<string, sptr_t<Sort>>> matchingMappings;
+            vector<sptr_v<Sort>> matchingBindings;
 
             for (auto info = funInfos.begin(); info != funInfos.end(); info++) {
                 sptr_t<Sort> retSort = (*info)->signature[(*info)->signature.size() - 1];
                 string retSortStr = retSort->toString();
 
-                // If info is about a parametric function, map sort parameters to real sorts
-                vector<string> pnames;
-                unordered_map<string, sptr_t<Sort>> mapping;
-                bool mapped = true;
+                // If info is about a parametric function, map sort parameters to real sorts.
+                // Otherwise, it only fits if it builds the matched sort (a constant of another
+                // sort with the same name as a pattern variable does not).
+                sptr_v<Sort> bindings((*info)->params.size());
+                bool mapped = retSortStr == termSortStr;
 
                 if (!(*info)->params.empty()) {
-                    for (auto p = (*info)->params.begin(); p != (*info)->params.end(); p++) {
-                        pnames.push_back((*p)->toString());
-                    }
-                    mapped = getParamMapping(pnames, mapping, retSort, termSort);
+                    mapped = matchParams((*info).get(), (*info)->signature.size() - 1, bindings, termSort);
                 }
 
                 // Check if current function info fits
                 if (spattern || cpattern) {
                     // Return sort mismatch in case of qualified constructor
                     if (cpattern && cpattern->getSort()->toString() != termSortStr) {
-                        err = ctx->getChecker()->addError(
-                                ErrorMessages::buildPatternMismatch(termSortStr, pattern->toString()), node, err);
+                        err = ctx->getChecker()->addError(ERROR_PATTERN_MISMATCH, [termSortStr, pattern] {
+                            return ErrorMessages::buildPatternMismatch(termSortStr, pattern->toString());
+                        }, node, err);
                         continue;
                     }
 
                     // If return sorts were mapped correctly
-                    if (mapped && (*info)->params.size() == mapping.size()) {
+                    if (mapped && allBound(bindings)) {
                         matchingInfos.push_back(*info);
-                        matchingMappings.push_back(mapping);
+                        matchingBindings.push_back(bindings);
                     }
                 } else if (qpattern) {
                     // Return sort mismatch in case of qualified constructor
                     if (qcons && qcons->getSort()->toString() != termSortStr) {
-                        err = ctx->getChecker()->addError(
-                                ErrorMessages::buildPatternMismatch(termSortStr, pattern->toString()), node, err);
+                        err = ctx->getChecker()->addError(ERROR_PATTERN_MISMATCH, [termSortStr, pattern] {
+                            return ErrorMessages::buildPatternMismatch(termSortStr, pattern->toString());
+                        }, node, err);
                         continue;
                     }
 
                     // If return sorts were mapped correctly
                     // and there are as many arguments to the fuction as there are symbols in the pattern
-                    if (mapped && (*info)->params.size() == mapping.size()
+                    if (mapped && allBound(bindings)
                         && qpattern->getSymbols().size() == (*info)->signature.size() - 1) {
                         matchingInfos.push_back(*info);
-                        matchingMappings.push_back(mapping);
+                        matchingBindings.push_back(bindings);
                     }
                 }
             }
 
             if (matchingInfos.empty()) {
-                if (spattern && caseIt + 1 == node->getCases().end()) {
+                if (spattern && caseIt + 1 == cases.end()) {
                     // If it's not a function, try to interpret it as a variable
-                    ctx->getStack()->push();
-                    ctx->getStack()->tryAdd(make_shared<VarInfo>(caseId, termSort, *caseIt));
+                    ctx->getStack()->getBinders().push();
+                    ctx->getStack()->getBinders().bind(caseId, termSort);
                     sptr_t<Sort> caseSort = wrappedVisit((*caseIt)->getTerm());
                     if (caseSort) {
                         caseSorts.push_back(caseSort);
                     }
-                    ctx->getStack()->pop();
+                    ctx->getStack()->getBinders().pop();
                 } else if (spattern || cpattern) {
-                    err = ctx->getChecker()->addError(
-                            ErrorMessages::buildFunUnknownDecl(caseId, termSort->toString()), node, err);
+                    err = ctx->getChecker()->addError(ERROR_FUN_UNKNOWN_DECL, [caseId, termSort] {
+                        return ErrorMessages::buildFunUnknownDecl(caseId, termSort->toString());
+                    }, node, err);
                 } else if (qpattern) {
-                    err = ctx->getChecker()->addError(
-                            ErrorMessages::buildFunUnknownDecl(caseId, qpattern->getSymbols().size(),
-                                                               termSort->toString()), node, err);
+                    unsigned long paramCount = qpattern->getSymbols().size();
+                    err = ctx->getChecker()->addError(ERROR_FUN_UNKNOWN_DECL, [caseId, paramCount, termSort] {
+                        return ErrorMessages::buildFunUnknownDecl(caseId, paramCount, termSort->toString());
+                    }, node, err);
                 }
             } else if (matchingInfos.size() > 1) {
                 if (qpattern) {
-                    err = ctx->getChecker()->addError(
-                            ErrorMessages::buildFunMultipleDecls(caseId, qpattern->getSymbols().size(),
-                                                                 termSort->toString()), node, err);
+                    unsigned long paramCount = qpattern->getSymbols().size();
+                    err = ctx->getChecker()->addError(ERROR_FUN_MULTIPLE_DECLS, [caseId, paramCount, termSort] {
+                        return ErrorMessages::buildFunMultipleDecls(caseId, paramCount, termSort->toString());
+                    }, node, err);
                 }
             } else {
                 sptr_t<FunInfo> match = matchingInfos[0];
                 if (qpattern) {
-                    ctx->getStack()->push();
+                    ctx->getStack()->getBinders().push();
                     for (unsigned long i = 0; i < match->signature.size() - 1; i++) {
-                        sptr_t<Sort> paramSort = ctx->getStack()->replace(match->signature[i],
-                                                                                    matchingMappings[0]);
-                        ctx->getStack()->tryAdd(
-                                make_shared<VarInfo>(qpattern->getSymbols()[i]->toString(), paramSort, *caseIt));
+                        sptr_t<Sort> paramSort = instantiate(match, i, matchingBindings[0]);
+                        ctx->getStack()->getBinders().bind(qpattern->getSymbols()[i]->getValue(), paramSort);
                     }
                 }
 
@@ -496,23 +755,19 @@ void TermSorter::visit(sptr_t<MatchTerm> node) {
                 }
 
                 if (qpattern) {
-                    ctx->getStack()->pop();
+                    ctx->getStack()->getBinders().pop();
                 }
             }
         }
 
-        vector<string> caseSortsStr;
-        for (auto caseSort : caseSorts) {
-            caseSortsStr.push_back(caseSort->toString());
-        }
-
         if (caseSorts.size() == node->getCases().size()) {
             string case1 = caseSorts[0]->toString();
             bool equalCases = true;
             for (unsigned long i = 1; i < caseSorts.size(); i++) {
                 if (caseSorts[1]->toString() != case1) {
-                    err = ctx->getChecker()->addError(
-                            ErrorMessages::buildCasesMismatch(caseSortsStr), node, err);
+                    err = ctx->getChecker()->addError(ERROR_CASES_MISMATCH, [caseSorts] {
+                        return ErrorMessages::buildCasesMismatch(toStrings(caseSorts));
+                    }, node, err);
                     equalCases = false;
                     break;
                 }
@@ -523,46 +778,73 @@ void TermSorter::visit(sptr_t<MatchTerm> node) {
     }
 }
 
-void TermSorter::visit(sptr_t<AnnotatedTerm> node) {
-    visit0(node->getTerm());
+void TermSorter::visit(AnnotatedTerm* node) {
+    visitTerm(node->getTerm().get());
 }
 
-
-bool TermSorter::getParamMapping(vector<string> &params,
-                                 unordered_map<string, sptr_t<Sort>> &mapping,
-                                 sptr_t<Sort> sort1,
-                                 sptr_t<Sort> sort2) {
-    if (!sort1 || !sort2)
+bool TermSorter::matchParams(FunInfo* info, unsigned long pos, sptr_v<Sort>& bindings, const sptr_t<Sort>& sort) {
+    sptr_t<Sort>& sigSort = info->signature[pos];
+    if (!sigSort)
         return false;
 
-    string sort1Name = sort1->getIdentifier()->toString();
-    bool isParam = (find(params.begin(), params.end(), sort1Name) != params.end());
+    const long* index = info->paramIndices[pos].data();
+    return matchSort(index, bindings, sigSort.get(), sort);
+}
 
-    if (isParam) {
-        if (mapping[sort1Name]) {
-            return mapping[sort1Name]->toString() == sort2->toString();
-        } else {
-            mapping[sort1Name] = sort2;
-            return true;
-        }
-    } else {
-        if (sort1->getArgs().size() != sort2->getArgs().size()) {
-            return false;
-        } else if (sort1->getArgs().empty()) {
-            return sort1Name == sort2->getIdentifier()->toString();
-        } else {
-            string sort2Name = sort2->getIdentifier()->toString();
+sptr_t<Sort> TermSorter::instantiate(const sptr_t<FunInfo>& info, unsigned long pos, const sptr_v<Sort>& bindings) {
+    sptr_t<Sort>& sort = info->signature[pos];
+    if (!sort || info->params.empty())
+        return sort;
 
-            if (sort1Name != sort2Name || sort1->getArgs().size() != sort2->getArgs().size()) {
-                return false;
-            }
+    // A lone sort parameter, or a sort without any, is instantiated without building anything
+    const vector<long>& indices = info->paramIndices[pos];
+    if (indices.size() == 1)
+        return indices[0] >= 0 && bindings[indices[0]] ? bindings[indices[0]] : sort;
+
+    bool parametric = false;
+    for (auto indexIt = indices.begin(); indexIt != indices.end() && !parametric; indexIt++) {
+        parametric = *indexIt >= 0;
+    }
+
+    if (!parametric)
+        return sort;
 
-            bool fits = true;
-            for (unsigned long i = 0; i < sort1->getArgs().size(); i++) {
-                fits = fits && getParamMapping(params, mapping, sort1->getArgs()[i], sort2->getArgs()[i]);
+    size_t hash = std::hash<FunInfo*>()(info.get()) * 31 + pos;
+    for (auto sortIt = bindings.begin(); sortIt != bindings.end(); sortIt++) {
+        hash = hash * 31 + (*sortIt ? (*sortIt)->hash() : 0);
+    }
+
+    auto bucketIt = instances.find(hash);
+    if (bucketIt != instances.end()) {
+        for (auto instanceIt = bucketIt->second.begin(); instanceIt != bucketIt->second.end(); instanceIt++) {
+            if (instanceIt->info != info || instanceIt->pos != pos)
+                continue;
+
+            bool same = true;
+            for (unsigned long i = 0; i < bindings.size() && same; i++) {
+                same = equalSorts(instanceIt->bindings[i], bindings[i]);
             }
 
-            return fits;
+            if (same)
+                return instanceIt->sort;
         }
     }
-}
\ No newline at end of file
+
+    const long* index = indices.data();
+    sptr_t<Sort> result = instantiateSort(index, bindings, sort);
+
+    if (instanceCount >= MAX_INSTANCES) {
+        instances.clear();
+        instanceCount = 0;
+    }
+
+    Instance instance;
+    instance.info = info;
+    instance.pos = pos;
+    instance.bindings = bindings;
+    instance.sort = result;
+    instances[hash].push_back(instance);
+    instanceCount++;
+
+    return result;
+}
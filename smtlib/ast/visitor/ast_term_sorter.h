@@ -7,7 +7,7 @@
 #ifndef SMTLIB_PARSER_AST_TERM_SORTER_H
 #define SMTLIB_PARSER_AST_TERM_SORTER_H
 
-#include "ast_visitor_extra.h"
+#include "ast_visitor_static.h"
 
 #include "ast/stack/ast_symbol_stack.h"
 #include "util/configuration.h"
@@ -27,35 +27,55 @@ namespace smtlib {
         };
 
         /** Visitor for determining the sort of a term */
-        class TermSorter : public DummyAstVisitor1<sptr_t<Sort>> {
+        class TermSorter final : public StaticAstVisitor1<TermSorter, sptr_t<Sort>> {
         private:
             sptr_t<ITermSorterContext> ctx;
 
-            bool getParamMapping(std::vector<std::string> &params,
-                                 sptr_um2<std::string, Sort> &mapping,
-                                 sptr_t<Sort> sort1,
-                                 sptr_t<Sort> sort2);
+            /** Whether the arguments of large applications are sorted concurrently */
+            bool forking;
 
-        public:
-            inline TermSorter(sptr_t<ITermSorterContext> ctx) : ctx(ctx) { }
+            /**
+             * Match the sort at a position in the signature of a parametric function against
+             * an actual sort, binding the sort parameters of the function (indexed as in FunInfo::params)
+             */
+            bool matchParams(FunInfo* info, unsigned long pos, sptr_v<Sort>& bindings, const sptr_t<Sort>& sort);
+
+            /**
+             * Get the sort at a position in the signature of a parametric function, with its sort
+             * parameters replaced by the sorts bound to them. Instances that need a new sort are
+             * cached, so that each of them is built only once.
+             */
+            sptr_t<Sort> instantiate(const sptr_t<FunInfo>& info, unsigned long pos, const sptr_v<Sort>& bindings);
+
+            /** Determine the sort of an application whose argument sorts start at 'base' in the scratch stack */
+            void sortApplication(QualifiedTerm* node, unsigned long base);
 
-            virtual void visit(sptr_t<SimpleIdentifier> node);
-            virtual void visit(sptr_t<QualifiedIdentifier> node);
+            /**
+             * Split the arguments of a large application into parts of similar size, sort them
+             * concurrently and push their sorts on the scratch stack, up to the first one that
+             * could not be sorted. Each thread sorts against its own fork of the stack, and each
+             * part reports to a checker of its own, so that errors are added in the same order
+             * as if the arguments were sorted one after the other.
+             * \return Whether the arguments were sorted; if not, they could not be split
+             */
+            bool sortArgsConcurrently(QualifiedTerm* node);
+
+        public:
+            TermSorter(sptr_t<ITermSorterContext> ctx);
 
-            virtual void visit(sptr_t<DecimalLiteral> node);
-            virtual void visit(sptr_t<NumeralLiteral> node);
-            virtual void visit(sptr_t<StringLiteral> node);
+            virtual void visit(SimpleIdentifier* node);
+            virtual void visit(QualifiedIdentifier* node);
 
-            virtual void visit(sptr_t<QualifiedTerm> node);
-            virtual void visit(sptr_t<LetTerm> node);
-            virtual void visit(sptr_t<ForallTerm> node);
-            virtual void visit(sptr_t<ExistsTerm> node);
-            virtual void visit(sptr_t<MatchTerm> node);
-            virtual void visit(sptr_t<AnnotatedTerm> node);
+            virtual void visit(DecimalLiteral* node);
+            virtual void visit(NumeralLiteral* node);
+            virtual void visit(StringLiteral* node);
 
-            sptr_t<Sort> run(sptr_t<AstNode> node) {
-                return wrappedVisit(node);
-            }
+            virtual void visit(QualifiedTerm* node);
+            virtual void visit(LetTerm* node);
+            virtual void visit(ForallTerm* node);
+            virtual void visit(ExistsTerm* node);
+            virtual void visit(MatchTerm* node);
+            virtual void visit(AnnotatedTerm* node);
         };
     }
 }
@@ -11,292 +11,292 @@
 
 using namespace smtlib::ast;
 
-void AstVisitor0::visit0(sptr_t<AstNode> node) {
+void AstVisitor0::visit0(AstNode* node) {
     if (node == NULL) {
         return;
     }
     node->accept(this);
 }
 
-void DummyAstVisitor0::visit(sptr_t<Attribute> node) {
+void DummyAstVisitor0::visit(Attribute* node) {
     visit0(node->getKeyword());
     visit0(node->getValue());
 }
 
-void DummyAstVisitor0::visit(sptr_t<CompAttributeValue> node) {
+void DummyAstVisitor0::visit(CompAttributeValue* node) {
     visit0(node->getValues());
 }
 
-void DummyAstVisitor0::visit(sptr_t<Symbol> node) { }
+void DummyAstVisitor0::visit(Symbol* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<Keyword> node) { }
+void DummyAstVisitor0::visit(Keyword* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<MetaSpecConstant> node) { }
+void DummyAstVisitor0::visit(MetaSpecConstant* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<BooleanValue> node) { }
+void DummyAstVisitor0::visit(BooleanValue* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<PropLiteral> node) { }
+void DummyAstVisitor0::visit(PropLiteral* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<AssertCommand> node) {
+void DummyAstVisitor0::visit(AssertCommand* node) {
     visit0(node->getTerm());
 }
 
-void DummyAstVisitor0::visit(sptr_t<CheckSatCommand> node) { }
+void DummyAstVisitor0::visit(CheckSatCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<CheckSatAssumCommand> node) {
+void DummyAstVisitor0::visit(CheckSatAssumCommand* node) {
     visit0(node->getAssumptions());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DeclareConstCommand> node) {
+void DummyAstVisitor0::visit(DeclareConstCommand* node) {
     visit0(node->getSymbol());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DeclareDatatypeCommand> node) {
+void DummyAstVisitor0::visit(DeclareDatatypeCommand* node) {
     visit0(node->getSymbol());
     visit0(node->getDeclaration());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DeclareDatatypesCommand> node) {
+void DummyAstVisitor0::visit(DeclareDatatypesCommand* node) {
     visit0(node->getDeclarations());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DeclareFunCommand> node) {
+void DummyAstVisitor0::visit(DeclareFunCommand* node) {
     visit0(node->getSymbol());
     visit0(node->getParams());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DeclareSortCommand> node) {
+void DummyAstVisitor0::visit(DeclareSortCommand* node) {
     visit0(node->getSymbol());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DefineFunCommand> node) {
+void DummyAstVisitor0::visit(DefineFunCommand* node) {
     visit0(node->getDefinition());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DefineFunRecCommand> node) {
+void DummyAstVisitor0::visit(DefineFunRecCommand* node) {
     visit0(node->getDefinition());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DefineFunsRecCommand> node) {
+void DummyAstVisitor0::visit(DefineFunsRecCommand* node) {
     visit0(node->getDeclarations());
     visit0(node->getBodies());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DefineSortCommand> node) {
+void DummyAstVisitor0::visit(DefineSortCommand* node) {
     visit0(node->getSymbol());
     visit0(node->getParams());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<EchoCommand> node) { }
+void DummyAstVisitor0::visit(EchoCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<ExitCommand> node) { }
+void DummyAstVisitor0::visit(ExitCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetAssertsCommand> node) { }
+void DummyAstVisitor0::visit(GetAssertsCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetAssignsCommand> node) { }
+void DummyAstVisitor0::visit(GetAssignsCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetInfoCommand> node) {
+void DummyAstVisitor0::visit(GetInfoCommand* node) {
     visit0(node->getFlag());
 }
 
-void DummyAstVisitor0::visit(sptr_t<GetModelCommand> node) { }
+void DummyAstVisitor0::visit(GetModelCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetOptionCommand> node) {
+void DummyAstVisitor0::visit(GetOptionCommand* node) {
     visit0(node->getOption());
 }
 
-void DummyAstVisitor0::visit(sptr_t<GetProofCommand> node) { }
+void DummyAstVisitor0::visit(GetProofCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetUnsatAssumsCommand> node) { }
+void DummyAstVisitor0::visit(GetUnsatAssumsCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetUnsatCoreCommand> node) { }
+void DummyAstVisitor0::visit(GetUnsatCoreCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<GetValueCommand> node) {
+void DummyAstVisitor0::visit(GetValueCommand* node) {
     visit0(node->getTerms());
 }
 
-void DummyAstVisitor0::visit(sptr_t<PopCommand> node) {
+void DummyAstVisitor0::visit(PopCommand* node) {
     visit0(node->getNumeral());
 }
 
-void DummyAstVisitor0::visit(sptr_t<PushCommand> node) {
+void DummyAstVisitor0::visit(PushCommand* node) {
     visit0(node->getNumeral());
 }
 
-void DummyAstVisitor0::visit(sptr_t<ResetCommand> node) { }
+void DummyAstVisitor0::visit(ResetCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<ResetAssertsCommand> node) { }
+void DummyAstVisitor0::visit(ResetAssertsCommand* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<SetInfoCommand> node) {
+void DummyAstVisitor0::visit(SetInfoCommand* node) {
     visit0(node->getInfo());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SetLogicCommand> node) {
+void DummyAstVisitor0::visit(SetLogicCommand* node) {
     visit0(node->getLogic());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SetOptionCommand> node) {
+void DummyAstVisitor0::visit(SetOptionCommand* node) {
     visit0(node->getOption());
 }
 
-void DummyAstVisitor0::visit(sptr_t<FunctionDeclaration> node) {
+void DummyAstVisitor0::visit(FunctionDeclaration* node) {
     visit0(node->getSymbol());
     visit0(node->getParams());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<FunctionDefinition> node) {
+void DummyAstVisitor0::visit(FunctionDefinition* node) {
     visit0(node->getSignature());
     visit0(node->getBody());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SimpleIdentifier> node) {
+void DummyAstVisitor0::visit(SimpleIdentifier* node) {
     visit0(node->getSymbol());
 }
 
-void DummyAstVisitor0::visit(sptr_t<QualifiedIdentifier> node) {
+void DummyAstVisitor0::visit(QualifiedIdentifier* node) {
     visit0(node->getIdentifier());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<DecimalLiteral> node) { }
+void DummyAstVisitor0::visit(DecimalLiteral* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<NumeralLiteral> node) { }
+void DummyAstVisitor0::visit(NumeralLiteral* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<StringLiteral> node) { }
+void DummyAstVisitor0::visit(StringLiteral* node) { }
 
-void DummyAstVisitor0::visit(sptr_t<Logic> node) {
+void DummyAstVisitor0::visit(Logic* node) {
     visit0(node->getName());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<Theory> node) {
+void DummyAstVisitor0::visit(Theory* node) {
     visit0(node->getName());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<Script> node) {
+void DummyAstVisitor0::visit(Script* node) {
     visit0(node->getCommands());
 }
 
-void DummyAstVisitor0::visit(sptr_t<Sort> node) {
+void DummyAstVisitor0::visit(Sort* node) {
     visit0(node->getIdentifier());
     visit0(node->getArgs());
 }
 
-void DummyAstVisitor0::visit(sptr_t<CompSExpression> node) {
+void DummyAstVisitor0::visit(CompSExpression* node) {
     visit0(node->getExpressions());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SortSymbolDeclaration> node) {
+void DummyAstVisitor0::visit(SortSymbolDeclaration* node) {
     visit0(node->getIdentifier());
     visit0(node->getArity());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SortDeclaration> node) {
+void DummyAstVisitor0::visit(SortDeclaration* node) {
     visit0(node->getSymbol());
     visit0(node->getArity());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SelectorDeclaration> node) {
+void DummyAstVisitor0::visit(SelectorDeclaration* node) {
     visit0(node->getSymbol());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<ConstructorDeclaration> node) {
+void DummyAstVisitor0::visit(ConstructorDeclaration* node) {
     visit0(node->getSymbol());
     visit0(node->getSelectors());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SimpleDatatypeDeclaration> node) {
+void DummyAstVisitor0::visit(SimpleDatatypeDeclaration* node) {
     visit0(node->getConstructors());
 }
 
-void DummyAstVisitor0::visit(sptr_t<ParametricDatatypeDeclaration> node) {
+void DummyAstVisitor0::visit(ParametricDatatypeDeclaration* node) {
     visit0(node->getConstructors());
     visit0(node->getParams());
 }
 
-void DummyAstVisitor0::visit(sptr_t<QualifiedConstructor> node) {
+void DummyAstVisitor0::visit(QualifiedConstructor* node) {
     visit0(node->getSymbol());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<QualifiedPattern> node) {
+void DummyAstVisitor0::visit(QualifiedPattern* node) {
     visit0(node->getConstructor());
     visit0(node->getSymbols());
 }
 
-void DummyAstVisitor0::visit(sptr_t<MatchCase> node) {
+void DummyAstVisitor0::visit(MatchCase* node) {
     visit0(node->getPattern());
     visit0(node->getTerm());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SpecConstFunDeclaration> node) {
+void DummyAstVisitor0::visit(SpecConstFunDeclaration* node) {
     visit0(node->getConstant());
     visit0(node->getSort());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<MetaSpecConstFunDeclaration> node) {
+void DummyAstVisitor0::visit(MetaSpecConstFunDeclaration* node) {
     visit0(node->getConstant());
     visit0(node->getSort());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SimpleFunDeclaration> node) {
+void DummyAstVisitor0::visit(SimpleFunDeclaration* node) {
     visit0(node->getIdentifier());
     visit0(node->getSignature());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<ParametricFunDeclaration> node) {
+void DummyAstVisitor0::visit(ParametricFunDeclaration* node) {
     visit0(node->getParams());
     visit0(node->getIdentifier());
     visit0(node->getSignature());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<QualifiedTerm> node) {
+void DummyAstVisitor0::visit(QualifiedTerm* node) {
     visit0(node->getIdentifier());
     visit0(node->getTerms());
 }
 
-void DummyAstVisitor0::visit(sptr_t<LetTerm> node) {
+void DummyAstVisitor0::visit(LetTerm* node) {
     visit0(node->getBindings());
     visit0(node->getTerm());
 }
 
-void DummyAstVisitor0::visit(sptr_t<ForallTerm> node) {
+void DummyAstVisitor0::visit(ForallTerm* node) {
     visit0(node->getBindings());
     visit0(node->getTerm());
 }
 
-void DummyAstVisitor0::visit(sptr_t<ExistsTerm> node) {
+void DummyAstVisitor0::visit(ExistsTerm* node) {
     visit0(node->getBindings());
     visit0(node->getTerm());
 }
 
-void DummyAstVisitor0::visit(sptr_t<MatchTerm> node) {
+void DummyAstVisitor0::visit(MatchTerm* node) {
     visit0(node->getTerm());
     visit0(node->getCases());
 }
 
-void DummyAstVisitor0::visit(sptr_t<AnnotatedTerm> node) {
+void DummyAstVisitor0::visit(AnnotatedTerm* node) {
     visit0(node->getTerm());
     visit0(node->getAttributes());
 }
 
-void DummyAstVisitor0::visit(sptr_t<SortedVariable> node) {
+void DummyAstVisitor0::visit(SortedVariable* node) {
     visit0(node->getSymbol());
     visit0(node->getSort());
 }
 
-void DummyAstVisitor0::visit(sptr_t<VarBinding> node) {
+void DummyAstVisitor0::visit(VarBinding* node) {
     visit0(node->getSymbol());
     visit0(node->getTerm());
 }
\ No newline at end of file
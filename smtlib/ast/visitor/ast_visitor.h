@@ -18,7 +18,11 @@ namespace smtlib {
     namespace ast {
         class AstVisitor0 {
         protected:
-            virtual void visit0(sptr_t<AstNode> node);
+            virtual void visit0(AstNode* node);
+            template<class T>
+            void visit0(const sptr_t<T>& node) {
+                visit0(node.get());
+            }
             template<class T>
             void visit0(sptr_v<T>& arr) {
                 for (auto item = arr.begin(); item != arr.end(); item++) {
@@ -26,176 +30,176 @@ namespace smtlib {
                 }
             }
         public:
-            virtual void visit(sptr_t<Attribute> node) = 0;
-            virtual void visit(sptr_t<CompAttributeValue> node) = 0;
-
-            virtual void visit(sptr_t<Symbol> node) = 0;
-            virtual void visit(sptr_t<Keyword> node) = 0;
-            virtual void visit(sptr_t<MetaSpecConstant> node) = 0;
-            virtual void visit(sptr_t<BooleanValue> node) = 0;
-            virtual void visit(sptr_t<PropLiteral> node) = 0;
-
-            virtual void visit(sptr_t<AssertCommand> node) = 0;
-            virtual void visit(sptr_t<CheckSatCommand> node) = 0;
-            virtual void visit(sptr_t<CheckSatAssumCommand> node) = 0;
-            virtual void visit(sptr_t<DeclareConstCommand> node) = 0;
-            virtual void visit(sptr_t<DeclareDatatypeCommand> node) = 0;
-            virtual void visit(sptr_t<DeclareDatatypesCommand> node) = 0;
-            virtual void visit(sptr_t<DeclareFunCommand> node) = 0;
-            virtual void visit(sptr_t<DeclareSortCommand> node) = 0;
-            virtual void visit(sptr_t<DefineFunCommand> node) = 0;
-            virtual void visit(sptr_t<DefineFunRecCommand> node) = 0;
-            virtual void visit(sptr_t<DefineFunsRecCommand> node) = 0;
-            virtual void visit(sptr_t<DefineSortCommand> node) = 0;
-            virtual void visit(sptr_t<EchoCommand> node) = 0;
-            virtual void visit(sptr_t<ExitCommand> node) = 0;
-            virtual void visit(sptr_t<GetAssertsCommand> node) = 0;
-            virtual void visit(sptr_t<GetAssignsCommand> node) = 0;
-            virtual void visit(sptr_t<GetInfoCommand> node) = 0;
-            virtual void visit(sptr_t<GetModelCommand> node) = 0;
-            virtual void visit(sptr_t<GetOptionCommand> node) = 0;
-            virtual void visit(sptr_t<GetProofCommand> node) = 0;
-            virtual void visit(sptr_t<GetUnsatAssumsCommand> node) = 0;
-            virtual void visit(sptr_t<GetUnsatCoreCommand> node) = 0;
-            virtual void visit(sptr_t<GetValueCommand> node) = 0;
-            virtual void visit(sptr_t<PopCommand> node) = 0;
-            virtual void visit(sptr_t<PushCommand> node) = 0;
-            virtual void visit(sptr_t<ResetCommand> node) = 0;
-            virtual void visit(sptr_t<ResetAssertsCommand> node) = 0;
-            virtual void visit(sptr_t<SetInfoCommand> node) = 0;
-            virtual void visit(sptr_t<SetLogicCommand> node) = 0;
-            virtual void visit(sptr_t<SetOptionCommand> node) = 0;
-
-            virtual void visit(sptr_t<FunctionDeclaration> node) = 0;
-            virtual void visit(sptr_t<FunctionDefinition> node) = 0;
-
-            virtual void visit(sptr_t<SimpleIdentifier> node) = 0;
-            virtual void visit(sptr_t<QualifiedIdentifier> node) = 0;
-
-            virtual void visit(sptr_t<DecimalLiteral> node) = 0;
-            virtual void visit(sptr_t<NumeralLiteral> node) = 0;
-            virtual void visit(sptr_t<StringLiteral> node) = 0;
-
-            virtual void visit(sptr_t<Logic> node) = 0;
-            virtual void visit(sptr_t<Theory> node) = 0;
-            virtual void visit(sptr_t<Script> node) = 0;
-
-            virtual void visit(sptr_t<Sort> node) = 0;
-
-            virtual void visit(sptr_t<CompSExpression> node) = 0;
-
-            virtual void visit(sptr_t<SortSymbolDeclaration> node) = 0;
-            virtual void visit(sptr_t<SpecConstFunDeclaration> node) = 0;
-            virtual void visit(sptr_t<MetaSpecConstFunDeclaration> node) = 0;
-            virtual void visit(sptr_t<SimpleFunDeclaration> node) = 0;
-            virtual void visit(sptr_t<ParametricFunDeclaration> node) = 0;
-
-            virtual void visit(sptr_t<SortDeclaration> node) = 0;
-            virtual void visit(sptr_t<SelectorDeclaration> node) = 0;
-            virtual void visit(sptr_t<ConstructorDeclaration> node) = 0;
-            virtual void visit(sptr_t<SimpleDatatypeDeclaration> node) = 0;
-            virtual void visit(sptr_t<ParametricDatatypeDeclaration> node) = 0;
-
-            virtual void visit(sptr_t<QualifiedConstructor> node) = 0;
-            virtual void visit(sptr_t<QualifiedPattern> node) = 0;
-            virtual void visit(sptr_t<MatchCase> node) = 0;
-
-            virtual void visit(sptr_t<QualifiedTerm> node) = 0;
-            virtual void visit(sptr_t<LetTerm> node) = 0;
-            virtual void visit(sptr_t<ForallTerm> node) = 0;
-            virtual void visit(sptr_t<ExistsTerm> node) = 0;
-            virtual void visit(sptr_t<MatchTerm> node) = 0;
-            virtual void visit(sptr_t<AnnotatedTerm> node) = 0;
-
-            virtual void visit(sptr_t<SortedVariable> node) = 0;
-            virtual void visit(sptr_t<VarBinding> node) = 0;
+            virtual void visit(Attribute* node) = 0;
+            virtual void visit(CompAttributeValue* node) = 0;
+
+            virtual void visit(Symbol* node) = 0;
+            virtual void visit(Keyword* node) = 0;
+            virtual void visit(MetaSpecConstant* node) = 0;
+            virtual void visit(BooleanValue* node) = 0;
+            virtual void visit(PropLiteral* node) = 0;
+
+            virtual void visit(AssertCommand* node) = 0;
+            virtual void visit(CheckSatCommand* node) = 0;
+            virtual void visit(CheckSatAssumCommand* node) = 0;
+            virtual void visit(DeclareConstCommand* node) = 0;
+            virtual void visit(DeclareDatatypeCommand* node) = 0;
+            virtual void visit(DeclareDatatypesCommand* node) = 0;
+            virtual void visit(DeclareFunCommand* node) = 0;
+            virtual void visit(DeclareSortCommand* node) = 0;
+            virtual void visit(DefineFunCommand* node) = 0;
+            virtual void visit(DefineFunRecCommand* node) = 0;
+            virtual void visit(DefineFunsRecCommand* node) = 0;
+            virtual void visit(DefineSortCommand* node) = 0;
+            virtual void visit(EchoCommand* node) = 0;
+            virtual void visit(ExitCommand* node) = 0;
+            virtual void visit(GetAssertsCommand* node) = 0;
+            virtual void visit(GetAssignsCommand* node) = 0;
+            virtual void visit(GetInfoCommand* node) = 0;
+            virtual void visit(GetModelCommand* node) = 0;
+            virtual void visit(GetOptionCommand* node) = 0;
+            virtual void visit(GetProofCommand* node) = 0;
+            virtual void visit(GetUnsatAssumsCommand* node) = 0;
+            virtual void visit(GetUnsatCoreCommand* node) = 0;
+            virtual void visit(GetValueCommand* node) = 0;
+            virtual void visit(PopCommand* node) = 0;
+            virtual void visit(PushCommand* node) = 0;
+            virtual void visit(ResetCommand* node) = 0;
+            virtual void visit(ResetAssertsCommand* node) = 0;
+            virtual void visit(SetInfoCommand* node) = 0;
+            virtual void visit(SetLogicCommand* node) = 0;
+            virtual void visit(SetOptionCommand* node) = 0;
+
+            virtual void visit(FunctionDeclaration* node) = 0;
+            virtual void visit(FunctionDefinition* node) = 0;
+
+            virtual void visit(SimpleIdentifier* node) = 0;
+            virtual void visit(QualifiedIdentifier* node) = 0;
+
+            virtual void visit(DecimalLiteral* node) = 0;
+            virtual void visit(NumeralLiteral* node) = 0;
+            virtual void visit(StringLiteral* node) = 0;
+
+            virtual void visit(Logic* node) = 0;
+            virtual void visit(Theory* node) = 0;
+            virtual void visit(Script* node) = 0;
+
+            virtual void visit(Sort* node) = 0;
+
+            virtual void visit(CompSExpression* node) = 0;
+
+            virtual void visit(SortSymbolDeclaration* node) = 0;
+            virtual void visit(SpecConstFunDeclaration* node) = 0;
+            virtual void visit(MetaSpecConstFunDeclaration* node) = 0;
+            virtual void visit(SimpleFunDeclaration* node) = 0;
+            virtual void visit(ParametricFunDeclaration* node) = 0;
+
+            virtual void visit(SortDeclaration* node) = 0;
+            virtual void visit(SelectorDeclaration* node) = 0;
+            virtual void visit(ConstructorDeclaration* node) = 0;
+            virtual void visit(SimpleDatatypeDeclaration* node) = 0;
+            virtual void visit(ParametricDatatypeDeclaration* node) = 0;
+
+            virtual void visit(QualifiedConstructor* node) = 0;
+            virtual void visit(QualifiedPattern* node) = 0;
+            virtual void visit(MatchCase* node) = 0;
+
+            virtual void visit(QualifiedTerm* node) = 0;
+            virtual void visit(LetTerm* node) = 0;
+            virtual void visit(ForallTerm* node) = 0;
+            virtual void visit(ExistsTerm* node) = 0;
+            virtual void visit(MatchTerm* node) = 0;
+            virtual void visit(AnnotatedTerm* node) = 0;
+
+            virtual void visit(SortedVariable* node) = 0;
+            virtual void visit(VarBinding* node) = 0;
         };
 
         class DummyAstVisitor0 : public virtual AstVisitor0 {
         public:
-            virtual void visit(sptr_t<Attribute> node);
-            virtual void visit(sptr_t<CompAttributeValue> node);
-
-            virtual void visit(sptr_t<Symbol> node);
-            virtual void visit(sptr_t<Keyword> node);
-            virtual void visit(sptr_t<MetaSpecConstant> node);
-            virtual void visit(sptr_t<BooleanValue> node);
-            virtual void visit(sptr_t<PropLiteral> node);
-
-            virtual void visit(sptr_t<AssertCommand> node);
-            virtual void visit(sptr_t<CheckSatCommand> node);
-            virtual void visit(sptr_t<CheckSatAssumCommand> node);
-            virtual void visit(sptr_t<DeclareConstCommand> node);
-            virtual void visit(sptr_t<DeclareDatatypeCommand> node);
-            virtual void visit(sptr_t<DeclareDatatypesCommand> node);
-            virtual void visit(sptr_t<DeclareFunCommand> node);
-            virtual void visit(sptr_t<DeclareSortCommand> node);
-            virtual void visit(sptr_t<DefineFunCommand> node);
-            virtual void visit(sptr_t<DefineFunRecCommand> node);
-            virtual void visit(sptr_t<DefineFunsRecCommand> node);
-            virtual void visit(sptr_t<DefineSortCommand> node);
-            virtual void visit(sptr_t<EchoCommand> node);
-            virtual void visit(sptr_t<ExitCommand> node);
-            virtual void visit(sptr_t<GetAssertsCommand> node);
-            virtual void visit(sptr_t<GetAssignsCommand> node);
-            virtual void visit(sptr_t<GetInfoCommand> node);
-            virtual void visit(sptr_t<GetModelCommand> node);
-            virtual void visit(sptr_t<GetOptionCommand> node);
-            virtual void visit(sptr_t<GetProofCommand> node);
-            virtual void visit(sptr_t<GetUnsatAssumsCommand> node);
-            virtual void visit(sptr_t<GetUnsatCoreCommand> node);
-            virtual void visit(sptr_t<GetValueCommand> node);
-            virtual void visit(sptr_t<PopCommand> node);
-            virtual void visit(sptr_t<PushCommand> node);
-            virtual void visit(sptr_t<ResetCommand> node);
-            virtual void visit(sptr_t<ResetAssertsCommand> node);
-            virtual void visit(sptr_t<SetInfoCommand> node);
-            virtual void visit(sptr_t<SetLogicCommand> node);
-            virtual void visit(sptr_t<SetOptionCommand> node);
-
-            virtual void visit(sptr_t<FunctionDeclaration> node);
-            virtual void visit(sptr_t<FunctionDefinition> node);
-
-            virtual void visit(sptr_t<SimpleIdentifier> node);
-            virtual void visit(sptr_t<QualifiedIdentifier> node);
-
-            virtual void visit(sptr_t<DecimalLiteral> node);
-            virtual void visit(sptr_t<NumeralLiteral> node);
-            virtual void visit(sptr_t<StringLiteral> node);
-
-            virtual void visit(sptr_t<Logic> node);
-            virtual void visit(sptr_t<Theory> node);
-            virtual void visit(sptr_t<Script> node);
-
-            virtual void visit(sptr_t<Sort> node);
-
-            virtual void visit(sptr_t<CompSExpression> node);
-
-            virtual void visit(sptr_t<SortSymbolDeclaration> node);
-            virtual void visit(sptr_t<SortDeclaration> node);
-            virtual void visit(sptr_t<SelectorDeclaration> node);
-            virtual void visit(sptr_t<ConstructorDeclaration> node);
-            virtual void visit(sptr_t<SimpleDatatypeDeclaration> node);
-            virtual void visit(sptr_t<ParametricDatatypeDeclaration> node);
-
-            virtual void visit(sptr_t<SpecConstFunDeclaration> node);
-            virtual void visit(sptr_t<MetaSpecConstFunDeclaration> node);
-            virtual void visit(sptr_t<SimpleFunDeclaration> node);
-            virtual void visit(sptr_t<ParametricFunDeclaration> node);
-
-            virtual void visit(sptr_t<QualifiedConstructor> node);
-            virtual void visit(sptr_t<QualifiedPattern> node);
-            virtual void visit(sptr_t<MatchCase> node);
-
-            virtual void visit(sptr_t<QualifiedTerm> node);
-            virtual void visit(sptr_t<LetTerm> node);
-            virtual void visit(sptr_t<ForallTerm> node);
-            virtual void visit(sptr_t<ExistsTerm> node);
-            virtual void visit(sptr_t<MatchTerm> node);
-            virtual void visit(sptr_t<AnnotatedTerm> node);
-
-            virtual void visit(sptr_t<SortedVariable> node);
-            virtual void visit(sptr_t<VarBinding> node);
+            virtual void visit(Attribute* node);
+            virtual void visit(CompAttributeValue* node);
+
+            virtual void visit(Symbol* node);
+            virtual void visit(Keyword* node);
+            virtual void visit(MetaSpecConstant* node);
+            virtual void visit(BooleanValue* node);
+            virtual void visit(PropLiteral* node);
+
+            virtual void visit(AssertCommand* node);
+            virtual void visit(CheckSatCommand* node);
+            virtual void visit(CheckSatAssumCommand* node);
+            virtual void visit(DeclareConstCommand* node);
+            virtual void visit(DeclareDatatypeCommand* node);
+            virtual void visit(DeclareDatatypesCommand* node);
+            virtual void visit(DeclareFunCommand* node);
+            virtual void visit(DeclareSortCommand* node);
+            virtual void visit(DefineFunCommand* node);
+            virtual void visit(DefineFunRecCommand* node);
+            virtual void visit(DefineFunsRecCommand* node);
+            virtual void visit(DefineSortCommand* node);
+            virtual void visit(EchoCommand* node);
+            virtual void visit(ExitCommand* node);
+            virtual void visit(GetAssertsCommand* node);
+            virtual void visit(GetAssignsCommand* node);
+            virtual void visit(GetInfoCommand* node);
+            virtual void visit(GetModelCommand* node);
+            virtual void visit(GetOptionCommand* node);
+            virtual void visit(GetProofCommand* node);
+            virtual void visit(GetUnsatAssumsCommand* node);
+            virtual void visit(GetUnsatCoreCommand* node);
+            virtual void visit(GetValueCommand* node);
+            virtual void visit(PopCommand* node);
+            virtual void visit(PushCommand* node);
+            virtual void visit(ResetCommand* node);
+            virtual void visit(ResetAssertsCommand* node);
+            virtual void visit(SetInfoCommand* node);
+            virtual void visit(SetLogicCommand* node);
+            virtual void visit(SetOptionCommand* node);
+
+            virtual void visit(FunctionDeclaration* node);
+            virtual void visit(FunctionDefinition* node);
+
+            virtual void visit(SimpleIdentifier* node);
+            virtual void visit(QualifiedIdentifier* node);
+
+            virtual void visit(DecimalLiteral* node);
+            virtual void visit(NumeralLiteral* node);
+            virtual void visit(StringLiteral* node);
+
+            virtual void visit(Logic* node);
+            virtual void visit(Theory* node);
+            virtual void visit(Script* node);
+
+            virtual void visit(Sort* node);
+
+            virtual void visit(CompSExpression* node);
+
+            virtual void visit(SortSymbolDeclaration* node);
+            virtual void visit(SortDeclaration* node);
+            virtual void visit(SelectorDeclaration* node);
+            virtual void visit(ConstructorDeclaration* node);
+            virtual void visit(SimpleDatatypeDeclaration* node);
+            virtual void visit(ParametricDatatypeDeclaration* node);
+
+            virtual void visit(SpecConstFunDeclaration* node);
+            virtual void visit(MetaSpecConstFunDeclaration* node);
+            virtual void visit(SimpleFunDeclaration* node);
+            virtual void visit(ParametricFunDeclaration* node);
+
+            virtual void visit(QualifiedConstructor* node);
+            virtual void visit(QualifiedPattern* node);
+            virtual void visit(MatchCase* node);
+
+            virtual void visit(QualifiedTerm* node);
+            virtual void visit(LetTerm* node);
+            virtual void visit(ForallTerm* node);
+            virtual void visit(ExistsTerm* node);
+            virtual void visit(MatchTerm* node);
+            virtual void visit(AnnotatedTerm* node);
+
+            virtual void visit(SortedVariable* node);
+            virtual void visit(VarBinding* node);
         };
     }
 }
@@ -12,21 +12,29 @@
 #include "ast/ast_abstract.h"
 #include "util/logger.h"
 
+#include <utility>
+
 namespace smtlib {
     namespace ast {
         template<class RetT>
         class AstVisitor1 : public virtual AstVisitor0 {
         protected:
             RetT ret;
-            RetT wrappedVisit(sptr_t<AstNode> node) {
-                RetT oldRet = ret;
-                visit0(node);
-                RetT newRet = ret;
-                ret = oldRet;
+            RetT wrappedVisit(AstNode* node) {
+                RetT oldRet = std::move(ret);
+                ret = RetT();
+                this->visit0(node);
+                RetT newRet = std::move(ret);
+                ret = std::move(oldRet);
                 return newRet;
             }
+
+            template<class T>
+            RetT wrappedVisit(const sptr_t<T>& node) {
+                return wrappedVisit(node.get());
+            }
         public:
-            virtual RetT run (sptr_t<AstNode> node) {
+            virtual RetT run(AstNode* node) {
                 return wrappedVisit(node);
             }
         };
@@ -37,19 +45,25 @@ namespace smtlib {
             ArgT arg;
             RetT ret;
 
-            RetT wrappedVisit(ArgT arg, sptr_t<AstNode> node) {
-                RetT oldRet = ret;
-                ArgT oldArg = this->arg;
-                this->arg = arg;
-                visit0(node);
-                RetT newRet = ret;
-                ret = oldRet;
-                this->arg = oldArg;
+            RetT wrappedVisit(ArgT arg, AstNode* node) {
+                RetT oldRet = std::move(ret);
+                ArgT oldArg = std::move(this->arg);
+                ret = RetT();
+                this->arg = std::move(arg);
+                this->visit0(node);
+                RetT newRet = std::move(ret);
+                ret = std::move(oldRet);
+                this->arg = std::move(oldArg);
                 return newRet;
             }
+
+            template<class T>
+            RetT wrappedVisit(ArgT arg, const sptr_t<T>& node) {
+                return wrappedVisit(std::move(arg), node.get());
+            }
         public:
-            virtual RetT run(ArgT arg, sptr_t<AstNode> node) {
-                return wrappedVisit(arg, node);
+            virtual RetT run(ArgT arg, AstNode* node) {
+                return wrappedVisit(std::move(arg), node);
             }
         };
 
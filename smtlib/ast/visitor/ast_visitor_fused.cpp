@@ -0,0 +1,61 @@
+#include "ast_visitor_fused.h"
+
+#include "ast/ast_script.h"
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+void FusedVisitor::add(sptr_t<IFusableVisitor> visitor) {
+    visitors.push_back(visitor);
+}
+
+void FusedVisitor::begin() {
+    active = visitors.size();
+    for (auto visitorIt = visitors.begin(); visitorIt != visitors.end(); visitorIt++) {
+        (*visitorIt)->enter();
+    }
+}
+
+bool FusedVisitor::visitPart(AstNode* part) {
+    bool clean = true;
+    for (unsigned long i = 0; i < active; i++) {
+        unsigned long errorCount = visitors[i]->getErrorCount();
+        visitors[i]->visitPart(part);
+
+        if (visitors[i]->getErrorCount() != errorCount) {
+            clean = false;
+            active = i + 1;
+        }
+    }
+
+    return clean;
+}
+
+bool FusedVisitor::end() {
+    for (auto visitorIt = visitors.rbegin(); visitorIt != visitors.rend(); visitorIt++) {
+        (*visitorIt)->leave();
+    }
+
+    for (auto visitorIt = visitors.begin(); visitorIt != visitors.end(); visitorIt++) {
+        if ((*visitorIt)->getErrorCount() > 0)
+            return false;
+    }
+
+    return true;
+}
+
+bool FusedVisitor::run(sptr_t<AstNode> root) {
+    begin();
+
+    if (root->getKind() == NODE_SCRIPT) {
+        sptr_v<Command>& commands = dynamic_cast<Script*>(root.get())->getCommands();
+        for (auto cmdIt = commands.begin(); cmdIt != commands.end() && active > 0; cmdIt++) {
+            visitPart((*cmdIt).get());
+        }
+    } else {
+        visitPart(root.get());
+    }
+
+    return end();
+}
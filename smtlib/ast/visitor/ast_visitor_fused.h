@@ -0,0 +1,81 @@
+/**
+ * \file ast_visitor_fused.h
+ * \brief Running several visitors in a single traversal of the SMT-LIB AST.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_AST_VISITOR_FUSED_H
+#define SMTLIB_PARSER_AST_VISITOR_FUSED_H
+
+#include "ast/ast_abstract.h"
+#include "util/global_typedef.h"
+
+#include <vector>
+
+namespace smtlib {
+    namespace ast {
+        /** Visitor that can share a traversal with other visitors (see FusedVisitor) */
+        class IFusableVisitor {
+        public:
+            /** Called before any part of the tree is visited */
+            virtual void enter() { }
+
+            /** Visit a part of the tree: one command of a script, or the whole tree otherwise */
+            virtual void visitPart(AstNode* part) = 0;
+
+            /** Called after all parts of the tree have been visited */
+            virtual void leave() { }
+
+            /** Number of errors found so far */
+            virtual unsigned long getErrorCount() = 0;
+        };
+
+        /**
+         * Runs several visitors in a single traversal of a tree. A script is
+         * visited one command at a time, each command being handed to all the
+         * visitors in the order in which they were added, while it is still in
+         * cache. The enter() hooks are called in the same order before the first
+         * command, and the leave() hooks in reverse order after the last one.
+         * Once a visitor has found errors, the visitors added after it are given
+         * no further parts, since they may rely on the earlier ones to succeed.
+         *
+         * Parts can also be handed over one by one, as they become available,
+         * between calls to begin() and end().
+         */
+        class FusedVisitor {
+        private:
+            sptr_v<IFusableVisitor> visitors;
+
+            /** Number of visitors, from the first one, that have not been stopped */
+            unsigned long active;
+
+        public:
+            inline FusedVisitor() : active(0) { }
+
+            void add(sptr_t<IFusableVisitor> visitor);
+
+            /** Call the enter() hooks */
+            void begin();
+
+            /**
+             * Visit a part of a tree with the visitors that have not been stopped
+             * \return Whether no errors were found in the part
+             */
+            bool visitPart(AstNode* part);
+
+            /**
+             * Call the leave() hooks
+             * \return Whether none of the visitors found errors
+             */
+            bool end();
+
+            /**
+             * Visit a whole tree
+             * \return Whether none of the visitors found errors
+             */
+            bool run(sptr_t<AstNode> root);
+        };
+    }
+}
+
+#endif //SMTLIB_PARSER_AST_VISITOR_FUSED_H
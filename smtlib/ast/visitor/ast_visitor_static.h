@@ -0,0 +1,101 @@
+/**
+ * \file ast_visitor_static.h
+ * \brief Visitors with compile-time dispatch for the SMT-LIB AST.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_AST_VISITOR_STATIC_H
+#define SMTLIB_PARSER_AST_VISITOR_STATIC_H
+
+#include "ast_visitor_extra.h"
+
+#include "ast/ast_identifier.h"
+#include "ast/ast_literal.h"
+#include "ast/ast_term.h"
+
+#include <utility>
+
+namespace smtlib {
+    namespace ast {
+        /**
+         * Visitor with a return value and compile-time dispatch on terms.
+         * The derived class is given as template argument and should be final, so that
+         * the calls made by visitTerm() are resolved statically and can be inlined.
+         * All visit() overloads for terms must be visible in the derived class.
+         * Other nodes are still dispatched through the virtual interface.
+         */
+        template<class Derived, class RetT>
+        class StaticAstVisitor1 : public DummyAstVisitor1<RetT> {
+        protected:
+            using DummyAstVisitor1<RetT>::wrappedVisit;
+
+            /** Visit a term, selecting the method to call from the kind of the node */
+            inline void visitTerm(Term* node) {
+                if (node == NULL) {
+                    return;
+                }
+
+                Derived* self = static_cast<Derived*>(this);
+                switch (node->getKind()) {
+                    case NODE_SIMPLE_IDENTIFIER:
+                        self->visit(static_cast<SimpleIdentifier*>(node));
+                        break;
+                    case NODE_QUALIFIED_IDENTIFIER:
+                        self->visit(static_cast<QualifiedIdentifier*>(node));
+                        break;
+                    case NODE_DECIMAL_LITERAL:
+                        self->visit(static_cast<DecimalLiteral*>(node));
+                        break;
+                    case NODE_NUMERAL_LITERAL:
+                        self->visit(static_cast<NumeralLiteral*>(node));
+                        break;
+                    case NODE_STRING_LITERAL:
+                        self->visit(static_cast<StringLiteral*>(node));
+                        break;
+                    case NODE_QUALIFIED_TERM:
+                        self->visit(static_cast<QualifiedTerm*>(node));
+                        break;
+                    case NODE_LET_TERM:
+                        self->visit(static_cast<LetTerm*>(node));
+                        break;
+                    case NODE_FORALL_TERM:
+                        self->visit(static_cast<ForallTerm*>(node));
+                        break;
+                    case NODE_EXISTS_TERM:
+                        self->visit(static_cast<ExistsTerm*>(node));
+                        break;
+                    case NODE_MATCH_TERM:
+                        self->visit(static_cast<MatchTerm*>(node));
+                        break;
+                    case NODE_ANNOTATED_TERM:
+                        self->visit(static_cast<AnnotatedTerm*>(node));
+                        break;
+                    default:
+                        node->accept(self);
+                }
+            }
+
+            RetT wrappedVisit(Term* node) {
+                RetT oldRet = std::move(this->ret);
+                this->ret = RetT();
+                visitTerm(node);
+                RetT newRet = std::move(this->ret);
+                this->ret = std::move(oldRet);
+                return newRet;
+            }
+
+            template<class T>
+            RetT wrappedVisit(const sptr_t<T>& node) {
+                return wrappedVisit(node.get());
+            }
+        public:
+            using DummyAstVisitor1<RetT>::run;
+
+            RetT run(Term* node) {
+                return wrappedVisit(node);
+            }
+        };
+    }
+}
+
+#endif //SMTLIB_PARSER_AST_VISITOR_STATIC_H
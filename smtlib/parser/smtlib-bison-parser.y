@@ -10,7 +10,7 @@ int yylex();
 int yyerror(SmtPrsr parser, const char *);
 
 #define YYMAXDEPTH 300000
-#define YYINITDEPTH 300000
+#define YYINITDEPTH 200 /* grows up to YYMAXDEPTH, leaving room for nested parses */
 %}
 
 %locations
@@ -82,7 +82,7 @@ command_plus:
 	command 				
 		{ 	
 			$$ = smt_listCreate(); 
-			smt_listAdd($$, $1); 
+			smt_addCommand(parser, $$, $1); 
 
 			@$.first_line = @1.first_line;
             @$.first_column = @1.first_column;
@@ -92,7 +92,7 @@ command_plus:
 |
 	command_plus command 	
 		{ 
-			smt_listAdd($1, $2); 
+			smt_addCommand(parser, $1, $2); 
 			$$ = $1; 
 
 			@$.first_line = @1.first_line;
@@ -71,7 +71,7 @@ int yylex();
 int yyerror(SmtPrsr parser, const char *);
 
 #define YYMAXDEPTH 300000
-#define YYINITDEPTH 300000
+#define YYINITDEPTH 200 /* grows up to YYMAXDEPTH, leaving room for nested parses */
 
 #line 77 "smtlib-bison-parser.tab.c" /* yacc.c:339  */
 
@@ -1713,7 +1713,7 @@ yyreduce:
 #line 83 "smtlib-bison-parser.y" /* yacc.c:1646  */
     { 	
 			(yyval.list) = smt_listCreate(); 
-			smt_listAdd((yyval.list), (yyvsp[0].ptr)); 
+			smt_addCommand(parser, (yyval.list), (yyvsp[0].ptr)); 
 
 			(yyloc).first_line = (yylsp[0]).first_line;
             (yyloc).first_column = (yylsp[0]).first_column;
@@ -1726,7 +1726,7 @@ yyreduce:
   case 7:
 #line 94 "smtlib-bison-parser.y" /* yacc.c:1646  */
     { 
-			smt_listAdd((yyvsp[-1].list), (yyvsp[0].ptr)); 
+			smt_addCommand(parser, (yyvsp[-1].list), (yyvsp[0].ptr)); 
 			(yyval.list) = (yyvsp[-1].list); 
 
 			(yyloc).first_line = (yylsp[-1]).first_line;
@@ -715,9 +715,11 @@ UPDATE_COLUMN(yyleng);
 yylloc.first_column = yycolumn; \
 UPDATE_COLUMN(yyleng);
 
+/* Ends a string or quoted symbol: yymore() has made yytext the whole token, of which
+   all but the closing character were already counted */
 #define SET_RIGHT yylloc.last_line = yylineno; \
-yylloc.last_column = yycolumn + yyleng - 1; \
-UPDATE_COLUMN(yyleng);
+yylloc.last_column = yycolumn; \
+UPDATE_COLUMN(1);
 
 
 #line 724 "lex.yy.c"
@@ -1091,8 +1093,8 @@ YY_RULE_SETUP
 #line 78 "smtlib-flex-lexer.l"
 { 
 						SET_LOCATION;
-						yylval.ptr = smt_newNumeralLiteral(
-							strtol(yytext+2, NULL, 16), 16); 
+						yylval.ptr = smt_newSizedNumeralLiteral(
+							strtol(yytext+2, NULL, 16), 16, yyleng-2); 
 						return HEXADECIMAL; 
 					}
 	YY_BREAK
@@ -1101,8 +1103,8 @@ YY_RULE_SETUP
 #line 84 "smtlib-flex-lexer.l"
 {
 						SET_LOCATION;
-						yylval.ptr = smt_newNumeralLiteral(
-							strtol(yytext+2, NULL, 2), 2); 
+						yylval.ptr = smt_newSizedNumeralLiteral(
+							strtol(yytext+2, NULL, 2), 2, yyleng-2); 
 						return BINARY; 
 					}
 	YY_BREAK
@@ -1293,7 +1295,7 @@ YY_RULE_SETUP
 #line 139 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				yylval.ptr = smt_newSymbol(yytext); 
+				yylval.ptr = smt_newSimpleSymbol(yytext); 
 				return THEORY; 
 			}
 	YY_BREAK
@@ -1302,7 +1304,7 @@ YY_RULE_SETUP
 #line 144 "smtlib-flex-lexer.l"
 { 
 				SET_LOCATION;
-				yylval.ptr = smt_newSymbol(yytext); 
+				yylval.ptr = smt_newSimpleSymbol(yytext); 
 				return LOGIC; 
 			}
 	YY_BREAK
@@ -1311,7 +1313,7 @@ YY_RULE_SETUP
 #line 150 "smtlib-flex-lexer.l"
 { 
 							SET_LOCATION;
-							yylval.ptr = smt_newKeyword(yytext);
+							yylval.ptr = smt_newSimpleKeyword(yytext);
 							return KW_ATTR_SORTS; 
 						}
 	YY_BREAK
@@ -1320,7 +1322,7 @@ YY_RULE_SETUP
 #line 155 "smtlib-flex-lexer.l"
 { 
 							SET_LOCATION;
-							yylval.ptr = smt_newKeyword(yytext);
+							yylval.ptr = smt_newSimpleKeyword(yytext);
 							return KW_ATTR_FUNS; 
 						}
 	YY_BREAK
@@ -1329,7 +1331,7 @@ YY_RULE_SETUP
 #line 160 "smtlib-flex-lexer.l"
 {
 							SET_LOCATION;
-							yylval.ptr = smt_newKeyword(yytext); 
+							yylval.ptr = smt_newSimpleKeyword(yytext); 
 							return KW_ATTR_THEORIES; 
 						}
 	YY_BREAK
@@ -1338,7 +1340,7 @@ YY_RULE_SETUP
 #line 166 "smtlib-flex-lexer.l"
 {
 						SET_LOCATION;
-						yylval.ptr = smt_newSymbol(yytext); 
+						yylval.ptr = smt_newSimpleSymbol(yytext); 
 						return SYMBOL; 
 					}
 	YY_BREAK
@@ -1347,7 +1349,7 @@ YY_RULE_SETUP
 #line 171 "smtlib-flex-lexer.l"
 { 
 						SET_LOCATION;
-						yylval.ptr = smt_newKeyword(yytext); 
+						yylval.ptr = smt_newSimpleKeyword(yytext); 
 						return KEYWORD; 
 					}
 	YY_BREAK
@@ -2450,4 +2452,58 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 202 "smtlib-flex-lexer.l"
+#line 203 "smtlib-flex-lexer.l"
+
+/* Lexer and parser state of an input put aside while another input is read */
+struct smt_input_state {
+	int lineno;
+	int column;
+	int start;
+	int parser_char;
+	int parser_nerrs;
+	YYSTYPE parser_lval;
+	YYLTYPE parser_lloc;
+	struct smt_input_state* prev;
+};
+
+static struct smt_input_state* smt_saved_inputs = NULL;
+
+extern int yychar;
+extern int yynerrs;
+
+void smt_pushInput(FILE* file) {
+	struct smt_input_state* state = (struct smt_input_state*) malloc(sizeof(struct smt_input_state));
+	state->lineno = yylineno;
+	state->column = yycolumn;
+	state->start = yy_start;
+	state->parser_char = yychar;
+	state->parser_nerrs = yynerrs;
+	state->parser_lval = yylval;
+	state->parser_lloc = yylloc;
+	state->prev = smt_saved_inputs;
+	smt_saved_inputs = state;
+
+	yypush_buffer_state(yy_create_buffer(file, YY_BUF_SIZE));
+	yylineno = 1;
+	yycolumn = 1;
+	BEGIN 0;
+}
+
+void smt_popInput() {
+	struct smt_input_state* state = smt_saved_inputs;
+
+	yypop_buffer_state();
+	if (!state)
+		return;
+
+	yylineno = state->lineno;
+	yycolumn = state->column;
+	yy_start = state->start;
+	yychar = state->parser_char;
+	yynerrs = state->parser_nerrs;
+	yylval = state->parser_lval;
+	yylloc = state->parser_lloc;
+
+	smt_saved_inputs = state->prev;
+	free(state);
+}
@@ -420,6 +420,17 @@ sptr_t<Index> share(SmtPtr nakedPtr) {
     throw;
 }
 
+/**
+ * Share a node with the parent being built from it. The parent keeps the node
+ * alive from then on, so that it no longer needs an entry in the node map.
+ */
+template<class T>
+sptr_t<T> take(SmtPtr nakedPtr) {
+    sptr_t<T> ptr = share<T>(nakedPtr);
+    nodemap.erase(nakedPtr);
+    return ptr;
+}
+
 //namespace smtlib {
 //namespace ast {
 
@@ -431,7 +442,7 @@ public:
     sptr_v<T> unwrap() {
         sptr_v<T> result;
         for (unsigned long i = 0, n = v.size(); i < n; ++i) {
-            sptr_t<T> ptr = share<T>(v[i]);
+            sptr_t<T> ptr = take<T>(v[i]);
             result.push_back(ptr);
         }
         v.clear();
@@ -457,6 +468,14 @@ void smt_listDelete(SmtList list) {
     delete list;
 }
 
+void smt_addCommand(SmtPrsr parser, SmtList commands, SmtPtr command) {
+    if (parser->checkCommand(command)) {
+        commands->add(command);
+    } else {
+        nodemap.erase(command);
+    }
+}
+
 void smt_print(SmtPtr ptr) {
     cout << ptr->toString();
 }
@@ -494,14 +513,14 @@ int smt_bool_value(SmtPtr ptr) {
 
 // ast_attribute.h
 SmtPtr smt_newAttribute1(SmtPtr keyword) {
-    sptr_t<Attribute> ptr = make_shared<Attribute>(share<Keyword>(keyword));
+    sptr_t<Attribute> ptr = make_shared<Attribute>(take<Keyword>(keyword));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newAttribute2(SmtPtr keyword, SmtPtr attr_value) {
-    sptr_t<Attribute> ptr = make_shared<Attribute>(share<Keyword>(keyword),
-                                                       share<AttributeValue>(attr_value));
+    sptr_t<Attribute> ptr = make_shared<Attribute>(take<Keyword>(keyword),
+                                                       take<AttributeValue>(attr_value));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -526,6 +545,18 @@ SmtPtr smt_newKeyword(char const* value) {
     return ptr.get();
 }
 
+SmtPtr smt_newSimpleSymbol(char const* value) {
+    sptr_t<Symbol> ptr = make_shared<Symbol>(value, true);
+    nodemap[ptr.get()] = ptr;
+    return ptr.get();
+}
+
+SmtPtr smt_newSimpleKeyword(char const* value) {
+    sptr_t<Keyword> ptr = make_shared<Keyword>(value, true);
+    nodemap[ptr.get()] = ptr;
+    return ptr.get();
+}
+
 SmtPtr smt_newMetaSpecConstant(int value) {
     sptr_t<MetaSpecConstant> ptr = make_shared<MetaSpecConstant>(
             static_cast<MetaSpecConstant::Type>(value));
@@ -540,14 +571,14 @@ SmtPtr smt_newBooleanValue(int value) {
 }
 
 SmtPtr smt_newPropLiteral(SmtPtr symbol, int negated) {
-    sptr_t<PropLiteral> ptr = make_shared<PropLiteral>(share<Symbol>(symbol), (bool) negated);
+    sptr_t<PropLiteral> ptr = make_shared<PropLiteral>(take<Symbol>(symbol), (bool) negated);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 // ast_command.h
 SmtPtr smt_newAssertCommand(SmtPtr term) {
-    sptr_t<AssertCommand> ptr = make_shared<AssertCommand>(share<Term>(term));
+    sptr_t<AssertCommand> ptr = make_shared<AssertCommand>(take<Term>(term));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -567,15 +598,15 @@ SmtPtr smt_newCheckSatAssumCommand(SmtList assumptions) {
 
 SmtPtr smt_newDeclareConstCommand(SmtPtr symbol, SmtPtr sort) {
     sptr_t<DeclareConstCommand> ptr =
-            make_shared<DeclareConstCommand>(share<Symbol>(symbol), share<Sort>(sort));
+            make_shared<DeclareConstCommand>(take<Symbol>(symbol), take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newDeclareDatatypeCommand(SmtPtr symbol, SmtPtr declaration) {
     sptr_t<DeclareDatatypeCommand> ptr =
-            make_shared<DeclareDatatypeCommand>(share<Symbol>(symbol),
-                                                share<DatatypeDeclaration>(declaration));
+            make_shared<DeclareDatatypeCommand>(take<Symbol>(symbol),
+                                                take<DatatypeDeclaration>(declaration));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -591,28 +622,28 @@ SmtPtr smt_newDeclareDatatypesCommand(SmtList sorts, SmtList declarations) {
 SmtPtr smt_newDeclareFunCommand(SmtPtr symbol, SmtList params, SmtPtr sort) {
     sptr_v<Sort> v = params->unwrap<Sort>();
     sptr_t<DeclareFunCommand> ptr =
-            make_shared<DeclareFunCommand>(share<Symbol>(symbol), v, share<Sort>(sort));
+            make_shared<DeclareFunCommand>(take<Symbol>(symbol), v, take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newDeclareSortCommand(SmtPtr symbol, SmtPtr arity) {
     sptr_t<DeclareSortCommand> ptr =
-            make_shared<DeclareSortCommand>(share<Symbol>(symbol), share<NumeralLiteral>(arity));
+            make_shared<DeclareSortCommand>(take<Symbol>(symbol), take<NumeralLiteral>(arity));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newDefineFunCommand(SmtPtr definition) {
     sptr_t<DefineFunCommand> ptr =
-            make_shared<DefineFunCommand>(share<FunctionDefinition>(definition));
+            make_shared<DefineFunCommand>(take<FunctionDefinition>(definition));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newDefineFunRecCommand(SmtPtr definition) {
     sptr_t<DefineFunRecCommand> ptr = make_shared<DefineFunRecCommand>(
-            share<FunctionDefinition>(definition));
+            take<FunctionDefinition>(definition));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -628,13 +659,13 @@ SmtPtr smt_newDefineFunsRecCommand(SmtList declarations, SmtList bodies) {
 SmtPtr smt_newDefineSortCommand(SmtPtr symbol, SmtList params, SmtPtr sort) {
     sptr_v<Symbol> v1 = params->unwrap<Symbol>();
     sptr_t<DefineSortCommand> ptr =
-            make_shared<DefineSortCommand>(share<Symbol>(symbol), v1, share<Sort>(sort));
+            make_shared<DefineSortCommand>(take<Symbol>(symbol), v1, take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newEchoCommand(SmtPtr msg) {
-    sptr_t<EchoCommand> ptr = make_shared<EchoCommand>(share<StringLiteral>(msg)->getValue());
+    sptr_t<EchoCommand> ptr = make_shared<EchoCommand>(take<StringLiteral>(msg)->getValue());
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -658,7 +689,7 @@ SmtPtr smt_newGetAssignsCommand() {
 }
 
 SmtPtr smt_newGetInfoCommand(SmtPtr keyword) {
-    sptr_t<GetInfoCommand> ptr = make_shared<GetInfoCommand>(share<Keyword>(keyword));
+    sptr_t<GetInfoCommand> ptr = make_shared<GetInfoCommand>(take<Keyword>(keyword));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -670,7 +701,7 @@ SmtPtr smt_newGetModelCommand() {
 }
 
 SmtPtr smt_newGetOptionCommand(SmtPtr keyword) {
-    sptr_t<GetOptionCommand> ptr = make_shared<GetOptionCommand>(share<Keyword>(keyword));
+    sptr_t<GetOptionCommand> ptr = make_shared<GetOptionCommand>(take<Keyword>(keyword));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -701,13 +732,13 @@ SmtPtr smt_newGetValueCommand(SmtList terms) {
 }
 
 SmtPtr smt_newPopCommand(SmtPtr numeral) {
-    sptr_t<PopCommand> ptr = make_shared<PopCommand>(share<NumeralLiteral>(numeral));
+    sptr_t<PopCommand> ptr = make_shared<PopCommand>(take<NumeralLiteral>(numeral));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newPushCommand(SmtPtr numeral) {
-    sptr_t<PushCommand> ptr = make_shared<PushCommand>(share<NumeralLiteral>(numeral));
+    sptr_t<PushCommand> ptr = make_shared<PushCommand>(take<NumeralLiteral>(numeral));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -725,19 +756,19 @@ SmtPtr smt_newResetAssertsCommand() {
 }
 
 SmtPtr smt_newSetInfoCommand(SmtPtr info) {
-    sptr_t<SetInfoCommand> ptr = make_shared<SetInfoCommand>(share<Attribute>(info));
+    sptr_t<SetInfoCommand> ptr = make_shared<SetInfoCommand>(take<Attribute>(info));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newSetLogicCommand(SmtPtr logic) {
-    sptr_t<SetLogicCommand> ptr = make_shared<SetLogicCommand>(share<Symbol>(logic));
+    sptr_t<SetLogicCommand> ptr = make_shared<SetLogicCommand>(take<Symbol>(logic));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newSetOptionCommand(SmtPtr option) {
-    sptr_t<SetOptionCommand> ptr = make_shared<SetOptionCommand>(share<Attribute>(option));
+    sptr_t<SetOptionCommand> ptr = make_shared<SetOptionCommand>(take<Attribute>(option));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -745,21 +776,21 @@ SmtPtr smt_newSetOptionCommand(SmtPtr option) {
 //smt_datatype.h
 SmtPtr smt_newSortDeclaration(SmtPtr symbol, SmtPtr numeral) {
     sptr_t<SortDeclaration> ptr =
-            make_shared<SortDeclaration>(share<Symbol>(symbol), share<NumeralLiteral>(numeral));
+            make_shared<SortDeclaration>(take<Symbol>(symbol), take<NumeralLiteral>(numeral));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newSelectorDeclaration(SmtPtr symbol, SmtPtr sort) {
     sptr_t<SelectorDeclaration> ptr =
-            make_shared<SelectorDeclaration>(share<Symbol>(symbol), share<Sort>(sort));
+            make_shared<SelectorDeclaration>(take<Symbol>(symbol), take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newConstructorDeclaration(SmtPtr symbol, SmtList selectors) {
     sptr_v<SelectorDeclaration> v = selectors->unwrap<SelectorDeclaration>();
-    sptr_t<ConstructorDeclaration> ptr = make_shared<ConstructorDeclaration>(share<Symbol>(symbol), v);
+    sptr_t<ConstructorDeclaration> ptr = make_shared<ConstructorDeclaration>(take<Symbol>(symbol), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -783,21 +814,21 @@ SmtPtr smt_newParametricDatatypeDeclaration(SmtList params, SmtList constructors
 SmtPtr smt_newFunctionDeclaration(SmtPtr symbol, SmtList params, SmtPtr sort) {
     sptr_v<SortedVariable> v = params->unwrap<SortedVariable>();
     sptr_t<FunctionDeclaration> ptr =
-            make_shared<FunctionDeclaration>(share<Symbol>(symbol), v, share<Sort>(sort));
+            make_shared<FunctionDeclaration>(take<Symbol>(symbol), v, take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newFunctionDefinition(SmtPtr signature, SmtPtr body) {
     sptr_t<FunctionDefinition> ptr = make_shared<FunctionDefinition>(
-            share<FunctionDeclaration>(signature), share<Term>(body));
+            take<FunctionDeclaration>(signature), take<Term>(body));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 // ast_identifier.h
 SmtPtr smt_newSimpleIdentifier1(SmtPtr symbol) {
-    sptr_t<SimpleIdentifier> ptr = make_shared<SimpleIdentifier>(share<Symbol>(symbol));
+    sptr_t<SimpleIdentifier> ptr = make_shared<SimpleIdentifier>(take<Symbol>(symbol));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -805,14 +836,14 @@ SmtPtr smt_newSimpleIdentifier1(SmtPtr symbol) {
 SmtPtr smt_newSimpleIdentifier2(SmtPtr symbol, SmtList indices) {
     sptr_v<Index> v = indices->unwrap<Index>();
     sptr_t<SimpleIdentifier> ptr =
-            make_shared<SimpleIdentifier>(share<Symbol>(symbol), v);
+            make_shared<SimpleIdentifier>(take<Symbol>(symbol), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newQualifiedIdentifier(SmtPtr identifier, SmtPtr sort) {
     sptr_t<QualifiedIdentifier> ptr =
-            make_shared<QualifiedIdentifier>(share<SimpleIdentifier>(identifier), share<Sort>(sort));
+            make_shared<QualifiedIdentifier>(take<SimpleIdentifier>(identifier), take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -824,6 +855,12 @@ SmtPtr smt_newNumeralLiteral(long value, unsigned int base) {
     return ptr.get();
 }
 
+SmtPtr smt_newSizedNumeralLiteral(long value, unsigned int base, unsigned long digits) {
+    sptr_t<NumeralLiteral> ptr = make_shared<NumeralLiteral>(value, base, digits);
+    nodemap[ptr.get()] = ptr;
+    return ptr.get();
+}
+
 SmtPtr smt_newDecimalLiteral(double value) {
     sptr_t<DecimalLiteral> ptr = make_shared<DecimalLiteral>(value);
     nodemap[ptr.get()] = ptr;
@@ -839,7 +876,7 @@ SmtPtr smt_newStringLiteral(char const* value) {
 // ast_logic.h
 SmtPtr smt_newLogic(SmtPtr name, SmtList attributes) {
     sptr_v<Attribute> v = attributes->unwrap<Attribute>();
-    sptr_t<Logic> ptr = make_shared<Logic>(share<Symbol>(name), v);
+    sptr_t<Logic> ptr = make_shared<Logic>(take<Symbol>(name), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -847,21 +884,21 @@ SmtPtr smt_newLogic(SmtPtr name, SmtList attributes) {
 // ast_match.h
 SmtPtr smt_newQualifiedConstructor(SmtPtr symbol, SmtPtr sort) {
     sptr_t<QualifiedConstructor> ptr =
-            make_shared<QualifiedConstructor>(share<Symbol>(symbol), share<Sort>(sort));
+            make_shared<QualifiedConstructor>(take<Symbol>(symbol), take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newQualifiedPattern(SmtPtr constructor, SmtList symbols) {
     sptr_v<Symbol> v = symbols->unwrap<Symbol>();
-    sptr_t<QualifiedPattern> ptr = make_shared<QualifiedPattern>(share<Constructor>(constructor), v);
+    sptr_t<QualifiedPattern> ptr = make_shared<QualifiedPattern>(take<Constructor>(constructor), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newMatchCase(SmtPtr pattern, SmtPtr term) {
     sptr_t<MatchCase> ptr =
-            make_shared<MatchCase>(share<Pattern>(pattern), share<Term>(term));
+            make_shared<MatchCase>(take<Pattern>(pattern), take<Term>(term));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -884,14 +921,14 @@ SmtPtr smt_newSmtScript(SmtList cmds) {
 
 // ast_sort.h
 SmtPtr smt_newSort1(SmtPtr identifier) {
-    sptr_t<Sort> ptr = make_shared<Sort>(share<SimpleIdentifier>(identifier));
+    sptr_t<Sort> ptr = make_shared<Sort>(take<SimpleIdentifier>(identifier));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newSort2(SmtPtr identifier, SmtList params) {
     sptr_v<Sort> v = params->unwrap<Sort>();
-    sptr_t<Sort> ptr = make_shared<Sort>(share<SimpleIdentifier>(identifier), v);
+    sptr_t<Sort> ptr = make_shared<Sort>(take<SimpleIdentifier>(identifier), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -900,8 +937,8 @@ SmtPtr smt_newSort2(SmtPtr identifier, SmtList params) {
 SmtPtr smt_newSortSymbolDeclaration(SmtPtr identifier, SmtPtr arity, SmtList attributes) {
     sptr_v<Attribute> v = attributes->unwrap<Attribute>();
     sptr_t<SortSymbolDeclaration> ptr =
-            make_shared<SortSymbolDeclaration>(share<SimpleIdentifier>(identifier),
-                                               share<NumeralLiteral>(arity), v);
+            make_shared<SortSymbolDeclaration>(take<SimpleIdentifier>(identifier),
+                                               take<NumeralLiteral>(arity), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -909,7 +946,7 @@ SmtPtr smt_newSortSymbolDeclaration(SmtPtr identifier, SmtPtr arity, SmtList att
 SmtPtr smt_newSpecConstFunDeclaration(SmtPtr constant, SmtPtr sort, SmtList attributes) {
     sptr_v<Attribute> v = attributes->unwrap<Attribute>();
     sptr_t<SpecConstFunDeclaration> ptr =
-            make_shared<SpecConstFunDeclaration>(share<SpecConstant>(constant), share<Sort>(sort), v);
+            make_shared<SpecConstFunDeclaration>(take<SpecConstant>(constant), take<Sort>(sort), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -917,7 +954,7 @@ SmtPtr smt_newSpecConstFunDeclaration(SmtPtr constant, SmtPtr sort, SmtList attr
 SmtPtr smt_newMetaSpecConstFunDeclaration(SmtPtr constant, SmtPtr sort, SmtList attributes) {
     sptr_v<Attribute> v = attributes->unwrap<Attribute>();
     sptr_t<MetaSpecConstFunDeclaration> ptr =
-            make_shared<MetaSpecConstFunDeclaration>(share<MetaSpecConstant>(constant), share<Sort>(sort), v);
+            make_shared<MetaSpecConstFunDeclaration>(take<MetaSpecConstant>(constant), take<Sort>(sort), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -926,7 +963,7 @@ SmtPtr smt_newSimpleFunDeclaration(SmtPtr identifier, SmtList signature, SmtList
     sptr_v<Sort> v1 = signature->unwrap<Sort>();
     sptr_v<Attribute> v2 = attributes->unwrap<Attribute>();
     sptr_t<SimpleFunDeclaration> ptr =
-            make_shared<SimpleFunDeclaration>(share<SimpleIdentifier>(identifier), v1, v2);
+            make_shared<SimpleFunDeclaration>(take<SimpleIdentifier>(identifier), v1, v2);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -936,7 +973,7 @@ SmtPtr smt_newParametricFunDeclaration(SmtList params, SmtPtr identifier, SmtLis
     sptr_v<Sort> v2 = signature->unwrap<Sort>();
     sptr_v<Attribute> v3 = attributes->unwrap<Attribute>();
     sptr_t<ParametricFunDeclaration> ptr =
-            make_shared<ParametricFunDeclaration>(v1, share<SimpleIdentifier>(identifier), v2, v3);
+            make_shared<ParametricFunDeclaration>(v1, take<SimpleIdentifier>(identifier), v2, v3);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -944,42 +981,42 @@ SmtPtr smt_newParametricFunDeclaration(SmtList params, SmtPtr identifier, SmtLis
 // ast_term.h
 SmtPtr smt_newQualifiedTerm(SmtPtr identifier, SmtList terms) {
     sptr_v<Term> v = terms->unwrap<Term>();
-    sptr_t<QualifiedTerm> ptr = make_shared<QualifiedTerm>(share<Identifier>(identifier), v);
+    sptr_t<QualifiedTerm> ptr = make_shared<QualifiedTerm>(take<Identifier>(identifier), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newLetTerm(SmtList bindings, SmtPtr term) {
     sptr_v<VarBinding> v = bindings->unwrap<VarBinding>();
-    sptr_t<LetTerm> ptr = make_shared<LetTerm>(v, share<Term>(term));
+    sptr_t<LetTerm> ptr = make_shared<LetTerm>(v, take<Term>(term));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newForallTerm(SmtList bindings, SmtPtr term) {
     sptr_v<SortedVariable> v = bindings->unwrap<SortedVariable>();
-    sptr_t<ForallTerm> ptr = make_shared<ForallTerm>(v, share<Term>(term));
+    sptr_t<ForallTerm> ptr = make_shared<ForallTerm>(v, take<Term>(term));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newExistsTerm(SmtList bindings, SmtPtr term) {
     sptr_v<SortedVariable> v = bindings->unwrap<SortedVariable>();
-    sptr_t<ExistsTerm> ptr = make_shared<ExistsTerm>(v, share<Term>(term));
+    sptr_t<ExistsTerm> ptr = make_shared<ExistsTerm>(v, take<Term>(term));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newMatchTerm(SmtPtr term, SmtList cases) {
     sptr_v<MatchCase> v = cases->unwrap<MatchCase>();
-    sptr_t<MatchTerm> ptr = make_shared<MatchTerm>(share<Term>(term), v);
+    sptr_t<MatchTerm> ptr = make_shared<MatchTerm>(take<Term>(term), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newAnnotatedTerm(SmtPtr term, SmtList attrs) {
     sptr_v<Attribute> v = attrs->unwrap<Attribute>();
-    sptr_t<AnnotatedTerm> ptr = make_shared<AnnotatedTerm>(share<Term>(term), v);
+    sptr_t<AnnotatedTerm> ptr = make_shared<AnnotatedTerm>(take<Term>(term), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -988,7 +1025,7 @@ SmtPtr smt_newAnnotatedTerm(SmtPtr term, SmtList attrs) {
 SmtPtr smt_newTheory(SmtPtr name, SmtList attributes) {
     sptr_v<Attribute> v = attributes->unwrap<Attribute>();
     sptr_t<Theory> ptr =
-            make_shared<Theory>(share<Symbol>(name), v);
+            make_shared<Theory>(take<Symbol>(name), v);
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
@@ -996,14 +1033,14 @@ SmtPtr smt_newTheory(SmtPtr name, SmtList attributes) {
 // ast_var.h
 SmtPtr smt_newSortedVariable(SmtPtr symbol, SmtPtr sort) {
     sptr_t<SortedVariable> ptr =
-            make_shared<SortedVariable>(share<Symbol>(symbol), share<Sort>(sort));
+            make_shared<SortedVariable>(take<Symbol>(symbol), take<Sort>(sort));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
 
 SmtPtr smt_newVarBinding(SmtPtr symbol, SmtPtr term) {
     sptr_t<VarBinding> ptr =
-            make_shared<VarBinding>(share<Symbol>(symbol), share<Term>(term));
+            make_shared<VarBinding>(take<Symbol>(symbol), take<Term>(term));
     nodemap[ptr.get()] = ptr;
     return ptr.get();
 }
\ No newline at end of file
@@ -7,6 +7,8 @@
 #ifndef SMTLIB_PARSER_GLUE_H
 #define SMTLIB_PARSER_GLUE_H
 
+#include <stdio.h>
+
 #ifdef __cplusplus
 #include "ast/ast_abstract.h"
 namespace smtlib {
@@ -31,6 +33,10 @@ extern "C" {
 int yylex (void);
 int yyparse(SmtPrsr);
 
+/** Start reading another file, putting aside the state of the lexer and parser until smt_popInput() */
+void smt_pushInput(FILE* file);
+void smt_popInput();
+
 void smt_print(SmtPtr ptr);
 
 void smt_setAst(SmtPrsr parser, SmtPtr ast);
@@ -41,6 +47,9 @@ SmtList smt_listCreate();
 void smt_listAdd(SmtList list, SmtPtr item);
 void smt_listDelete(SmtList list);
 
+/** Add a command that has just been parsed to a script, unless the parser is set to release it */
+void smt_addCommand(SmtPrsr parser, SmtList commands, SmtPtr command);
+
 void smt_setLocation(SmtPrsr parser, SmtPtr ptr, int rowLeft, int colLeft, int rowRight, int colRight);
 
 int smt_bool_value(SmtPtr ptr);
@@ -53,6 +62,8 @@ SmtPtr smt_newCompAttributeValue(SmtList values);
 // ast_basic.h
 SmtPtr smt_newSymbol(char const* value);
 SmtPtr smt_newKeyword(char const* value);
+SmtPtr smt_newSimpleSymbol(char const* value);
+SmtPtr smt_newSimpleKeyword(char const* value);
 SmtPtr smt_newMetaSpecConstant(int value);
 SmtPtr smt_newBooleanValue(int value);
 SmtPtr smt_newPropLiteral(SmtPtr symbol, int negated);
@@ -107,6 +118,7 @@ SmtPtr smt_newQualifiedIdentifier(SmtPtr identifier, SmtPtr sort);
 
 // ast_literal.h
 SmtPtr smt_newNumeralLiteral(long value, unsigned int base);
+SmtPtr smt_newSizedNumeralLiteral(long value, unsigned int base, unsigned long digits);
 SmtPtr smt_newDecimalLiteral(double value);
 SmtPtr smt_newStringLiteral(char const* value);
 
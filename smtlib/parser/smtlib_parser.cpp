@@ -5,22 +5,56 @@
 #include "ast/visitor/ast_sortedness_checker.h"
 #include "util/logger.h"
 
+#include <exception>
 #include <iostream>
-
-extern "C" {
-    extern FILE* yyin;
-}
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
 
 using namespace std;
 using namespace smtlib;
 using namespace smtlib::ast;
 
+/** Nodes built by the parse in progress, which have not been added to a parent yet */
+extern unordered_map<AstNode*, sptr_t<AstNode>> nodemap;
+
+/** Return a pointer to a process-wide copy of the file name, valid for the whole execution */
+static const string* internFilename(const string& filename) {
+    static unordered_set<string> filenames;
+    return &(*filenames.insert(filename).first);
+}
+
 sptr_t<AstNode> Parser::parse(std::string filename) {
-    yyin = fopen(filename.c_str(), "r");
-    if(yyin) {
-        this->filename = make_shared<string>(filename.c_str());
-        yyparse(this);
-        fclose(yyin);
+    FILE* file = fopen(filename.c_str(), "r");
+    if(file) {
+        this->filename = internFilename(filename);
+
+        // Put aside the state of an outer parse, if any, until this one is done
+        unordered_map<AstNode*, sptr_t<AstNode>> outerNodes;
+        outerNodes.swap(nodemap);
+        smt_pushInput(file);
+
+        // A parsing error in a nested parse ends this one as well, once its state is restored
+        exception_ptr nestedError;
+        try {
+            yyparse(this);
+        } catch (...) {
+            nestedError = current_exception();
+        }
+
+        smt_popInput();
+        nodemap.swap(outerNodes);
+        fclose(file);
+
+        if (nestedError || failed) {
+            // Nothing may be checked or written on the pipeline thread once the error is out
+            if (commandPipeline)
+                commandPipeline->cancel();
+
+            if (nestedError)
+                rethrow_exception(nestedError);
+            failParse();
+        }
     } else {
         stringstream ss;
         ss << "Unable to open file '" << filename << "'";
@@ -29,7 +63,7 @@ sptr_t<AstNode> Parser::parse(std::string filename) {
     return ast;
 }
 
-sptr_t<std::string> Parser::getFilename() {
+const std::string* Parser::getFilename() {
     return filename;
 }
 
@@ -43,7 +77,48 @@ sptr_t<ast::AstNode> Parser::getAst() {
     return ast;
 }
 
+void Parser::setCommandVisitor(sptr_t<FusedVisitor> visitor, bool release) {
+    commandVisitor = visitor;
+    releaseCommands = release;
+}
+
+void Parser::setCommandPipeline(sptr_t<CommandPipeline> pipeline) {
+    commandPipeline = pipeline;
+}
+
+bool Parser::checkCommand(AstNode* command) {
+    if (commandPipeline)
+        return commandPipeline->submit(dynamic_pointer_cast<Command>(nodemap[command]));
+
+    if (!commandVisitor)
+        return true;
+
+    bool clean = commandVisitor->visitPart(command);
+    return !(clean && releaseCommands);
+}
+
 void Parser::reportError(unsigned int lineLeft, unsigned int colLeft,
                  unsigned int lineRight, unsigned int colRight, const char* msg) {
-    Logger::parsingError(lineLeft, colLeft, lineRight, colRight, filename->c_str(), msg);
+    if (failed)
+        return;
+
+    failed = true;
+    errorLineLeft = lineLeft;
+    errorColLeft = colLeft;
+    errorLineRight = lineRight;
+    errorColRight = colRight;
+    errorMessage = msg;
+}
+
+void Parser::failParse() {
+    // Parsing errors stop the execution, so the diagnostics are written out first
+    if (diagnostics) {
+        diagnostics->write(ERROR_PARSE, filename, errorLineLeft, errorColLeft,
+                           errorLineRight, errorColRight, errorMessage.c_str());
+        diagnostics->flush();
+    }
+
+    Logger::parsingError(errorLineLeft, errorColLeft, errorLineRight, errorColRight,
+                         filename->c_str(), errorMessage.c_str());
+    throw ParseError(errorMessage);
 }
\ No newline at end of file
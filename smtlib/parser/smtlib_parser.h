@@ -8,24 +8,86 @@
 #define SMTLIB_PARSER_H
 
 #include "ast/ast_abstract.h"
+#include "ast/visitor/ast_visitor_fused.h"
+#include "smtlib_pipeline.h"
+#include "util/diagnostic_writer.h"
 
 #include <memory>
+#include <stdexcept>
 #include <string>
 
 namespace smtlib {
+    /**
+     * Thrown by Parser::parse() once a parsing error has been written out. It goes
+     * through any parse the failed one is nested in, stopping the whole execution.
+     */
+    class ParseError : public std::runtime_error {
+    public:
+        explicit ParseError(const std::string& msg) : std::runtime_error(msg) { }
+    };
+
     class Parser {
     private:
         sptr_t<ast::AstNode> ast;
-        sptr_t<std::string> filename;
+        const std::string* filename;
+
+        sptr_t<ast::FusedVisitor> commandVisitor;
+        sptr_t<CommandPipeline> commandPipeline;
+        bool releaseCommands;
+
+        /** Where parsing errors are written, before the execution stops (none if empty) */
+        sptr_t<DiagnosticWriter> diagnostics;
+
+        /** Parsing error reported by the generated parser, written out once it has stopped */
+        bool failed;
+        unsigned int errorLineLeft, errorColLeft, errorLineRight, errorColRight;
+        std::string errorMessage;
+
+        /** Write out the parsing error and throw a ParseError */
+        void failParse();
     public:
+        Parser() : filename(NULL), releaseCommands(false), failed(false) { }
+
+        /**
+         * Parse a file. Parsing may be nested, in the actions of another parse
+         * (for instance, to load a theory while a command is being checked).
+         * \throws ParseError    If the file, or a file parsed in a nested parse, has a parsing error.
+         *                       The pipeline, if any, is stopped before the error is written out.
+         */
         sptr_t<ast::AstNode> parse(std::string filename);
 
-        sptr_t<std::string> getFilename();
+        /**
+         * Have each command of a script visited as soon as it has been parsed,
+         * instead of only once the whole script has been parsed
+         * \param visitor     Visitors to run on each command
+         * \param release     Whether commands in which no errors were found are released
+         *                    once visited, instead of being added to the script
+         */
+        void setCommandVisitor(sptr_t<ast::FusedVisitor> visitor, bool release);
+
+        /**
+         * Have each command of a script handed over to a pipeline as soon as it has been
+         * parsed, to be visited on another thread while parsing goes on
+         */
+        void setCommandPipeline(sptr_t<CommandPipeline> pipeline);
+
+        /** Set where parsing errors are written, before the execution stops */
+        inline void setDiagnostics(sptr_t<DiagnosticWriter> writer) { diagnostics = writer; }
+
+        /**
+         * Visit a command that has just been parsed, or hand it over to a pipeline, if set to do so
+         * \return Whether the command should be added to the script
+         */
+        bool checkCommand(ast::AstNode* command);
+
+        /** Name of the file being parsed, interned so that all nodes can point to the same string */
+        const std::string* getFilename();
 
         void setAst(sptr_t<ast::AstNode> ast);
 
         sptr_t<ast::AstNode> getAst();
 
+        /** Record a parsing error, after which the generated parser stops */
         void reportError(unsigned int lineLeft, unsigned int colLeft,
                          unsigned int lineRight, unsigned int colRight, const char* msg);
     };
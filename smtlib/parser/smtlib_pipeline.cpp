@@ -0,0 +1,81 @@
+#include "smtlib_pipeline.h"
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+// Number of parsed commands that may wait to be visited before the parser is held back
+static const size_t QUEUE_CAPACITY = 1024;
+
+CommandPipeline::CommandPipeline(sptr_t<FusedVisitor> visitor, bool release)
+        : visitor(visitor), releaseCommands(release), queue(QUEUE_CAPACITY), cancelled(false) {
+    checker = thread(&CommandPipeline::check, this);
+}
+
+CommandPipeline::~CommandPipeline() {
+    if (checker.joinable()) {
+        queue.push(sptr_t<Command>());
+        queue.waitEmpty();
+        checker.join();
+    }
+}
+
+bool CommandPipeline::submit(sptr_t<Command> command) {
+    if (command->getKind() == NODE_SET_LOGIC_COMMAND) {
+        // The checking thread is idle until the next push, so the visitors can be used from here
+        queue.waitEmpty();
+        visit(command);
+    } else {
+        queue.push(command);
+    }
+
+    return !releaseCommands;
+}
+
+sptr_v<Command> CommandPipeline::finish() {
+    queue.push(sptr_t<Command>());
+    queue.waitEmpty();
+    checker.join();
+
+    if (error)
+        rethrow_exception(error);
+
+    return kept;
+}
+
+void CommandPipeline::cancel() {
+    if (!checker.joinable())
+        return;
+
+    cancelled = true;
+    queue.push(sptr_t<Command>());
+    queue.waitEmpty();
+    checker.join();
+}
+
+void CommandPipeline::check() {
+    while (true) {
+        sptr_t<Command>& command = queue.front();
+        if (!command) {
+            queue.pop();
+            return;
+        }
+
+        // Once a visit has failed, or the parse has, the remaining commands are only taken off the queue
+        if (!error && !cancelled) {
+            try {
+                visit(command);
+            } catch (...) {
+                error = current_exception();
+            }
+        }
+
+        queue.pop();
+    }
+}
+
+void CommandPipeline::visit(sptr_t<Command> command) {
+    bool clean = visitor->visitPart(command.get());
+    if (!clean && releaseCommands)
+        kept.push_back(command);
+}
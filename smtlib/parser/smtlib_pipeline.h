@@ -0,0 +1,91 @@
+/**
+ * \file smtlib_pipeline.h
+ * \brief Checking the commands of a script on another thread, while it is still being parsed.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_PIPELINE_H
+#define SMTLIB_PARSER_PIPELINE_H
+
+#include "ast/ast_command.h"
+#include "ast/visitor/ast_visitor_fused.h"
+#include "util/global_typedef.h"
+#include "util/spsc_queue.h"
+
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+
+namespace smtlib {
+    /**
+     * Hands the commands of a script, as they are parsed, over to a thread that
+     * runs visitors on them, in the order in which they were parsed. At most a
+     * fixed number of commands wait to be visited: once there are that many, the
+     * parser waits for the visitors to catch up.
+     *
+     * The parser can only run on one thread. Commands whose visit may parse other
+     * files (set-logic loads a logic and its theories) are therefore visited on the
+     * parsing thread, once all commands before them have been visited.
+     */
+    class CommandPipeline {
+    private:
+        sptr_t<ast::FusedVisitor> visitor;
+        bool releaseCommands;
+
+        /** Commands waiting to be visited, followed by an empty pointer once the parse is done */
+        SpscQueue<sptr_t<ast::Command>> queue;
+        std::thread checker;
+
+        /** Released commands in which errors were found, in the order in which they were parsed */
+        sptr_v<ast::Command> kept;
+
+        /** First exception thrown while visiting a command on the checking thread */
+        std::exception_ptr error;
+
+        /** Whether the commands still waiting are to be dropped instead of visited */
+        std::atomic<bool> cancelled;
+
+        /** Visit commands taken from the queue, until the end of the parse */
+        void check();
+
+        /** Visit a command, keeping it aside if released and not clean */
+        void visit(sptr_t<ast::Command> command);
+
+    public:
+        /**
+         * Start the thread visiting commands
+         * \param visitor     Visitors to run on each command, with their enter() hooks already called
+         * \param release     Whether commands are released once visited, instead of being added
+         *                    to the script. Those in which errors were found are returned by finish().
+         */
+        CommandPipeline(sptr_t<ast::FusedVisitor> visitor, bool release);
+
+        /** Wait for the thread visiting commands, if finish() has not been called */
+        ~CommandPipeline();
+
+        CommandPipeline(const CommandPipeline&) = delete;
+        CommandPipeline& operator=(const CommandPipeline&) = delete;
+
+        /**
+         * Hand over a command that has just been parsed
+         * \return Whether the command should be added to the script
+         */
+        bool submit(sptr_t<ast::Command> command);
+
+        /**
+         * Wait until all commands have been visited, rethrowing the first exception
+         * thrown while visiting them
+         * \return Released commands in which errors were found
+         */
+        sptr_v<ast::Command> finish();
+
+        /**
+         * Drop the commands still waiting and wait for the thread visiting commands,
+         * once the parse has failed. The command being visited, if any, is finished first.
+         */
+        void cancel();
+    };
+}
+
+#endif //SMTLIB_PARSER_PIPELINE_H
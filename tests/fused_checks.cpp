@@ -0,0 +1,104 @@
+/**
+ * \file fused_checks.cpp
+ * \brief Checks that the single pass over a script reports what two passes did.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * Usage: fused_checks file...
+ * Each file is checked twice: once with the syntax checked on its own before the
+ * sortedness, as it was before both checks were fused, and once with both checks
+ * in the same pass, as smtlib-parser does. The outcome, everything printed to the
+ * standard error and the diagnostic records must be the same.
+ */
+
+#include "exec/execution.h"
+#include "util/diagnostic_writer.h"
+
+#include <cstdio>
+#include <string>
+#include <unistd.h>
+
+using namespace std;
+using namespace smtlib;
+
+/** What checking a file gave */
+struct Outcome {
+    bool success;
+    string output;
+    string diagnostics;
+};
+
+static string readAll(FILE* file) {
+    string text;
+    char buffer[4096];
+    size_t read;
+
+    rewind(file);
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0) {
+        text.append(buffer, read);
+    }
+    fclose(file);
+    return text;
+}
+
+static Outcome check(const string& path, bool twoPasses) {
+    Outcome outcome;
+    FILE* output = tmpfile();
+    FILE* diagnostics = tmpfile();
+
+    fflush(stderr);
+    int savedStderr = dup(STDERR_FILENO);
+    dup2(fileno(output), STDERR_FILENO);
+
+    {
+        sptr_t<SmtExecutionSettings> settings = make_shared<SmtExecutionSettings>();
+        settings->setInputFromFile(path);
+        settings->setDiagnostics(make_shared<DiagnosticWriter>(diagnostics));
+
+        // Parsing errors are thrown, once written out, whichever way the file is checked
+        try {
+            SmtExecution exec(settings);
+            if (twoPasses)
+                exec.checkSyntax();
+            outcome.success = exec.checkSortedness();
+        } catch (const ParseError&) {
+            outcome.success = false;
+        }
+    }
+
+    fflush(stderr);
+    dup2(savedStderr, STDERR_FILENO);
+    close(savedStderr);
+
+    outcome.output = readAll(output);
+    outcome.diagnostics = readAll(diagnostics);
+    return outcome;
+}
+
+int main(int argc, char** argv) {
+    int failures = 0;
+
+    for (int i = 1; i < argc; i++) {
+        Outcome separate = check(argv[i], true);
+        Outcome fused = check(argv[i], false);
+
+        if (fused.success != separate.success) {
+            fprintf(stderr, "%s: check %s in one pass, %s in two\n", argv[i],
+                    fused.success ? "succeeds" : "fails", separate.success ? "succeeds" : "fails");
+            failures++;
+        }
+
+        if (fused.output != separate.output) {
+            fprintf(stderr, "%s: different output\n--- one pass:\n%s--- two passes:\n%s", argv[i],
+                    fused.output.c_str(), separate.output.c_str());
+            failures++;
+        }
+
+        if (fused.diagnostics != separate.diagnostics) {
+            fprintf(stderr, "%s: different diagnostics\n--- one pass:\n%s--- two passes:\n%s", argv[i],
+                    fused.diagnostics.c_str(), separate.diagnostics.c_str());
+            failures++;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,105 @@
+/**
+ * \file parse_errors.cpp
+ * \brief Checks that parsing errors stop the execution without leaving work behind.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * A logic lists the theory Ints, then a theory whose file has a parsing error. Ints
+ * is parsed and left to have its syntax checked in the background while the broken
+ * theory is parsed, in a parse nested in the one of the script. The parsing error
+ * must come out of the outer parse as a ParseError, once the background check is
+ * done, and later parses must work as if nothing had happened.
+ */
+
+#include "exec/execution.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+static int failures = 0;
+
+static void expect(bool condition, const string& what) {
+    if (!condition) {
+        fprintf(stderr, "Failed: %s\n", what.c_str());
+        failures++;
+    }
+}
+
+static void copyFile(const string& from, const string& to) {
+    ifstream in(from, ios::binary);
+    ofstream out(to, ios::binary);
+    out << in.rdbuf();
+}
+
+static void writeFile(const string& path, const string& text) {
+    ofstream out(path);
+    out << text;
+}
+
+/** Check a script against the logic and theories of the given configuration */
+static bool check(const string& path, sptr_t<Configuration> config) {
+    sptr_t<SmtExecutionSettings> settings = make_shared<SmtExecutionSettings>();
+    settings->setInputFromFile(path);
+    settings->setSortCheckContext(make_shared<SortednessCheckerContext>(make_shared<SymbolStack>(), config));
+
+    SmtExecution exec(settings);
+    return exec.checkSortedness();
+}
+
+int main() {
+    char dirTemplate[] = "/tmp/parse_errors_XXXXXX";
+    if (!mkdtemp(dirTemplate)) {
+        perror("mkdtemp");
+        return 1;
+    }
+
+    string dir = dirTemplate;
+    string theories = dir + "/Theories/";
+    string logics = dir + "/Logics/";
+    string script = dir + "/script.smt2";
+    string brokenScript = dir + "/broken_script.smt2";
+    mkdir(theories.c_str(), 0700);
+    mkdir(logics.c_str(), 0700);
+
+    copyFile("input/Theories/Core.smt2", theories + "Core.smt2");
+    copyFile("input/Theories/Ints.smt2", theories + "Ints.smt2");
+    writeFile(theories + "Broken.smt2", "(theory Broken\n :sorts ((Thing 0)\n)\n");
+    writeFile(logics + "INTS.smt2", "(logic INTS :theories (Ints))\n");
+    writeFile(logics + "BROKEN.smt2", "(logic BROKEN :theories (Ints Broken))\n");
+    writeFile(script, "(set-logic INTS)\n(declare-fun x () Int)\n(assert (< x 1))\n(check-sat)\n");
+    writeFile(brokenScript, "(set-logic BROKEN)\n(declare-fun x () Int)\n(check-sat)\n");
+    writeFile(dir + "/paths.cfg", "LOC_LOGICS = " + logics + "\nLOC_THEORIES = " + theories + "\n");
+
+    sptr_t<Configuration> config = make_shared<Configuration>(dir + "/paths.cfg");
+
+    // The error in the theory goes through the parse of the script
+    bool thrown = false;
+    try {
+        check(brokenScript, config);
+    } catch (const ParseError&) {
+        thrown = true;
+    }
+    expect(thrown, "a parsing error in a theory is thrown from the check of the script");
+
+    // The lexer and parser state put aside for the nested parse has been restored
+    expect(check(script, config), "a script is checked as usual after a parsing error");
+
+    const char* files[] = { "Theories/Core.smt2", "Theories/Ints.smt2", "Theories/Broken.smt2",
+                            "Logics/INTS.smt2", "Logics/BROKEN.smt2", "script.smt2",
+                            "broken_script.smt2", "paths.cfg" };
+    for (const char* file : files) {
+        remove((dir + "/" + file).c_str());
+    }
+    rmdir(theories.c_str());
+    rmdir(logics.c_str());
+    rmdir(dir.c_str());
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,61 @@
+# Check a script with smtlib-parser and compare what it prints with the expected output.
+# Called as: cmake -DPARSER=<executable> -DSCRIPT=<script> -P run_script.cmake
+#
+# The expected output of NAME.smt2 is kept in NAME.out: what is printed to the standard
+# output, followed by what is printed to the standard error. Leading comment lines of the
+# script can give:
+#   the arguments to run the parser with       ; args: --pipeline
+#   the expected exit code (0 if not given)    ; exit: 1
+#   text that varies between runs, replaced    ; mask: [0-9]+\.[0-9]+
+#   by '#' before comparing
+#   a stream each line of which must be a      ; json: stdout
+#   JSON value (checked with CMake 3.19 on)
+
+file(STRINGS ${SCRIPT} header REGEX "^;")
+set(args "")
+set(expected_exit 0)
+set(masks "")
+set(json_stream "")
+foreach(line ${header})
+    if(line MATCHES "^; args: (.*)$")
+        separate_arguments(args UNIX_COMMAND "${CMAKE_MATCH_1}")
+    elseif(line MATCHES "^; exit: ([0-9]+)$")
+        set(expected_exit ${CMAKE_MATCH_1})
+    elseif(line MATCHES "^; mask: (.*)$")
+        list(APPEND masks "${CMAKE_MATCH_1}")
+    elseif(line MATCHES "^; json: (stdout|stderr)$")
+        set(json_stream ${CMAKE_MATCH_1})
+    endif()
+endforeach()
+
+execute_process(COMMAND ${PARSER} ${args} ${SCRIPT}
+                OUTPUT_VARIABLE stdout
+                ERROR_VARIABLE stderr
+                RESULT_VARIABLE exit_code)
+set(output "${stdout}${stderr}")
+
+string(REGEX REPLACE "\\.smt2$" ".out" expected_file ${SCRIPT})
+file(READ ${expected_file} expected)
+
+if(NOT exit_code STREQUAL expected_exit)
+    message(FATAL_ERROR "Exit code ${exit_code}, expected ${expected_exit}. Output:\n${output}")
+endif()
+
+if(json_stream AND NOT CMAKE_VERSION VERSION_LESS 3.19)
+    string(REPLACE ";" "\\;" json_text "${${json_stream}}")
+    string(REPLACE "\n" ";" json_lines "${json_text}")
+    foreach(json_line ${json_lines})
+        string(JSON json_type ERROR_VARIABLE json_error TYPE "${json_line}")
+        if(json_error)
+            message(FATAL_ERROR "Not JSON on the ${json_stream}: ${json_error}\n${json_line}")
+        endif()
+    endforeach()
+endif()
+
+foreach(mask ${masks})
+    string(REGEX REPLACE "${mask}" "#" output "${output}")
+endforeach()
+
+if(NOT output STREQUAL expected)
+    message(FATAL_ERROR "Output differs from ${expected_file}:\n${output}")
+endif()
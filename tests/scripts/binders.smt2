@@ -0,0 +1,30 @@
+; Variables bound by forall, exists, let and match shadow constants and outer
+; variables with the same name, even when the sort of the binder cannot be
+; expanded: the bound variable then has no sort, and the term is not
+; well-sorted. A let whose binding is not well-sorted binds nothing.
+(set-logic AUFLIA)
+(define-sort P (X) (Array X X))
+(declare-const x Int)
+(declare-const y Int)
+(declare-const b Bool)
+(assert (forall ((x P)) (= x 1)))
+(assert (exists ((x (P Int Int))) (= x 1)))
+(assert (forall ((x Bool)) x))
+(assert (forall ((x Bool)) (= x 1)))
+(assert (forall ((x Int)) (let ((x true)) x)))
+(assert (forall ((x Int)) (let ((x true)) (= x 1))))
+(assert (forall ((x Int)) (and (let ((x true)) x) (> x 0))))
+(assert (let ((x b)) (forall ((x Int)) (> x 0))))
+(assert (let ((y (+ b 1))) (= y 0)))
+(assert (let ((y b)) (let ((y (+ y 1))) (= y 0))))
+(assert (forall ((x P)) (let ((x 1)) (= x 1))))
+(declare-datatype Pair ((pair (first Int) (second Bool))))
+(declare-datatype Opt ((none) (some (val Int))))
+(declare-const p Pair)
+(declare-const o Opt)
+(assert (match p (((pair x y) (and y (> x 0))))))
+(assert (match p (((pair b x) (and b (> x 0))))))
+(assert (match o ((none false) ((some y) (> y 0)))))
+(assert (match o ((none false) (x (> x 0)))))
+(assert (match o ((none false) (b (= b o)))))
+(check-sat)
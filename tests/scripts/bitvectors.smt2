@@ -0,0 +1,78 @@
+; Widths of the bit-vector functions and literals of FixedSizeBitVectors.
+; The asserts with an "error" comment are ill-sorted; all others are well-sorted.
+(set-logic QF_BV)
+(declare-const a (_ BitVec 8))
+(declare-const b (_ BitVec 8))
+(declare-const c (_ BitVec 4))
+(declare-const d (_ BitVec 16))
+(declare-const e (_ BitVec 1))
+; concat adds the widths
+(assert (= (concat a c) (concat c a)))
+(assert (= (concat a b) d))
+(assert (= (concat (concat a c) c) d))
+; error: 12 bits compared with 16
+(assert (= (concat a c) d))
+; extract keeps bits i down to j
+(assert (= ((_ extract 7 4) a) c))
+(assert (= ((_ extract 7 0) a) b))
+(assert (= ((_ extract 0 0) a) e))
+(assert (= ((_ extract 11 4) (concat a c)) b))
+; error: 8 is out of range for 8 bits
+(assert (= ((_ extract 8 1) a) b))
+; error: i < j
+(assert (= ((_ extract 3 4) a) e))
+; error: 5 bits compared with 4
+(assert (= ((_ extract 4 0) a) c))
+; repeat, zero_extend, sign_extend, rotate
+(assert (= ((_ repeat 2) a) d))
+(assert (= ((_ repeat 4) c) d))
+(assert (= ((_ zero_extend 8) a) d))
+(assert (= ((_ sign_extend 4) c) a))
+(assert (= ((_ zero_extend 0) a) b))
+(assert (= ((_ rotate_left 3) a) ((_ rotate_right 13) b)))
+; error: repeat 0
+(assert (= ((_ repeat 0) a) a))
+; error: 12 bits compared with 16
+(assert (= ((_ sign_extend 4) a) d))
+; error: rotating a 4-bit vector gives 4 bits
+(assert (= ((_ rotate_left 1) c) a))
+; #b and #x literals are as wide as their digits, leading zeros included
+(assert (= #b0000 c))
+(assert (= #b00000001 a))
+(assert (= #x0f a))
+(assert (= #x000f d))
+(assert (= #b1 e))
+; error: #x0f has 8 bits
+(assert (= #x0f c))
+; error: #b001 has 3 bits
+(assert (= #b001 c))
+; (_ bvN m) has m bits
+(assert (= (_ bv5 8) a))
+(assert (= (_ bv0 16) d))
+(assert (= (_ bv255 4) c))
+; error: (_ bv1 16) has 16 bits
+(assert (= (_ bv1 16) a))
+; error: zero width
+(assert (= (_ bv1 0) a))
+; bvadd, bvmul, bvand, bvor and bvxor take two or more arguments of the same width
+(assert (= (bvadd a b) (bvadd a b a b)))
+(assert (= (bvand c #x3) (bvor c c c)))
+; error: widths 8 and 4
+(assert (= (bvadd a b c) a))
+; error: a single argument
+(assert (= (bvmul a) a))
+; error: bvsub takes exactly two arguments
+(assert (= (bvsub a b a) a))
+; bvcomp gives one bit
+(assert (= (bvcomp a b) e))
+(assert (= (bvcomp c #x3) #b1))
+; error: bvcomp of different widths
+(assert (= (bvcomp a c) e))
+; error: bvcomp gives one bit, not eight
+(assert (= (bvcomp a b) a))
+; predicates and unary functions
+(assert (bvult a (bvneg b)))
+(assert (bvsge (bvnot d) (bvudiv d d)))
+; error: bvule of different widths
+(assert (bvule a d))
+(check-sat)
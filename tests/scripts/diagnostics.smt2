@@ -0,0 +1,13 @@
+; Errors are also written as JSON Lines records to the standard output, with
+; byte offsets (columns are counted in bytes: the é of the quoted symbol
+; below counts for two), messages escaped as JSON strings, and null positions
+; for errors not found at a node.
+; args: --diagnostics=-
+; json: stdout
+(set-logic QF_LIA)
+(declare-fun |café| () Int)
+(assert (and (> |café| 1) (+ |café| 1)))
+(assert (= x "say ""hi""
+there"))
+(declare-fun y () Foo)
+(check-sat)
@@ -0,0 +1,12 @@
+; With syntax errors, only their records are written: the records of the
+; sortedness errors below (an unknown sort and an ill-sorted assertion) are
+; held back while checking, then dropped, as their messages are.
+; args: --diagnostics=-
+; json: stdout
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Foo)
+(define-sort Pair (X Y) Int)
+(assert (+ x 1))
+(define-sort Single (X) X)
+(check-sat)
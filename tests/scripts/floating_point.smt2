@@ -0,0 +1,75 @@
+; Formats of the floating point functions and literals of FloatingPoint,
+; checked against the QF_FP logic. The asserts with an "error" comment are
+; ill-sorted; all others are well-sorted.
+(set-logic QF_FP)
+(declare-const x (_ FloatingPoint 8 24))
+(declare-const y Float32)
+(declare-const z (_ FloatingPoint 11 53))
+(declare-const w Float64)
+(declare-const h Float16)
+(declare-const q Float128)
+(declare-const r Real)
+(declare-const m RoundingMode)
+(declare-const b8 (_ BitVec 8))
+(declare-const b16 (_ BitVec 16))
+(declare-const b32 (_ BitVec 32))
+(declare-const b64 (_ BitVec 64))
+; Float32 and Float64 are synonyms of their formats
+(assert (fp.eq x y))
+(assert (fp.eq z w))
+(assert (= h ((_ to_fp 5 11) RNE x)))
+(assert (= q ((_ to_fp 15 113) m z)))
+; error: Float32 and Float64 differ
+(assert (fp.eq y w))
+; fp literals take a sign bit, the exponent and the significand without its hidden bit
+(assert (= (fp #b0 #b10000000 #b00000000000000000000000) x))
+(assert (= (fp #b1 #b11111111111 #x0000000000000) w))
+(assert (= (fp #b0 #b00000 #b0000000000) h))
+; error: the significand has 24 bits, so the format is (8 25)
+(assert (= (fp #b0 #b10000000 #b000000000000000000000000) x))
+; error: the sign has two bits
+(assert (= (fp #b00 #b10000000 #b00000000000000000000000) x))
+; error: the exponent has one bit
+(assert (= (fp #b0 #b1 #b00000000000000000000000) x))
+; special values
+(assert (= (_ +oo 8 24) x))
+(assert (fp.isNaN (_ NaN 11 53)))
+(assert (fp.isZero (_ -zero 5 11)))
+; error: (_ +zero 8 24) is not a Float64
+(assert (= (_ +zero 8 24) w))
+; every variant of to_fp
+(assert (= ((_ to_fp 8 24) b32) x))
+(assert (= ((_ to_fp 11 53) b64) w))
+(assert (= ((_ to_fp 8 24) RNE w) x))
+(assert (= ((_ to_fp 8 24) RTZ r) x))
+(assert (= ((_ to_fp 11 53) m b16) w))
+(assert (= ((_ to_fp_unsigned 8 24) RNA b8) x))
+; error: 64 bits do not make a Float32
+(assert (= ((_ to_fp 8 24) b64) x))
+; error: the rounding mode is missing
+(assert (= ((_ to_fp 8 24) w) x))
+; error: to_fp_unsigned takes a bit vector, not a floating point
+(assert (= ((_ to_fp_unsigned 8 24) RNE w) x))
+; error: exponent and significand must have more than one bit
+(assert (= ((_ to_fp 1 24) RNE w) x))
+; error: the result is a Float64, not a Float32
+(assert (= ((_ to_fp 11 53) RNE x) x))
+; fp.to_ubv and fp.to_sbv give bit vectors of the given width
+(assert (= ((_ fp.to_ubv 8) RNE x) b8))
+(assert (= ((_ fp.to_sbv 16) RTP w) b16))
+; error: the width is 8, not 16
+(assert (= ((_ fp.to_ubv 8) RNE x) b16))
+; error: the rounding mode is missing
+(assert (= ((_ fp.to_sbv 8) x) b8))
+; arithmetic and comparisons need a common format
+(assert (fp.leq x (fp.add RNE x y) (fp.mul m y x)))
+(assert (= (fp.fma RNE w w w) (fp.sqrt RNE w)))
+(assert (= (fp.to_real x) r))
+(assert (fp.isNormal (fp.min (fp.abs h) (fp.neg h))))
+; error: format mismatch in fp.add
+(assert (fp.isNormal (fp.add RNE x w)))
+; error: format mismatch in fp.lt
+(assert (fp.lt x y w))
+; error: fp.rem is not rounded
+(assert (= (fp.rem RNE x y) x))
+(check-sat)
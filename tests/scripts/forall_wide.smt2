@@ -0,0 +1,509 @@
+; Wide conjunctions under quantifiers and lets, large enough to be sorted
+; in parts when checking in parallel (see forall_wide_parallel.smt2).
+(set-logic LIA)
+(declare-fun x () Int)
+(assert (forall ((a Int) (b Int)) (let ((c (+ a b))) (and
+    (<= (* b 0) c) (< (+ a 1) (- c x)) (<= (* b 2) c) (< (+ a 3) (- c x)) (<= (* b 4) c) (< (+ a 5) (- c x)) (<= (* b 6) c) (< (+ a 7) (- c x))
+    (<= (* b 8) c) (< (+ a 9) (- c x)) (<= (* b 10) c) (< (+ a 11) (- c x)) (<= (* b 12) c) (< (+ a 13) (- c x)) (<= (* b 14) c) (< (+ a 15) (- c x))
+    (<= (* b 16) c) (< (+ a 17) (- c x)) (<= (* b 18) c) (< (+ a 19) (- c x)) (<= (* b 20) c) (< (+ a 21) (- c x)) (<= (* b 22) c) (< (+ a 23) (- c x))
+    (<= (* b 24) c) (< (+ a 25) (- c x)) (<= (* b 26) c) (< (+ a 27) (- c x)) (<= (* b 28) c) (< (+ a 29) (- c x)) (<= (* b 30) c) (< (+ a 31) (- c x))
+    (<= (* b 32) c) (< (+ a 33) (- c x)) (<= (* b 34) c) (< (+ a 35) (- c x)) (<= (* b 36) c) (< (+ a 37) (- c x)) (<= (* b 38) c) (< (+ a 39) (- c x))
+    (<= (* b 40) c) (< (+ a 41) (- c x)) (<= (* b 42) c) (< (+ a 43) (- c x)) (<= (* b 44) c) (< (+ a 45) (- c x)) (<= (* b 46) c) (< (+ a 47) (- c x))
+    (<= (* b 48) c) (< (+ a 49) (- c x)) (<= (* b 50) c) (< (+ a 51) (- c x)) (<= (* b 52) c) (< (+ a 53) (- c x)) (<= (* b 54) c) (< (+ a 55) (- c x))
+    (<= (* b 56) c) (< (+ a 57) (- c x)) (<= (* b 58) c) (< (+ a 59) (- c x)) (<= (* b 60) c) (< (+ a 61) (- c x)) (<= (* b 62) c) (< (+ a 63) (- c x))
+    (<= (* b 64) c) (< (+ a 65) (- c x)) (<= (* b 66) c) (< (+ a 67) (- c x)) (<= (* b 68) c) (< (+ a 69) (- c x)) (<= (* b 70) c) (< (+ a 71) (- c x))
+    (<= (* b 72) c) (< (+ a 73) (- c x)) (<= (* b 74) c) (< (+ a 75) (- c x)) (<= (* b 76) c) (< (+ a 77) (- c x)) (<= (* b 78) c) (< (+ a 79) (- c x))
+    (<= (* b 80) c) (< (+ a 81) (- c x)) (<= (* b 82) c) (< (+ a 83) (- c x)) (<= (* b 84) c) (< (+ a 85) (- c x)) (<= (* b 86) c) (< (+ a 87) (- c x))
+    (<= (* b 88) c) (< (+ a 89) (- c x)) (<= (* b 90) c) (< (+ a 91) (- c x)) (<= (* b 92) c) (< (+ a 93) (- c x)) (<= (* b 94) c) (< (+ a 95) (- c x))
+    (<= (* b 96) c) (< (+ a 97) (- c x)) (<= (* b 98) c) (< (+ a 99) (- c x)) (<= (* b 100) c) (< (+ a 101) (- c x)) (<= (* b 102) c) (< (+ a 103) (- c x))
+    (<= (* b 104) c) (< (+ a 105) (- c x)) (<= (* b 106) c) (< (+ a 107) (- c x)) (<= (* b 108) c) (< (+ a 109) (- c x)) (<= (* b 110) c) (< (+ a 111) (- c x))
+    (<= (* b 112) c) (< (+ a 113) (- c x)) (<= (* b 114) c) (< (+ a 115) (- c x)) (<= (* b 116) c) (< (+ a 117) (- c x)) (<= (* b 118) c) (< (+ a 119) (- c x))
+    (<= (* b 120) c) (< (+ a 121) (- c x)) (<= (* b 122) c) (< (+ a 123) (- c x)) (<= (* b 124) c) (< (+ a 125) (- c x)) (<= (* b 126) c) (< (+ a 127) (- c x))
+    (<= (* b 128) c) (< (+ a 129) (- c x)) (<= (* b 130) c) (< (+ a 131) (- c x)) (<= (* b 132) c) (< (+ a 133) (- c x)) (<= (* b 134) c) (< (+ a 135) (- c x))
+    (<= (* b 136) c) (< (+ a 137) (- c x)) (<= (* b 138) c) (< (+ a 139) (- c x)) (<= (* b 140) c) (< (+ a 141) (- c x)) (<= (* b 142) c) (< (+ a 143) (- c x))
+    (<= (* b 144) c) (< (+ a 145) (- c x)) (<= (* b 146) c) (< (+ a 147) (- c x)) (<= (* b 148) c) (< (+ a 149) (- c x)) (<= (* b 150) c) (< (+ a 151) (- c x))
+    (<= (* b 152) c) (< (+ a 153) (- c x)) (<= (* b 154) c) (< (+ a 155) (- c x)) (<= (* b 156) c) (< (+ a 157) (- c x)) (<= (* b 158) c) (< (+ a 159) (- c x))
+    (<= (* b 160) c) (< (+ a 161) (- c x)) (<= (* b 162) c) (< (+ a 163) (- c x)) (<= (* b 164) c) (< (+ a 165) (- c x)) (<= (* b 166) c) (< (+ a 167) (- c x))
+    (<= (* b 168) c) (< (+ a 169) (- c x)) (<= (* b 170) c) (< (+ a 171) (- c x)) (<= (* b 172) c) (< (+ a 173) (- c x)) (<= (* b 174) c) (< (+ a 175) (- c x))
+    (<= (* b 176) c) (< (+ a 177) (- c x)) (<= (* b 178) c) (< (+ a 179) (- c x)) (<= (* b 180) c) (< (+ a 181) (- c x)) (<= (* b 182) c) (< (+ a 183) (- c x))
+    (<= (* b 184) c) (< (+ a 185) (- c x)) (<= (* b 186) c) (< (+ a 187) (- c x)) (<= (* b 188) c) (< (+ a 189) (- c x)) (<= (* b 190) c) (< (+ a 191) (- c x))
+    (<= (* b 192) c) (< (+ a 193) (- c x)) (<= (* b 194) c) (< (+ a 195) (- c x)) (<= (* b 196) c) (< (+ a 197) (- c x)) (<= (* b 198) c) (< (+ a 199) (- c x))
+    (<= (* b 200) c) (< (+ a 201) (- c x)) (<= (* b 202) c) (< (+ a 203) (- c x)) (<= (* b 204) c) (< (+ a 205) (- c x)) (<= (* b 206) c) (< (+ a 207) (- c x))
+    (<= (* b 208) c) (< (+ a 209) (- c x)) (<= (* b 210) c) (< (+ a 211) (- c x)) (<= (* b 212) c) (< (+ a 213) (- c x)) (<= (* b 214) c) (< (+ a 215) (- c x))
+    (<= (* b 216) c) (< (+ a 217) (- c x)) (<= (* b 218) c) (< (+ a 219) (- c x)) (<= (* b 220) c) (< (+ a 221) (- c x)) (<= (* b 222) c) (< (+ a 223) (- c x))
+    (<= (* b 224) c) (< (+ a 225) (- c x)) (<= (* b 226) c) (< (+ a 227) (- c x)) (<= (* b 228) c) (< (+ a 229) (- c x)) (<= (* b 230) c) (< (+ a 231) (- c x))
+    (<= (* b 232) c) (< (+ a 233) (- c x)) (<= (* b 234) c) (< (+ a 235) (- c x)) (<= (* b 236) c) (< (+ a 237) (- c x)) (<= (* b 238) c) (< (+ a 239) (- c x))
+    (<= (* b 240) c) (< (+ a 241) (- c x)) (<= (* b 242) c) (< (+ a 243) (- c x)) (<= (* b 244) c) (< (+ a 245) (- c x)) (<= (* b 246) c) (< (+ a 247) (- c x))
+    (<= (* b 248) c) (< (+ a 249) (- c x)) (<= (* b 250) c) (< (+ a 251) (- c x)) (<= (* b 252) c) (< (+ a 253) (- c x)) (<= (* b 254) c) (< (+ a 255) (- c x))
+    (<= (* b 256) c) (< (+ a 257) (- c x)) (<= (* b 258) c) (< (+ a 259) (- c x)) (<= (* b 260) c) (< (+ a 261) (- c x)) (<= (* b 262) c) (< (+ a 263) (- c x))
+    (<= (* b 264) c) (< (+ a 265) (- c x)) (<= (* b 266) c) (< (+ a 267) (- c x)) (<= (* b 268) c) (< (+ a 269) (- c x)) (<= (* b 270) c) (< (+ a 271) (- c x))
+    (<= (* b 272) c) (< (+ a 273) (- c x)) (<= (* b 274) c) (< (+ a 275) (- c x)) (<= (* b 276) c) (< (+ a 277) (- c x)) (<= (* b 278) c) (< (+ a 279) (- c x))
+    (<= (* b 280) c) (< (+ a 281) (- c x)) (<= (* b 282) c) (< (+ a 283) (- c x)) (<= (* b 284) c) (< (+ a 285) (- c x)) (<= (* b 286) c) (< (+ a 287) (- c x))
+    (<= (* b 288) c) (< (+ a 289) (- c x)) (<= (* b 290) c) (< (+ a 291) (- c x)) (<= (* b 292) c) (< (+ a 293) (- c x)) (<= (* b 294) c) (< (+ a 295) (- c x))
+    (<= (* b 296) c) (< (+ a 297) (- c x)) (<= (* b 298) c) (< (+ a 299) (- c x)) (<= (* b 300) c) (< (+ a 301) (- c x)) (<= (* b 302) c) (< (+ a 303) (- c x))
+    (<= (* b 304) c) (< (+ a 305) (- c x)) (<= (* b 306) c) (< (+ a 307) (- c x)) (<= (* b 308) c) (< (+ a 309) (- c x)) (<= (* b 310) c) (< (+ a 311) (- c x))
+    (<= (* b 312) c) (< (+ a 313) (- c x)) (<= (* b 314) c) (< (+ a 315) (- c x)) (<= (* b 316) c) (< (+ a 317) (- c x)) (<= (* b 318) c) (< (+ a 319) (- c x))
+    (<= (* b 320) c) (< (+ a 321) (- c x)) (<= (* b 322) c) (< (+ a 323) (- c x)) (<= (* b 324) c) (< (+ a 325) (- c x)) (<= (* b 326) c) (< (+ a 327) (- c x))
+    (<= (* b 328) c) (< (+ a 329) (- c x)) (<= (* b 330) c) (< (+ a 331) (- c x)) (<= (* b 332) c) (< (+ a 333) (- c x)) (<= (* b 334) c) (< (+ a 335) (- c x))
+    (<= (* b 336) c) (< (+ a 337) (- c x)) (<= (* b 338) c) (< (+ a 339) (- c x)) (<= (* b 340) c) (< (+ a 341) (- c x)) (<= (* b 342) c) (< (+ a 343) (- c x))
+    (<= (* b 344) c) (< (+ a 345) (- c x)) (<= (* b 346) c) (< (+ a 347) (- c x)) (<= (* b 348) c) (< (+ a 349) (- c x)) (<= (* b 350) c) (< (+ a 351) (- c x))
+    (<= (* b 352) c) (< (+ a 353) (- c x)) (<= (* b 354) c) (< (+ a 355) (- c x)) (<= (* b 356) c) (< (+ a 357) (- c x)) (<= (* b 358) c) (< (+ a 359) (- c x))
+    (<= (* b 360) c) (< (+ a 361) (- c x)) (<= (* b 362) c) (< (+ a 363) (- c x)) (<= (* b 364) c) (< (+ a 365) (- c x)) (<= (* b 366) c) (< (+ a 367) (- c x))
+    (<= (* b 368) c) (< (+ a 369) (- c x)) (<= (* b 370) c) (< (+ a 371) (- c x)) (<= (* b 372) c) (< (+ a 373) (- c x)) (<= (* b 374) c) (< (+ a 375) (- c x))
+    (<= (* b 376) c) (< (+ a 377) (- c x)) (<= (* b 378) c) (< (+ a 379) (- c x)) (<= (* b 380) c) (< (+ a 381) (- c x)) (<= (* b 382) c) (< (+ a 383) (- c x))
+    (<= (* b 384) c) (< (+ a 385) (- c x)) (<= (* b 386) c) (< (+ a 387) (- c x)) (<= (* b 388) c) (< (+ a 389) (- c x)) (<= (* b 390) c) (< (+ a 391) (- c x))
+    (<= (* b 392) c) (< (+ a 393) (- c x)) (<= (* b 394) c) (< (+ a 395) (- c x)) (<= (* b 396) c) (< (+ a 397) (- c x)) (<= (* b 398) c) (< (+ a 399) (- c x))
+    (<= (* b 400) c) (< (+ a 401) (- c x)) (<= (* b 402) c) (< (+ a 403) (- c x)) (<= (* b 404) c) (< (+ a 405) (- c x)) (<= (* b 406) c) (< (+ a 407) (- c x))
+    (<= (* b 408) c) (< (+ a 409) (- c x)) (<= (* b 410) c) (< (+ a 411) (- c x)) (<= (* b 412) c) (< (+ a 413) (- c x)) (<= (* b 414) c) (< (+ a 415) (- c x))
+    (<= (* b 416) c) (< (+ a 417) (- c x)) (<= (* b 418) c) (< (+ a 419) (- c x)) (<= (* b 420) c) (< (+ a 421) (- c x)) (<= (* b 422) c) (< (+ a 423) (- c x))
+    (<= (* b 424) c) (< (+ a 425) (- c x)) (<= (* b 426) c) (< (+ a 427) (- c x)) (<= (* b 428) c) (< (+ a 429) (- c x)) (<= (* b 430) c) (< (+ a 431) (- c x))
+    (<= (* b 432) c) (< (+ a 433) (- c x)) (<= (* b 434) c) (< (+ a 435) (- c x)) (<= (* b 436) c) (< (+ a 437) (- c x)) (<= (* b 438) c) (< (+ a 439) (- c x))
+    (<= (* b 440) c) (< (+ a 441) (- c x)) (<= (* b 442) c) (< (+ a 443) (- c x)) (<= (* b 444) c) (< (+ a 445) (- c x)) (<= (* b 446) c) (< (+ a 447) (- c x))
+    (<= (* b 448) c) (< (+ a 449) (- c x)) (<= (* b 450) c) (< (+ a 451) (- c x)) (<= (* b 452) c) (< (+ a 453) (- c x)) (<= (* b 454) c) (< (+ a 455) (- c x))
+    (<= (* b 456) c) (< (+ a 457) (- c x)) (<= (* b 458) c) (< (+ a 459) (- c x)) (<= (* b 460) c) (< (+ a 461) (- c x)) (<= (* b 462) c) (< (+ a 463) (- c x))
+    (<= (* b 464) c) (< (+ a 465) (- c x)) (<= (* b 466) c) (< (+ a 467) (- c x)) (<= (* b 468) c) (< (+ a 469) (- c x)) (<= (* b 470) c) (< (+ a 471) (- c x))
+    (<= (* b 472) c) (< (+ a 473) (- c x)) (<= (* b 474) c) (< (+ a 475) (- c x)) (<= (* b 476) c) (< (+ a 477) (- c x)) (<= (* b 478) c) (< (+ a 479) (- c x))
+    (<= (* b 480) c) (< (+ a 481) (- c x)) (<= (* b 482) c) (< (+ a 483) (- c x)) (<= (* b 484) c) (< (+ a 485) (- c x)) (<= (* b 486) c) (< (+ a 487) (- c x))
+    (<= (* b 488) c) (< (+ a 489) (- c x)) (<= (* b 490) c) (< (+ a 491) (- c x)) (<= (* b 492) c) (< (+ a 493) (- c x)) (<= (* b 494) c) (< (+ a 495) (- c x))
+    (<= (* b 496) c) (< (+ a 497) (- c x)) (<= (* b 498) c) (< (+ a 499) (- c x)) (<= (* b 500) c) (< (+ a 501) (- c x)) (<= (* b 502) c) (< (+ a 503) (- c x))
+    (<= (* b 504) c) (< (+ a 505) (- c x)) (<= (* b 506) c) (< (+ a 507) (- c x)) (<= (* b 508) c) (< (+ a 509) (- c x)) (<= (* b 510) c) (< (+ a 511) (- c x))
+    (<= (* b 512) c) (< (+ a 513) (- c x)) (<= (* b 514) c) (< (+ a 515) (- c x)) (<= (* b 516) c) (< (+ a 517) (- c x)) (<= (* b 518) c) (< (+ a 519) (- c x))
+    (<= (* b 520) c) (< (+ a 521) (- c x)) (<= (* b 522) c) (< (+ a 523) (- c x)) (<= (* b 524) c) (< (+ a 525) (- c x)) (<= (* b 526) c) (< (+ a 527) (- c x))
+    (<= (* b 528) c) (< (+ a 529) (- c x)) (<= (* b 530) c) (< (+ a 531) (- c x)) (<= (* b 532) c) (< (+ a 533) (- c x)) (<= (* b 534) c) (< (+ a 535) (- c x))
+    (<= (* b 536) c) (< (+ a 537) (- c x)) (<= (* b 538) c) (< (+ a 539) (- c x)) (<= (* b 540) c) (< (+ a 541) (- c x)) (<= (* b 542) c) (< (+ a 543) (- c x))
+    (<= (* b 544) c) (< (+ a 545) (- c x)) (<= (* b 546) c) (< (+ a 547) (- c x)) (<= (* b 548) c) (< (+ a 549) (- c x)) (<= (* b 550) c) (< (+ a 551) (- c x))
+    (<= (* b 552) c) (< (+ a 553) (- c x)) (<= (* b 554) c) (< (+ a 555) (- c x)) (<= (* b 556) c) (< (+ a 557) (- c x)) (<= (* b 558) c) (< (+ a 559) (- c x))
+    (<= (* b 560) c) (< (+ a 561) (- c x)) (<= (* b 562) c) (< (+ a 563) (- c x)) (<= (* b 564) c) (< (+ a 565) (- c x)) (<= (* b 566) c) (< (+ a 567) (- c x))
+    (<= (* b 568) c) (< (+ a 569) (- c x)) (<= (* b 570) c) (< (+ a 571) (- c x)) (<= (* b 572) c) (< (+ a 573) (- c x)) (<= (* b 574) c) (< (+ a 575) (- c x))
+    (<= (* b 576) c) (< (+ a 577) (- c x)) (<= (* b 578) c) (< (+ a 579) (- c x)) (<= (* b 580) c) (< (+ a 581) (- c x)) (<= (* b 582) c) (< (+ a 583) (- c x))
+    (<= (* b 584) c) (< (+ a 585) (- c x)) (<= (* b 586) c) (< (+ a 587) (- c x)) (<= (* b 588) c) (< (+ a 589) (- c x)) (<= (* b 590) c) (< (+ a 591) (- c x))
+    (<= (* b 592) c) (< (+ a 593) (- c x)) (<= (* b 594) c) (< (+ a 595) (- c x)) (<= (* b 596) c) (< (+ a 597) (- c x)) (<= (* b 598) c) (< (+ a 599) (- c x))
+    (<= (* b 600) c) (< (+ a 601) (- c x)) (<= (* b 602) c) (< (+ a 603) (- c x)) (<= (* b 604) c) (< (+ a 605) (- c x)) (<= (* b 606) c) (< (+ a 607) (- c x))
+    (<= (* b 608) c) (< (+ a 609) (- c x)) (<= (* b 610) c) (< (+ a 611) (- c x)) (<= (* b 612) c) (< (+ a 613) (- c x)) (<= (* b 614) c) (< (+ a 615) (- c x))
+    (<= (* b 616) c) (< (+ a 617) (- c x)) (<= (* b 618) c) (< (+ a 619) (- c x)) (<= (* b 620) c) (< (+ a 621) (- c x)) (<= (* b 622) c) (< (+ a 623) (- c x))
+    (<= (* b 624) c) (< (+ a 625) (- c x)) (<= (* b 626) c) (< (+ a 627) (- c x)) (<= (* b 628) c) (< (+ a 629) (- c x)) (<= (* b 630) c) (< (+ a 631) (- c x))
+    (<= (* b 632) c) (< (+ a 633) (- c x)) (<= (* b 634) c) (< (+ a 635) (- c x)) (<= (* b 636) c) (< (+ a 637) (- c x)) (<= (* b 638) c) (< (+ a 639) (- c x))
+    (<= (* b 640) c) (< (+ a 641) (- c x)) (<= (* b 642) c) (< (+ a 643) (- c x)) (<= (* b 644) c) (< (+ a 645) (- c x)) (<= (* b 646) c) (< (+ a 647) (- c x))
+    (<= (* b 648) c) (< (+ a 649) (- c x)) (<= (* b 650) c) (< (+ a 651) (- c x)) (<= (* b 652) c) (< (+ a 653) (- c x)) (<= (* b 654) c) (< (+ a 655) (- c x))
+    (<= (* b 656) c) (< (+ a 657) (- c x)) (<= (* b 658) c) (< (+ a 659) (- c x)) (<= (* b 660) c) (< (+ a 661) (- c x)) (<= (* b 662) c) (< (+ a 663) (- c x))
+    (<= (* b 664) c) (< (+ a 665) (- c x)) (<= (* b 666) c) (< (+ a 667) (- c x)) (<= (* b 668) c) (< (+ a 669) (- c x)) (<= (* b 670) c) (< (+ a 671) (- c x))
+    (<= (* b 672) c) (< (+ a 673) (- c x)) (<= (* b 674) c) (< (+ a 675) (- c x)) (<= (* b 676) c) (< (+ a 677) (- c x)) (<= (* b 678) c) (< (+ a 679) (- c x))
+    (<= (* b 680) c) (< (+ a 681) (- c x)) (<= (* b 682) c) (< (+ a 683) (- c x)) (<= (* b 684) c) (< (+ a 685) (- c x)) (<= (* b 686) c) (< (+ a 687) (- c x))
+    (<= (* b 688) c) (< (+ a 689) (- c x)) (<= (* b 690) c) (< (+ a 691) (- c x)) (<= (* b 692) c) (< (+ a 693) (- c x)) (<= (* b 694) c) (< (+ a 695) (- c x))
+    (<= (* b 696) c) (< (+ a 697) (- c x)) (<= (* b 698) c) (< (+ a 699) (- c x)) (<= (* b 700) c) (< (+ a 701) (- c x)) (<= (* b 702) c) (< (+ a 703) (- c x))
+    (<= (* b 704) c) (< (+ a 705) (- c x)) (<= (* b 706) c) (< (+ a 707) (- c x)) (<= (* b 708) c) (< (+ a 709) (- c x)) (<= (* b 710) c) (< (+ a 711) (- c x))
+    (<= (* b 712) c) (< (+ a 713) (- c x)) (<= (* b 714) c) (< (+ a 715) (- c x)) (<= (* b 716) c) (< (+ a 717) (- c x)) (<= (* b 718) c) (< (+ a 719) (- c x))
+    (<= (* b 720) c) (< (+ a 721) (- c x)) (<= (* b 722) c) (< (+ a 723) (- c x)) (<= (* b 724) c) (< (+ a 725) (- c x)) (<= (* b 726) c) (< (+ a 727) (- c x))
+    (<= (* b 728) c) (< (+ a 729) (- c x)) (<= (* b 730) c) (< (+ a 731) (- c x)) (<= (* b 732) c) (< (+ a 733) (- c x)) (<= (* b 734) c) (< (+ a 735) (- c x))
+    (<= (* b 736) c) (< (+ a 737) (- c x)) (<= (* b 738) c) (< (+ a 739) (- c x)) (<= (* b 740) c) (< (+ a 741) (- c x)) (<= (* b 742) c) (< (+ a 743) (- c x))
+    (<= (* b 744) c) (< (+ a 745) (- c x)) (<= (* b 746) c) (< (+ a 747) (- c x)) (<= (* b 748) c) (< (+ a 749) (- c x)) (<= (* b 750) c) (< (+ a 751) (- c x))
+    (<= (* b 752) c) (< (+ a 753) (- c x)) (<= (* b 754) c) (< (+ a 755) (- c x)) (<= (* b 756) c) (< (+ a 757) (- c x)) (<= (* b 758) c) (< (+ a 759) (- c x))
+    (<= (* b 760) c) (< (+ a 761) (- c x)) (<= (* b 762) c) (< (+ a 763) (- c x)) (<= (* b 764) c) (< (+ a 765) (- c x)) (<= (* b 766) c) (< (+ a 767) (- c x))
+    (<= (* b 768) c) (< (+ a 769) (- c x)) (<= (* b 770) c) (< (+ a 771) (- c x)) (<= (* b 772) c) (< (+ a 773) (- c x)) (<= (* b 774) c) (< (+ a 775) (- c x))
+    (<= (* b 776) c) (< (+ a 777) (- c x)) (<= (* b 778) c) (< (+ a 779) (- c x)) (<= (* b 780) c) (< (+ a 781) (- c x)) (<= (* b 782) c) (< (+ a 783) (- c x))
+    (<= (* b 784) c) (< (+ a 785) (- c x)) (<= (* b 786) c) (< (+ a 787) (- c x)) (<= (* b 788) c) (< (+ a 789) (- c x)) (<= (* b 790) c) (< (+ a 791) (- c x))
+    (<= (* b 792) c) (< (+ a 793) (- c x)) (<= (* b 794) c) (< (+ a 795) (- c x)) (<= (* b 796) c) (< (+ a 797) (- c x)) (<= (* b 798) c) (< (+ a 799) (- c x))
+    (<= (* b 800) c) (< (+ a 801) (- c x)) (<= (* b 802) c) (< (+ a 803) (- c x)) (<= (* b 804) c) (< (+ a 805) (- c x)) (<= (* b 806) c) (< (+ a 807) (- c x))
+    (<= (* b 808) c) (< (+ a 809) (- c x)) (<= (* b 810) c) (< (+ a 811) (- c x)) (<= (* b 812) c) (< (+ a 813) (- c x)) (<= (* b 814) c) (< (+ a 815) (- c x))
+    (<= (* b 816) c) (< (+ a 817) (- c x)) (<= (* b 818) c) (< (+ a 819) (- c x)) (<= (* b 820) c) (< (+ a 821) (- c x)) (<= (* b 822) c) (< (+ a 823) (- c x))
+    (<= (* b 824) c) (< (+ a 825) (- c x)) (<= (* b 826) c) (< (+ a 827) (- c x)) (<= (* b 828) c) (< (+ a 829) (- c x)) (<= (* b 830) c) (< (+ a 831) (- c x))
+    (<= (* b 832) c) (< (+ a 833) (- c x)) (<= (* b 834) c) (< (+ a 835) (- c x)) (<= (* b 836) c) (< (+ a 837) (- c x)) (<= (* b 838) c) (< (+ a 839) (- c x))
+    (<= (* b 840) c) (< (+ a 841) (- c x)) (<= (* b 842) c) (< (+ a 843) (- c x)) (<= (* b 844) c) (< (+ a 845) (- c x)) (<= (* b 846) c) (< (+ a 847) (- c x))
+    (<= (* b 848) c) (< (+ a 849) (- c x)) (<= (* b 850) c) (< (+ a 851) (- c x)) (<= (* b 852) c) (< (+ a 853) (- c x)) (<= (* b 854) c) (< (+ a 855) (- c x))
+    (<= (* b 856) c) (< (+ a 857) (- c x)) (<= (* b 858) c) (< (+ a 859) (- c x)) (<= (* b 860) c) (< (+ a 861) (- c x)) (<= (* b 862) c) (< (+ a 863) (- c x))
+    (<= (* b 864) c) (< (+ a 865) (- c x)) (<= (* b 866) c) (< (+ a 867) (- c x)) (<= (* b 868) c) (< (+ a 869) (- c x)) (<= (* b 870) c) (< (+ a 871) (- c x))
+    (<= (* b 872) c) (< (+ a 873) (- c x)) (<= (* b 874) c) (< (+ a 875) (- c x)) (<= (* b 876) c) (< (+ a 877) (- c x)) (<= (* b 878) c) (< (+ a 879) (- c x))
+    (<= (* b 880) c) (< (+ a 881) (- c x)) (<= (* b 882) c) (< (+ a 883) (- c x)) (<= (* b 884) c) (< (+ a 885) (- c x)) (<= (* b 886) c) (< (+ a 887) (- c x))
+    (<= (* b 888) c) (< (+ a 889) (- c x)) (<= (* b 890) c) (< (+ a 891) (- c x)) (<= (* b 892) c) (< (+ a 893) (- c x)) (<= (* b 894) c) (< (+ a 895) (- c x))
+    (<= (* b 896) c) (< (+ a 897) (- c x)) (<= (* b 898) c) (< (+ a 899) (- c x)) (<= (* b 900) c) (< (+ a 901) (- c x)) (<= (* b 902) c) (< (+ a 903) (- c x))
+    (<= (* b 904) c) (< (+ a 905) (- c x)) (<= (* b 906) c) (< (+ a 907) (- c x)) (<= (* b 908) c) (< (+ a 909) (- c x)) (<= (* b 910) c) (< (+ a 911) (- c x))
+    (<= (* b 912) c) (< (+ a 913) (- c x)) (<= (* b 914) c) (< (+ a 915) (- c x)) (<= (* b 916) c) (< (+ a 917) (- c x)) (<= (* b 918) c) (< (+ a 919) (- c x))
+    (<= (* b 920) c) (< (+ a 921) (- c x)) (<= (* b 922) c) (< (+ a 923) (- c x)) (<= (* b 924) c) (< (+ a 925) (- c x)) (<= (* b 926) c) (< (+ a 927) (- c x))
+    (<= (* b 928) c) (< (+ a 929) (- c x)) (<= (* b 930) c) (< (+ a 931) (- c x)) (<= (* b 932) c) (< (+ a 933) (- c x)) (<= (* b 934) c) (< (+ a 935) (- c x))
+    (<= (* b 936) c) (< (+ a 937) (- c x)) (<= (* b 938) c) (< (+ a 939) (- c x)) (<= (* b 940) c) (< (+ a 941) (- c x)) (<= (* b 942) c) (< (+ a 943) (- c x))
+    (<= (* b 944) c) (< (+ a 945) (- c x)) (<= (* b 946) c) (< (+ a 947) (- c x)) (<= (* b 948) c) (< (+ a 949) (- c x)) (<= (* b 950) c) (< (+ a 951) (- c x))
+    (<= (* b 952) c) (< (+ a 953) (- c x)) (<= (* b 954) c) (< (+ a 955) (- c x)) (<= (* b 956) c) (< (+ a 957) (- c x)) (<= (* b 958) c) (< (+ a 959) (- c x))
+    (<= (* b 960) c) (< (+ a 961) (- c x)) (<= (* b 962) c) (< (+ a 963) (- c x)) (<= (* b 964) c) (< (+ a 965) (- c x)) (<= (* b 966) c) (< (+ a 967) (- c x))
+    (<= (* b 968) c) (< (+ a 969) (- c x)) (<= (* b 970) c) (< (+ a 971) (- c x)) (<= (* b 972) c) (< (+ a 973) (- c x)) (<= (* b 974) c) (< (+ a 975) (- c x))
+    (<= (* b 976) c) (< (+ a 977) (- c x)) (<= (* b 978) c) (< (+ a 979) (- c x)) (<= (* b 980) c) (< (+ a 981) (- c x)) (<= (* b 982) c) (< (+ a 983) (- c x))
+    (<= (* b 984) c) (< (+ a 985) (- c x)) (<= (* b 986) c) (< (+ a 987) (- c x)) (<= (* b 988) c) (< (+ a 989) (- c x)) (<= (* b 990) c) (< (+ a 991) (- c x))
+    (<= (* b 992) c) (< (+ a 993) (- c x)) (<= (* b 994) c) (< (+ a 995) (- c x)) (<= (* b 996) c) (< (+ a 997) (- c x)) (<= (* b 998) c) (< (+ a 999) (- c x))
+    (<= (* b 1000) c) (< (+ a 1001) (- c x)) (<= (* b 1002) c) (< (+ a 1003) (- c x)) (<= (* b 1004) c) (< (+ a 1005) (- c x)) (<= (* b 1006) c) (< (+ a 1007) (- c x))
+    (<= (* b 1008) c) (< (+ a 1009) (- c x)) (<= (* b 1010) c) (< (+ a 1011) (- c x)) (<= (* b 1012) c) (< (+ a 1013) (- c x)) (<= (* b 1014) c) (< (+ a 1015) (- c x))
+    (<= (* b 1016) c) (< (+ a 1017) (- c x)) (<= (* b 1018) c) (< (+ a 1019) (- c x)) (<= (* b 1020) c) (< (+ a 1021) (- c x)) (<= (* b 1022) c) (< (+ a 1023) (- c x))
+    (<= (* b 1024) c) (< (+ a 1025) (- c x)) (<= (* b 1026) c) (< (+ a 1027) (- c x)) (<= (* b 1028) c) (< (+ a 1029) (- c x)) (<= (* b 1030) c) (< (+ a 1031) (- c x))
+    (<= (* b 1032) c) (< (+ a 1033) (- c x)) (<= (* b 1034) c) (< (+ a 1035) (- c x)) (<= (* b 1036) c) (< (+ a 1037) (- c x)) (<= (* b 1038) c) (< (+ a 1039) (- c x))
+    (<= (* b 1040) c) (< (+ a 1041) (- c x)) (<= (* b 1042) c) (< (+ a 1043) (- c x)) (<= (* b 1044) c) (< (+ a 1045) (- c x)) (<= (* b 1046) c) (< (+ a 1047) (- c x))
+    (<= (* b 1048) c) (< (+ a 1049) (- c x)) (<= (* b 1050) c) (< (+ a 1051) (- c x)) (<= (* b 1052) c) (< (+ a 1053) (- c x)) (<= (* b 1054) c) (< (+ a 1055) (- c x))
+    (<= (* b 1056) c) (< (+ a 1057) (- c x)) (<= (* b 1058) c) (< (+ a 1059) (- c x)) (<= (* b 1060) c) (< (+ a 1061) (- c x)) (<= (* b 1062) c) (< (+ a 1063) (- c x))
+    (<= (* b 1064) c) (< (+ a 1065) (- c x)) (<= (* b 1066) c) (< (+ a 1067) (- c x)) (<= (* b 1068) c) (< (+ a 1069) (- c x)) (<= (* b 1070) c) (< (+ a 1071) (- c x))
+    (<= (* b 1072) c) (< (+ a 1073) (- c x)) (<= (* b 1074) c) (< (+ a 1075) (- c x)) (<= (* b 1076) c) (< (+ a 1077) (- c x)) (<= (* b 1078) c) (< (+ a 1079) (- c x))
+    (<= (* b 1080) c) (< (+ a 1081) (- c x)) (<= (* b 1082) c) (< (+ a 1083) (- c x)) (<= (* b 1084) c) (< (+ a 1085) (- c x)) (<= (* b 1086) c) (< (+ a 1087) (- c x))
+    (<= (* b 1088) c) (< (+ a 1089) (- c x)) (<= (* b 1090) c) (< (+ a 1091) (- c x)) (<= (* b 1092) c) (< (+ a 1093) (- c x)) (<= (* b 1094) c) (< (+ a 1095) (- c x))
+    (<= (* b 1096) c) (< (+ a 1097) (- c x)) (<= (* b 1098) c) (< (+ a 1099) (- c x)) (<= (* b 1100) c) (< (+ a 1101) (- c x)) (<= (* b 1102) c) (< (+ a 1103) (- c x))
+    (<= (* b 1104) c) (< (+ a 1105) (- c x)) (<= (* b 1106) c) (< (+ a 1107) (- c x)) (<= (* b 1108) c) (< (+ a 1109) (- c x)) (<= (* b 1110) c) (< (+ a 1111) (- c x))
+    (<= (* b 1112) c) (< (+ a 1113) (- c x)) (<= (* b 1114) c) (< (+ a 1115) (- c x)) (<= (* b 1116) c) (< (+ a 1117) (- c x)) (<= (* b 1118) c) (< (+ a 1119) (- c x))
+    (<= (* b 1120) c) (< (+ a 1121) (- c x)) (<= (* b 1122) c) (< (+ a 1123) (- c x)) (<= (* b 1124) c) (< (+ a 1125) (- c x)) (<= (* b 1126) c) (< (+ a 1127) (- c x))
+    (<= (* b 1128) c) (< (+ a 1129) (- c x)) (<= (* b 1130) c) (< (+ a 1131) (- c x)) (<= (* b 1132) c) (< (+ a 1133) (- c x)) (<= (* b 1134) c) (< (+ a 1135) (- c x))
+    (<= (* b 1136) c) (< (+ a 1137) (- c x)) (<= (* b 1138) c) (< (+ a 1139) (- c x)) (<= (* b 1140) c) (< (+ a 1141) (- c x)) (<= (* b 1142) c) (< (+ a 1143) (- c x))
+    (<= (* b 1144) c) (< (+ a 1145) (- c x)) (<= (* b 1146) c) (< (+ a 1147) (- c x)) (<= (* b 1148) c) (< (+ a 1149) (- c x)) (<= (* b 1150) c) (< (+ a 1151) (- c x))
+    (<= (* b 1152) c) (< (+ a 1153) (- c x)) (<= (* b 1154) c) (< (+ a 1155) (- c x)) (<= (* b 1156) c) (< (+ a 1157) (- c x)) (<= (* b 1158) c) (< (+ a 1159) (- c x))
+    (<= (* b 1160) c) (< (+ a 1161) (- c x)) (<= (* b 1162) c) (< (+ a 1163) (- c x)) (<= (* b 1164) c) (< (+ a 1165) (- c x)) (<= (* b 1166) c) (< (+ a 1167) (- c x))
+    (<= (* b 1168) c) (< (+ a 1169) (- c x)) (<= (* b 1170) c) (< (+ a 1171) (- c x)) (<= (* b 1172) c) (< (+ a 1173) (- c x)) (<= (* b 1174) c) (< (+ a 1175) (- c x))
+    (<= (* b 1176) c) (< (+ a 1177) (- c x)) (<= (* b 1178) c) (< (+ a 1179) (- c x)) (<= (* b 1180) c) (< (+ a 1181) (- c x)) (<= (* b 1182) c) (< (+ a 1183) (- c x))
+    (<= (* b 1184) c) (< (+ a 1185) (- c x)) (<= (* b 1186) c) (< (+ a 1187) (- c x)) (<= (* b 1188) c) (< (+ a 1189) (- c x)) (<= (* b 1190) c) (< (+ a 1191) (- c x))
+    (<= (* b 1192) c) (< (+ a 1193) (- c x)) (<= (* b 1194) c) (< (+ a 1195) (- c x)) (<= (* b 1196) c) (< (+ a 1197) (- c x)) (<= (* b 1198) c) (< (+ a 1199) (- c x))
+    (<= (* b 1200) c) (< (+ a 1201) (- c x)) (<= (* b 1202) c) (< (+ a 1203) (- c x)) (<= (* b 1204) c) (< (+ a 1205) (- c x)) (<= (* b 1206) c) (< (+ a 1207) (- c x))
+    (<= (* b 1208) c) (< (+ a 1209) (- c x)) (<= (* b 1210) c) (< (+ a 1211) (- c x)) (<= (* b 1212) c) (< (+ a 1213) (- c x)) (<= (* b 1214) c) (< (+ a 1215) (- c x))
+    (<= (* b 1216) c) (< (+ a 1217) (- c x)) (<= (* b 1218) c) (< (+ a 1219) (- c x)) (<= (* b 1220) c) (< (+ a 1221) (- c x)) (<= (* b 1222) c) (< (+ a 1223) (- c x))
+    (<= (* b 1224) c) (< (+ a 1225) (- c x)) (<= (* b 1226) c) (< (+ a 1227) (- c x)) (<= (* b 1228) c) (< (+ a 1229) (- c x)) (<= (* b 1230) c) (< (+ a 1231) (- c x))
+    (<= (* b 1232) c) (< (+ a 1233) (- c x)) (<= (* b 1234) c) (< (+ a 1235) (- c x)) (<= (* b 1236) c) (< (+ a 1237) (- c x)) (<= (* b 1238) c) (< (+ a 1239) (- c x))
+    (<= (* b 1240) c) (< (+ a 1241) (- c x)) (<= (* b 1242) c) (< (+ a 1243) (- c x)) (<= (* b 1244) c) (< (+ a 1245) (- c x)) (<= (* b 1246) c) (< (+ a 1247) (- c x))
+    (<= (* b 1248) c) (< (+ a 1249) (- c x)) (<= (* b 1250) c) (< (+ a 1251) (- c x)) (<= (* b 1252) c) (< (+ a 1253) (- c x)) (<= (* b 1254) c) (< (+ a 1255) (- c x))
+    (<= (* b 1256) c) (< (+ a 1257) (- c x)) (<= (* b 1258) c) (< (+ a 1259) (- c x)) (<= (* b 1260) c) (< (+ a 1261) (- c x)) (<= (* b 1262) c) (< (+ a 1263) (- c x))
+    (<= (* b 1264) c) (< (+ a 1265) (- c x)) (<= (* b 1266) c) (< (+ a 1267) (- c x)) (<= (* b 1268) c) (< (+ a 1269) (- c x)) (<= (* b 1270) c) (< (+ a 1271) (- c x))
+    (<= (* b 1272) c) (< (+ a 1273) (- c x)) (<= (* b 1274) c) (< (+ a 1275) (- c x)) (<= (* b 1276) c) (< (+ a 1277) (- c x)) (<= (* b 1278) c) (< (+ a 1279) (- c x))
+    (<= (* b 1280) c) (< (+ a 1281) (- c x)) (<= (* b 1282) c) (< (+ a 1283) (- c x)) (<= (* b 1284) c) (< (+ a 1285) (- c x)) (<= (* b 1286) c) (< (+ a 1287) (- c x))
+    (<= (* b 1288) c) (< (+ a 1289) (- c x)) (<= (* b 1290) c) (< (+ a 1291) (- c x)) (<= (* b 1292) c) (< (+ a 1293) (- c x)) (<= (* b 1294) c) (< (+ a 1295) (- c x))
+    (<= (* b 1296) c) (< (+ a 1297) (- c x)) (<= (* b 1298) c) (< (+ a 1299) (- c x)) (<= (* b 1300) c) (< (+ a 1301) (- c x)) (<= (* b 1302) c) (< (+ a 1303) (- c x))
+    (<= (* b 1304) c) (< (+ a 1305) (- c x)) (<= (* b 1306) c) (< (+ a 1307) (- c x)) (<= (* b 1308) c) (< (+ a 1309) (- c x)) (<= (* b 1310) c) (< (+ a 1311) (- c x))
+    (<= (* b 1312) c) (< (+ a 1313) (- c x)) (<= (* b 1314) c) (< (+ a 1315) (- c x)) (<= (* b 1316) c) (< (+ a 1317) (- c x)) (<= (* b 1318) c) (< (+ a 1319) (- c x))
+    (<= (* b 1320) c) (< (+ a 1321) (- c x)) (<= (* b 1322) c) (< (+ a 1323) (- c x)) (<= (* b 1324) c) (< (+ a 1325) (- c x)) (<= (* b 1326) c) (< (+ a 1327) (- c x))
+    (<= (* b 1328) c) (< (+ a 1329) (- c x)) (<= (* b 1330) c) (< (+ a 1331) (- c x)) (<= (* b 1332) c) (< (+ a 1333) (- c x)) (<= (* b 1334) c) (< (+ a 1335) (- c x))
+    (<= (* b 1336) c) (< (+ a 1337) (- c x)) (<= (* b 1338) c) (< (+ a 1339) (- c x)) (<= (* b 1340) c) (< (+ a 1341) (- c x)) (<= (* b 1342) c) (< (+ a 1343) (- c x))
+    (<= (* b 1344) c) (< (+ a 1345) (- c x)) (<= (* b 1346) c) (< (+ a 1347) (- c x)) (<= (* b 1348) c) (< (+ a 1349) (- c x)) (<= (* b 1350) c) (< (+ a 1351) (- c x))
+    (<= (* b 1352) c) (< (+ a 1353) (- c x)) (<= (* b 1354) c) (< (+ a 1355) (- c x)) (<= (* b 1356) c) (< (+ a 1357) (- c x)) (<= (* b 1358) c) (< (+ a 1359) (- c x))
+    (<= (* b 1360) c) (< (+ a 1361) (- c x)) (<= (* b 1362) c) (< (+ a 1363) (- c x)) (<= (* b 1364) c) (< (+ a 1365) (- c x)) (<= (* b 1366) c) (< (+ a 1367) (- c x))
+    (<= (* b 1368) c) (< (+ a 1369) (- c x)) (<= (* b 1370) c) (< (+ a 1371) (- c x)) (<= (* b 1372) c) (< (+ a 1373) (- c x)) (<= (* b 1374) c) (< (+ a 1375) (- c x))
+    (<= (* b 1376) c) (< (+ a 1377) (- c x)) (<= (* b 1378) c) (< (+ a 1379) (- c x)) (<= (* b 1380) c) (< (+ a 1381) (- c x)) (<= (* b 1382) c) (< (+ a 1383) (- c x))
+    (<= (* b 1384) c) (< (+ a 1385) (- c x)) (<= (* b 1386) c) (< (+ a 1387) (- c x)) (<= (* b 1388) c) (< (+ a 1389) (- c x)) (<= (* b 1390) c) (< (+ a 1391) (- c x))
+    (<= (* b 1392) c) (< (+ a 1393) (- c x)) (<= (* b 1394) c) (< (+ a 1395) (- c x)) (<= (* b 1396) c) (< (+ a 1397) (- c x)) (<= (* b 1398) c) (< (+ a 1399) (- c x))
+    (<= (* b 1400) c) (< (+ a 1401) (- c x)) (<= (* b 1402) c) (< (+ a 1403) (- c x)) (<= (* b 1404) c) (< (+ a 1405) (- c x)) (<= (* b 1406) c) (< (+ a 1407) (- c x))
+    (<= (* b 1408) c) (< (+ a 1409) (- c x)) (<= (* b 1410) c) (< (+ a 1411) (- c x)) (<= (* b 1412) c) (< (+ a 1413) (- c x)) (<= (* b 1414) c) (< (+ a 1415) (- c x))
+    (<= (* b 1416) c) (< (+ a 1417) (- c x)) (<= (* b 1418) c) (< (+ a 1419) (- c x)) (<= (* b 1420) c) (< (+ a 1421) (- c x)) (<= (* b 1422) c) (< (+ a 1423) (- c x))
+    (<= (* b 1424) c) (< (+ a 1425) (- c x)) (<= (* b 1426) c) (< (+ a 1427) (- c x)) (<= (* b 1428) c) (< (+ a 1429) (- c x)) (<= (* b 1430) c) (< (+ a 1431) (- c x))
+    (<= (* b 1432) c) (< (+ a 1433) (- c x)) (<= (* b 1434) c) (< (+ a 1435) (- c x)) (<= (* b 1436) c) (< (+ a 1437) (- c x)) (<= (* b 1438) c) (< (+ a 1439) (- c x))
+    (<= (* b 1440) c) (< (+ a 1441) (- c x)) (<= (* b 1442) c) (< (+ a 1443) (- c x)) (<= (* b 1444) c) (< (+ a 1445) (- c x)) (<= (* b 1446) c) (< (+ a 1447) (- c x))
+    (<= (* b 1448) c) (< (+ a 1449) (- c x)) (<= (* b 1450) c) (< (+ a 1451) (- c x)) (<= (* b 1452) c) (< (+ a 1453) (- c x)) (<= (* b 1454) c) (< (+ a 1455) (- c x))
+    (<= (* b 1456) c) (< (+ a 1457) (- c x)) (<= (* b 1458) c) (< (+ a 1459) (- c x)) (<= (* b 1460) c) (< (+ a 1461) (- c x)) (<= (* b 1462) c) (< (+ a 1463) (- c x))
+    (<= (* b 1464) c) (< (+ a 1465) (- c x)) (<= (* b 1466) c) (< (+ a 1467) (- c x)) (<= (* b 1468) c) (< (+ a 1469) (- c x)) (<= (* b 1470) c) (< (+ a 1471) (- c x))
+    (<= (* b 1472) c) (< (+ a 1473) (- c x)) (<= (* b 1474) c) (< (+ a 1475) (- c x)) (<= (* b 1476) c) (< (+ a 1477) (- c x)) (<= (* b 1478) c) (< (+ a 1479) (- c x))
+    (<= (* b 1480) c) (< (+ a 1481) (- c x)) (<= (* b 1482) c) (< (+ a 1483) (- c x)) (<= (* b 1484) c) (< (+ a 1485) (- c x)) (<= (* b 1486) c) (< (+ a 1487) (- c x))
+    (<= (* b 1488) c) (< (+ a 1489) (- c x)) (<= (* b 1490) c) (< (+ a 1491) (- c x)) (<= (* b 1492) c) (< (+ a 1493) (- c x)) (<= (* b 1494) c) (< (+ a 1495) (- c x))
+    (<= (* b 1496) c) (< (+ a 1497) (- c x)) (<= (* b 1498) c) (< (+ a 1499) (- c x)) (<= (* b 1500) c) (< (+ a 1501) (- c x)) (<= (* b 1502) c) (< (+ a 1503) (- c x))
+    (<= (* b 1504) c) (< (+ a 1505) (- c x)) (<= (* b 1506) c) (< (+ a 1507) (- c x)) (<= (* b 1508) c) (< (+ a 1509) (- c x)) (<= (* b 1510) c) (< (+ a 1511) (- c x))
+    (<= (* b 1512) c) (< (+ a 1513) (- c x)) (<= (* b 1514) c) (< (+ a 1515) (- c x)) (<= (* b 1516) c) (< (+ a 1517) (- c x)) (<= (* b 1518) c) (< (+ a 1519) (- c x))
+    (<= (* b 1520) c) (< (+ a 1521) (- c x)) (<= (* b 1522) c) (< (+ a 1523) (- c x)) (<= (* b 1524) c) (< (+ a 1525) (- c x)) (<= (* b 1526) c) (< (+ a 1527) (- c x))
+    (<= (* b 1528) c) (< (+ a 1529) (- c x)) (<= (* b 1530) c) (< (+ a 1531) (- c x)) (<= (* b 1532) c) (< (+ a 1533) (- c x)) (<= (* b 1534) c) (< (+ a 1535) (- c x))
+    (<= (* b 1536) c) (< (+ a 1537) (- c x)) (<= (* b 1538) c) (< (+ a 1539) (- c x)) (<= (* b 1540) c) (< (+ a 1541) (- c x)) (<= (* b 1542) c) (< (+ a 1543) (- c x))
+    (<= (* b 1544) c) (< (+ a 1545) (- c x)) (<= (* b 1546) c) (< (+ a 1547) (- c x)) (<= (* b 1548) c) (< (+ a 1549) (- c x)) (<= (* b 1550) c) (< (+ a 1551) (- c x))
+    (<= (* b 1552) c) (< (+ a 1553) (- c x)) (<= (* b 1554) c) (< (+ a 1555) (- c x)) (<= (* b 1556) c) (< (+ a 1557) (- c x)) (<= (* b 1558) c) (< (+ a 1559) (- c x))
+    (<= (* b 1560) c) (< (+ a 1561) (- c x)) (<= (* b 1562) c) (< (+ a 1563) (- c x)) (<= (* b 1564) c) (< (+ a 1565) (- c x)) (<= (* b 1566) c) (< (+ a 1567) (- c x))
+    (<= (* b 1568) c) (< (+ a 1569) (- c x)) (<= (* b 1570) c) (< (+ a 1571) (- c x)) (<= (* b 1572) c) (< (+ a 1573) (- c x)) (<= (* b 1574) c) (< (+ a 1575) (- c x))
+    (<= (* b 1576) c) (< (+ a 1577) (- c x)) (<= (* b 1578) c) (< (+ a 1579) (- c x)) (<= (* b 1580) c) (< (+ a 1581) (- c x)) (<= (* b 1582) c) (< (+ a 1583) (- c x))
+    (<= (* b 1584) c) (< (+ a 1585) (- c x)) (<= (* b 1586) c) (< (+ a 1587) (- c x)) (<= (* b 1588) c) (< (+ a 1589) (- c x)) (<= (* b 1590) c) (< (+ a 1591) (- c x))
+    (<= (* b 1592) c) (< (+ a 1593) (- c x)) (<= (* b 1594) c) (< (+ a 1595) (- c x)) (<= (* b 1596) c) (< (+ a 1597) (- c x)) (<= (* b 1598) c) (< (+ a 1599) (- c x))
+    (<= (* b 1600) c) (< (+ a 1601) (- c x)) (<= (* b 1602) c) (< (+ a 1603) (- c x)) (<= (* b 1604) c) (< (+ a 1605) (- c x)) (<= (* b 1606) c) (< (+ a 1607) (- c x))
+    (<= (* b 1608) c) (< (+ a 1609) (- c x)) (<= (* b 1610) c) (< (+ a 1611) (- c x)) (<= (* b 1612) c) (< (+ a 1613) (- c x)) (<= (* b 1614) c) (< (+ a 1615) (- c x))
+    (<= (* b 1616) c) (< (+ a 1617) (- c x)) (<= (* b 1618) c) (< (+ a 1619) (- c x)) (<= (* b 1620) c) (< (+ a 1621) (- c x)) (<= (* b 1622) c) (< (+ a 1623) (- c x))
+    (<= (* b 1624) c) (< (+ a 1625) (- c x)) (<= (* b 1626) c) (< (+ a 1627) (- c x)) (<= (* b 1628) c) (< (+ a 1629) (- c x)) (<= (* b 1630) c) (< (+ a 1631) (- c x))
+    (<= (* b 1632) c) (< (+ a 1633) (- c x)) (<= (* b 1634) c) (< (+ a 1635) (- c x)) (<= (* b 1636) c) (< (+ a 1637) (- c x)) (<= (* b 1638) c) (< (+ a 1639) (- c x))
+    (<= (* b 1640) c) (< (+ a 1641) (- c x)) (<= (* b 1642) c) (< (+ a 1643) (- c x)) (<= (* b 1644) c) (< (+ a 1645) (- c x)) (<= (* b 1646) c) (< (+ a 1647) (- c x))
+    (<= (* b 1648) c) (< (+ a 1649) (- c x)) (<= (* b 1650) c) (< (+ a 1651) (- c x)) (<= (* b 1652) c) (< (+ a 1653) (- c x)) (<= (* b 1654) c) (< (+ a 1655) (- c x))
+    (<= (* b 1656) c) (< (+ a 1657) (- c x)) (<= (* b 1658) c) (< (+ a 1659) (- c x)) (<= (* b 1660) c) (< (+ a 1661) (- c x)) (<= (* b 1662) c) (< (+ a 1663) (- c x))
+    (<= (* b 1664) c) (< (+ a 1665) (- c x)) (<= (* b 1666) c) (< (+ a 1667) (- c x)) (<= (* b 1668) c) (< (+ a 1669) (- c x)) (<= (* b 1670) c) (< (+ a 1671) (- c x))
+    (<= (* b 1672) c) (< (+ a 1673) (- c x)) (<= (* b 1674) c) (< (+ a 1675) (- c x)) (<= (* b 1676) c) (< (+ a 1677) (- c x)) (<= (* b 1678) c) (< (+ a 1679) (- c x))
+    (<= (* b 1680) c) (< (+ a 1681) (- c x)) (<= (* b 1682) c) (< (+ a 1683) (- c x)) (<= (* b 1684) c) (< (+ a 1685) (- c x)) (<= (* b 1686) c) (< (+ a 1687) (- c x))
+    (<= (* b 1688) c) (< (+ a 1689) (- c x)) (<= (* b 1690) c) (< (+ a 1691) (- c x)) (<= (* b 1692) c) (< (+ a 1693) (- c x)) (<= (* b 1694) c) (< (+ a 1695) (- c x))
+    (<= (* b 1696) c) (< (+ a 1697) (- c x)) (<= (* b 1698) c) (< (+ a 1699) (- c x)) (<= (* b 1700) c) (< (+ a 1701) (- c x)) (<= (* b 1702) c) (< (+ a 1703) (- c x))
+    (<= (* b 1704) c) (< (+ a 1705) (- c x)) (<= (* b 1706) c) (< (+ a 1707) (- c x)) (<= (* b 1708) c) (< (+ a 1709) (- c x)) (<= (* b 1710) c) (< (+ a 1711) (- c x))
+    (<= (* b 1712) c) (< (+ a 1713) (- c x)) (<= (* b 1714) c) (< (+ a 1715) (- c x)) (<= (* b 1716) c) (< (+ a 1717) (- c x)) (<= (* b 1718) c) (< (+ a 1719) (- c x))
+    (<= (* b 1720) c) (< (+ a 1721) (- c x)) (<= (* b 1722) c) (< (+ a 1723) (- c x)) (<= (* b 1724) c) (< (+ a 1725) (- c x)) (<= (* b 1726) c) (< (+ a 1727) (- c x))
+    (<= (* b 1728) c) (< (+ a 1729) (- c x)) (<= (* b 1730) c) (< (+ a 1731) (- c x)) (<= (* b 1732) c) (< (+ a 1733) (- c x)) (<= (* b 1734) c) (< (+ a 1735) (- c x))
+    (<= (* b 1736) c) (< (+ a 1737) (- c x)) (<= (* b 1738) c) (< (+ a 1739) (- c x)) (<= (* b 1740) c) (< (+ a 1741) (- c x)) (<= (* b 1742) c) (< (+ a 1743) (- c x))
+    (<= (* b 1744) c) (< (+ a 1745) (- c x)) (<= (* b 1746) c) (< (+ a 1747) (- c x)) (<= (* b 1748) c) (< (+ a 1749) (- c x)) (<= (* b 1750) c) (< (+ a 1751) (- c x))
+    (<= (* b 1752) c) (< (+ a 1753) (- c x)) (<= (* b 1754) c) (< (+ a 1755) (- c x)) (<= (* b 1756) c) (< (+ a 1757) (- c x)) (<= (* b 1758) c) (< (+ a 1759) (- c x))
+    (<= (* b 1760) c) (< (+ a 1761) (- c x)) (<= (* b 1762) c) (< (+ a 1763) (- c x)) (<= (* b 1764) c) (< (+ a 1765) (- c x)) (<= (* b 1766) c) (< (+ a 1767) (- c x))
+    (<= (* b 1768) c) (< (+ a 1769) (- c x)) (<= (* b 1770) c) (< (+ a 1771) (- c x)) (<= (* b 1772) c) (< (+ a 1773) (- c x)) (<= (* b 1774) c) (< (+ a 1775) (- c x))
+    (<= (* b 1776) c) (< (+ a 1777) (- c x)) (<= (* b 1778) c) (< (+ a 1779) (- c x)) (<= (* b 1780) c) (< (+ a 1781) (- c x)) (<= (* b 1782) c) (< (+ a 1783) (- c x))
+    (<= (* b 1784) c) (< (+ a 1785) (- c x)) (<= (* b 1786) c) (< (+ a 1787) (- c x)) (<= (* b 1788) c) (< (+ a 1789) (- c x)) (<= (* b 1790) c) (< (+ a 1791) (- c x))
+    (<= (* b 1792) c) (< (+ a 1793) (- c x)) (<= (* b 1794) c) (< (+ a 1795) (- c x)) (<= (* b 1796) c) (< (+ a 1797) (- c x)) (<= (* b 1798) c) (< (+ a 1799) (- c x))
+    (<= (* b 1800) c) (< (+ a 1801) (- c x)) (<= (* b 1802) c) (< (+ a 1803) (- c x)) (<= (* b 1804) c) (< (+ a 1805) (- c x)) (<= (* b 1806) c) (< (+ a 1807) (- c x))
+    (<= (* b 1808) c) (< (+ a 1809) (- c x)) (<= (* b 1810) c) (< (+ a 1811) (- c x)) (<= (* b 1812) c) (< (+ a 1813) (- c x)) (<= (* b 1814) c) (< (+ a 1815) (- c x))
+    (<= (* b 1816) c) (< (+ a 1817) (- c x)) (<= (* b 1818) c) (< (+ a 1819) (- c x)) (<= (* b 1820) c) (< (+ a 1821) (- c x)) (<= (* b 1822) c) (< (+ a 1823) (- c x))
+    (<= (* b 1824) c) (< (+ a 1825) (- c x)) (<= (* b 1826) c) (< (+ a 1827) (- c x)) (<= (* b 1828) c) (< (+ a 1829) (- c x)) (<= (* b 1830) c) (< (+ a 1831) (- c x))
+    (<= (* b 1832) c) (< (+ a 1833) (- c x)) (<= (* b 1834) c) (< (+ a 1835) (- c x)) (<= (* b 1836) c) (< (+ a 1837) (- c x)) (<= (* b 1838) c) (< (+ a 1839) (- c x))
+    (<= (* b 1840) c) (< (+ a 1841) (- c x)) (<= (* b 1842) c) (< (+ a 1843) (- c x)) (<= (* b 1844) c) (< (+ a 1845) (- c x)) (<= (* b 1846) c) (< (+ a 1847) (- c x))
+    (<= (* b 1848) c) (< (+ a 1849) (- c x)) (<= (* b 1850) c) (< (+ a 1851) (- c x)) (<= (* b 1852) c) (< (+ a 1853) (- c x)) (<= (* b 1854) c) (< (+ a 1855) (- c x))
+    (<= (* b 1856) c) (< (+ a 1857) (- c x)) (<= (* b 1858) c) (< (+ a 1859) (- c x)) (<= (* b 1860) c) (< (+ a 1861) (- c x)) (<= (* b 1862) c) (< (+ a 1863) (- c x))
+    (<= (* b 1864) c) (< (+ a 1865) (- c x)) (<= (* b 1866) c) (< (+ a 1867) (- c x)) (<= (* b 1868) c) (< (+ a 1869) (- c x)) (<= (* b 1870) c) (< (+ a 1871) (- c x))
+    (<= (* b 1872) c) (< (+ a 1873) (- c x)) (<= (* b 1874) c) (< (+ a 1875) (- c x)) (<= (* b 1876) c) (< (+ a 1877) (- c x)) (<= (* b 1878) c) (< (+ a 1879) (- c x))
+    (<= (* b 1880) c) (< (+ a 1881) (- c x)) (<= (* b 1882) c) (< (+ a 1883) (- c x)) (<= (* b 1884) c) (< (+ a 1885) (- c x)) (<= (* b 1886) c) (< (+ a 1887) (- c x))
+    (<= (* b 1888) c) (< (+ a 1889) (- c x)) (<= (* b 1890) c) (< (+ a 1891) (- c x)) (<= (* b 1892) c) (< (+ a 1893) (- c x)) (<= (* b 1894) c) (< (+ a 1895) (- c x))
+    (<= (* b 1896) c) (< (+ a 1897) (- c x)) (<= (* b 1898) c) (< (+ a 1899) (- c x)) (<= (* b 1900) c) (< (+ a 1901) (- c x)) (<= (* b 1902) c) (< (+ a 1903) (- c x))
+    (<= (* b 1904) c) (< (+ a 1905) (- c x)) (<= (* b 1906) c) (< (+ a 1907) (- c x)) (<= (* b 1908) c) (< (+ a 1909) (- c x)) (<= (* b 1910) c) (< (+ a 1911) (- c x))
+    (<= (* b 1912) c) (< (+ a 1913) (- c x)) (<= (* b 1914) c) (< (+ a 1915) (- c x)) (<= (* b 1916) c) (< (+ a 1917) (- c x)) (<= (* b 1918) c) (< (+ a 1919) (- c x))
+    (<= (* b 1920) c) (< (+ a 1921) (- c x)) (<= (* b 1922) c) (< (+ a 1923) (- c x)) (<= (* b 1924) c) (< (+ a 1925) (- c x)) (<= (* b 1926) c) (< (+ a 1927) (- c x))
+    (<= (* b 1928) c) (< (+ a 1929) (- c x)) (<= (* b 1930) c) (< (+ a 1931) (- c x)) (<= (* b 1932) c) (< (+ a 1933) (- c x)) (<= (* b 1934) c) (< (+ a 1935) (- c x))
+    (<= (* b 1936) c) (< (+ a 1937) (- c x)) (<= (* b 1938) c) (< (+ a 1939) (- c x)) (<= (* b 1940) c) (< (+ a 1941) (- c x)) (<= (* b 1942) c) (< (+ a 1943) (- c x))
+    (<= (* b 1944) c) (< (+ a 1945) (- c x)) (<= (* b 1946) c) (< (+ a 1947) (- c x)) (<= (* b 1948) c) (< (+ a 1949) (- c x)) (<= (* b 1950) c) (< (+ a 1951) (- c x))
+    (<= (* b 1952) c) (< (+ a 1953) (- c x)) (<= (* b 1954) c) (< (+ a 1955) (- c x)) (<= (* b 1956) c) (< (+ a 1957) (- c x)) (<= (* b 1958) c) (< (+ a 1959) (- c x))
+    (<= (* b 1960) c) (< (+ a 1961) (- c x)) (<= (* b 1962) c) (< (+ a 1963) (- c x)) (<= (* b 1964) c) (< (+ a 1965) (- c x)) (<= (* b 1966) c) (< (+ a 1967) (- c x))
+    (<= (* b 1968) c) (< (+ a 1969) (- c x)) (<= (* b 1970) c) (< (+ a 1971) (- c x)) (<= (* b 1972) c) (< (+ a 1973) (- c x)) (<= (* b 1974) c) (< (+ a 1975) (- c x))
+    (<= (* b 1976) c) (< (+ a 1977) (- c x)) (<= (* b 1978) c) (< (+ a 1979) (- c x)) (<= (* b 1980) c) (< (+ a 1981) (- c x)) (<= (* b 1982) c) (< (+ a 1983) (- c x))
+    (<= (* b 1984) c) (< (+ a 1985) (- c x)) (<= (* b 1986) c) (< (+ a 1987) (- c x)) (<= (* b 1988) c) (< (+ a 1989) (- c x)) (<= (* b 1990) c) (< (+ a 1991) (- c x))
+    (<= (* b 1992) c) (< (+ a 1993) (- c x)) (<= (* b 1994) c) (< (+ a 1995) (- c x)) (<= (* b 1996) c) (< (+ a 1997) (- c x)) (<= (* b 1998) c) (< (+ a 1999) (- c x))
+))))
+(assert (forall ((a Int) (b Bool)) (and
+    (=> b (> a 0)) (=> b (> a 1)) (=> b (> a 2)) (=> b (> a 3)) (=> b (> a 4)) (=> b (> a 5)) (=> b (> a 6)) (=> b (> a 7))
+    (=> b (> a 8)) (=> b (> a 9)) (=> b (> a 10)) (=> b (> a 11)) (=> b (> a 12)) (=> b (> a 13)) (=> b (> a 14)) (=> b (> a 15))
+    (=> b (> a 16)) (=> b (> a 17)) (=> b (> a 18)) (=> b (> a 19)) (=> b (> a 20)) (=> b (> a 21)) (=> b (> a 22)) (=> b (> a 23))
+    (=> b (> a 24)) (=> b (> a 25)) (=> b (> a 26)) (=> b (> a 27)) (=> b (> a 28)) (=> b (> a 29)) (=> b (> a 30)) (=> b (> a 31))
+    (=> b (> a 32)) (=> b (> a 33)) (=> b (> a 34)) (=> b (> a 35)) (=> b (> a 36)) (=> b (> a 37)) (=> b (> a 38)) (=> b (> a 39))
+    (=> b (> a 40)) (=> b (> a 41)) (=> b (> a 42)) (=> b (> a 43)) (=> b (> a 44)) (=> b (> a 45)) (=> b (> a 46)) (=> b (> a 47))
+    (=> b (> a 48)) (=> b (> a 49)) (=> b (> a 50)) (=> b (> a 51)) (=> b (> a 52)) (=> b (> a 53)) (=> b (> a 54)) (=> b (> a 55))
+    (=> b (> a 56)) (=> b (> a 57)) (=> b (> a 58)) (=> b (> a 59)) (=> b (> a 60)) (=> b (> a 61)) (=> b (> a 62)) (=> b (> a 63))
+    (=> b (> a 64)) (=> b (> a 65)) (=> b (> a 66)) (=> b (> a 67)) (=> b (> a 68)) (=> b (> a 69)) (=> b (> a 70)) (=> b (> a 71))
+    (=> b (> a 72)) (=> b (> a 73)) (=> b (> a 74)) (=> b (> a 75)) (=> b (> a 76)) (=> b (> a 77)) (=> b (> a 78)) (=> b (> a 79))
+    (=> b (> a 80)) (=> b (> a 81)) (=> b (> a 82)) (=> b (> a 83)) (=> b (> a 84)) (=> b (> a 85)) (=> b (> a 86)) (=> b (> a 87))
+    (=> b (> a 88)) (=> b (> a 89)) (=> b (> a 90)) (=> b (> a 91)) (=> b (> a 92)) (=> b (> a 93)) (=> b (> a 94)) (=> b (> a 95))
+    (=> b (> a 96)) (=> b (> a 97)) (=> b (> a 98)) (=> b (> a 99)) (=> b (> a 100)) (=> b (> a 101)) (=> b (> a 102)) (=> b (> a 103))
+    (=> b (> a 104)) (=> b (> a 105)) (=> b (> a 106)) (=> b (> a 107)) (=> b (> a 108)) (=> b (> a 109)) (=> b (> a 110)) (=> b (> a 111))
+    (=> b (> a 112)) (=> b (> a 113)) (=> b (> a 114)) (=> b (> a 115)) (=> b (> a 116)) (=> b (> a 117)) (=> b (> a 118)) (=> b (> a 119))
+    (=> b (> a 120)) (=> b (> a 121)) (=> b (> a 122)) (=> b (> a 123)) (=> b (> a 124)) (=> b (> a 125)) (=> b (> a 126)) (=> b (> a 127))
+    (=> b (> a 128)) (=> b (> a 129)) (=> b (> a 130)) (=> b (> a 131)) (=> b (> a 132)) (=> b (> a 133)) (=> b (> a 134)) (=> b (> a 135))
+    (=> b (> a 136)) (=> b (> a 137)) (=> b (> a 138)) (=> b (> a 139)) (=> b (> a 140)) (=> b (> a 141)) (=> b (> a 142)) (=> b (> a 143))
+    (=> b (> a 144)) (=> b (> a 145)) (=> b (> a 146)) (=> b (> a 147)) (=> b (> a 148)) (=> b (> a 149)) (=> b (> a 150)) (=> b (> a 151))
+    (=> b (> a 152)) (=> b (> a 153)) (=> b (> a 154)) (=> b (> a 155)) (=> b (> a 156)) (=> b (> a 157)) (=> b (> a 158)) (=> b (> a 159))
+    (=> b (> a 160)) (=> b (> a 161)) (=> b (> a 162)) (=> b (> a 163)) (=> b (> a 164)) (=> b (> a 165)) (=> b (> a 166)) (=> b (> a 167))
+    (=> b (> a 168)) (=> b (> a 169)) (=> b (> a 170)) (=> b (> a 171)) (=> b (> a 172)) (=> b (> a 173)) (=> b (> a 174)) (=> b (> a 175))
+    (=> b (> a 176)) (=> b (> a 177)) (=> b (> a 178)) (=> b (> a 179)) (=> b (> a 180)) (=> b (> a 181)) (=> b (> a 182)) (=> b (> a 183))
+    (=> b (> a 184)) (=> b (> a 185)) (=> b (> a 186)) (=> b (> a 187)) (=> b (> a 188)) (=> b (> a 189)) (=> b (> a 190)) (=> b (> a 191))
+    (=> b (> a 192)) (=> b (> a 193)) (=> b (> a 194)) (=> b (> a 195)) (=> b (> a 196)) (=> b (> a 197)) (=> b (> a 198)) (=> b (> a 199))
+    (=> b (> a 200)) (=> b (> a 201)) (=> b (> a 202)) (=> b (> a 203)) (=> b (> a 204)) (=> b (> a 205)) (=> b (> a 206)) (=> b (> a 207))
+    (=> b (> a 208)) (=> b (> a 209)) (=> b (> a 210)) (=> b (> a 211)) (=> b (> a 212)) (=> b (> a 213)) (=> b (> a 214)) (=> b (> a 215))
+    (=> b (> a 216)) (=> b (> a 217)) (=> b (> a 218)) (=> b (> a 219)) (=> b (> a 220)) (=> b (> a 221)) (=> b (> a 222)) (=> b (> a 223))
+    (=> b (> a 224)) (=> b (> a 225)) (=> b (> a 226)) (=> b (> a 227)) (=> b (> a 228)) (=> b (> a 229)) (=> b (> a 230)) (=> b (> a 231))
+    (=> b (> a 232)) (=> b (> a 233)) (=> b (> a 234)) (=> b (> a 235)) (=> b (> a 236)) (=> b (> a 237)) (=> b (> a 238)) (=> b (> a 239))
+    (=> b (> a 240)) (=> b (> a 241)) (=> b (> a 242)) (=> b (> a 243)) (=> b (> a 244)) (=> b (> a 245)) (=> b (> a 246)) (=> b (> a 247))
+    (=> b (> a 248)) (=> b (> a 249)) (=> b (> a 250)) (=> b (> a 251)) (=> b (> a 252)) (=> b (> a 253)) (=> b (> a 254)) (=> b (> a 255))
+    (=> b (> a 256)) (=> b (> a 257)) (=> b (> a 258)) (=> b (> a 259)) (=> b (> a 260)) (=> b (> a 261)) (=> b (> a 262)) (=> b (> a 263))
+    (=> b (> a 264)) (=> b (> a 265)) (=> b (> a 266)) (=> b (> a 267)) (=> b (> a 268)) (=> b (> a 269)) (=> b (> a 270)) (=> b (> a 271))
+    (=> b (> a 272)) (=> b (> a 273)) (=> b (> a 274)) (=> b (> a 275)) (=> b (> a 276)) (=> b (> a 277)) (=> b (> a 278)) (=> b (> a 279))
+    (=> b (> a 280)) (=> b (> a 281)) (=> b (> a 282)) (=> b (> a 283)) (=> b (> a 284)) (=> b (> a 285)) (=> b (> a 286)) (=> b (> a 287))
+    (=> b (> a 288)) (=> b (> a 289)) (=> b (> a 290)) (=> b (> a 291)) (=> b (> a 292)) (=> b (> a 293)) (=> b (> a 294)) (=> b (> a 295))
+    (=> b (> a 296)) (=> b (> a 297)) (=> b (> a 298)) (=> b (> a 299)) (=> b (> a 300)) (=> b (> a 301)) (=> b (> a 302)) (=> b (> a 303))
+    (=> b (> a 304)) (=> b (> a 305)) (=> b (> a 306)) (=> b (> a 307)) (=> b (> a 308)) (=> b (> a 309)) (=> b (> a 310)) (=> b (> a 311))
+    (=> b (> a 312)) (=> b (> a 313)) (=> b (> a 314)) (=> b (> a 315)) (=> b (> a 316)) (=> b (> a 317)) (=> b (> a 318)) (=> b (> a 319))
+    (=> b (> a 320)) (=> b (> a 321)) (=> b (> a 322)) (=> b (> a 323)) (=> b (> a 324)) (=> b (> a 325)) (=> b (> a 326)) (=> b (> a 327))
+    (=> b (> a 328)) (=> b (> a 329)) (=> b (> a 330)) (=> b (> a 331)) (=> b (> a 332)) (=> b (> a 333)) (=> b (> a 334)) (=> b (> a 335))
+    (=> b (> a 336)) (=> b (> a 337)) (=> b (> a 338)) (=> b (> a 339)) (=> b (> a 340)) (=> b (> a 341)) (=> b (> a 342)) (=> b (> a 343))
+    (=> b (> a 344)) (=> b (> a 345)) (=> b (> a 346)) (=> b (> a 347)) (=> b (> a 348)) (=> b (> a 349)) (=> b (> a 350)) (=> b (> a 351))
+    (=> b (> a 352)) (=> b (> a 353)) (=> b (> a 354)) (=> b (> a 355)) (=> b (> a 356)) (=> b (> a 357)) (=> b (> a 358)) (=> b (> a 359))
+    (=> b (> a 360)) (=> b (> a 361)) (=> b (> a 362)) (=> b (> a 363)) (=> b (> a 364)) (=> b (> a 365)) (=> b (> a 366)) (=> b (> a 367))
+    (=> b (> a 368)) (=> b (> a 369)) (=> b (> a 370)) (=> b (> a 371)) (=> b (> a 372)) (=> b (> a 373)) (=> b (> a 374)) (=> b (> a 375))
+    (=> b (> a 376)) (=> b (> a 377)) (=> b (> a 378)) (=> b (> a 379)) (=> b (> a 380)) (=> b (> a 381)) (=> b (> a 382)) (=> b (> a 383))
+    (=> b (> a 384)) (=> b (> a 385)) (=> b (> a 386)) (=> b (> a 387)) (=> b (> a 388)) (=> b (> a 389)) (=> b (> a 390)) (=> b (> a 391))
+    (=> b (> a 392)) (=> b (> a 393)) (=> b (> a 394)) (=> b (> a 395)) (=> b (> a 396)) (=> b (> a 397)) (=> b (> a 398)) (=> b (> a 399))
+    (=> b (> a 400)) (=> b (> a 401)) (=> b (> a 402)) (=> b (> a 403)) (=> b (> a 404)) (=> b (> a 405)) (=> b (> a 406)) (=> b (> a 407))
+    (=> b (> a 408)) (=> b (> a 409)) (=> b (> a 410)) (=> b (> a 411)) (=> b (> a 412)) (=> b (> a 413)) (=> b (> a 414)) (=> b (> a 415))
+    (=> b (> a 416)) (=> b (> a 417)) (=> b (> a 418)) (=> b (> a 419)) (=> b (> a 420)) (=> b (> a 421)) (=> b (> a 422)) (=> b (> a 423))
+    (=> b (> a 424)) (=> b (> a 425)) (=> b (> a 426)) (=> b (> a 427)) (=> b (> a 428)) (=> b (> a 429)) (=> b (> a 430)) (=> b (> a 431))
+    (=> b (> a 432)) (=> b (> a 433)) (=> b (> a 434)) (=> b (> a 435)) (=> b (> a 436)) (=> b (> a 437)) (=> b (> a 438)) (=> b (> a 439))
+    (=> b (> a 440)) (=> b (> a 441)) (=> b (> a 442)) (=> b (> a 443)) (=> b (> a 444)) (=> b (> a 445)) (=> b (> a 446)) (=> b (> a 447))
+    (=> b (> a 448)) (=> b (> a 449)) (=> b (> a 450)) (=> b (> a 451)) (=> b (> a 452)) (=> b (> a 453)) (=> b (> a 454)) (=> b (> a 455))
+    (=> b (> a 456)) (=> b (> a 457)) (=> b (> a 458)) (=> b (> a 459)) (=> b (> a 460)) (=> b (> a 461)) (=> b (> a 462)) (=> b (> a 463))
+    (=> b (> a 464)) (=> b (> a 465)) (=> b (> a 466)) (=> b (> a 467)) (=> b (> a 468)) (=> b (> a 469)) (=> b (> a 470)) (=> b (> a 471))
+    (=> b (> a 472)) (=> b (> a 473)) (=> b (> a 474)) (=> b (> a 475)) (=> b (> a 476)) (=> b (> a 477)) (=> b (> a 478)) (=> b (> a 479))
+    (=> b (> a 480)) (=> b (> a 481)) (=> b (> a 482)) (=> b (> a 483)) (=> b (> a 484)) (=> b (> a 485)) (=> b (> a 486)) (=> b (> a 487))
+    (=> b (> a 488)) (=> b (> a 489)) (=> b (> a 490)) (=> b (> a 491)) (=> b (> a 492)) (=> b (> a 493)) (=> b (> a 494)) (=> b (> a 495))
+    (=> b (> a 496)) (=> b (> a 497)) (=> b (> a 498)) (=> b (> a 499)) (=> b (> a 500)) (=> b (> a 501)) (=> b (> a 502)) (=> b (> a 503))
+    (=> b (> a 504)) (=> b (> a 505)) (=> b (> a 506)) (=> b (> a 507)) (=> b (> a 508)) (=> b (> a 509)) (=> b (> a 510)) (=> b (> a 511))
+    (=> b (> a 512)) (=> b (> a 513)) (=> b (> a 514)) (=> b (> a 515)) (=> b (> a 516)) (=> b (> a 517)) (=> b (> a 518)) (=> b (> a 519))
+    (=> b (> a 520)) (=> b (> a 521)) (=> b (> a 522)) (=> b (> a 523)) (=> b (> a 524)) (=> b (> a 525)) (=> b (> a 526)) (=> b (> a 527))
+    (=> b (> a 528)) (=> b (> a 529)) (=> b (> a 530)) (=> b (> a 531)) (=> b (> a 532)) (=> b (> a 533)) (=> b (> a 534)) (=> b (> a 535))
+    (=> b (> a 536)) (=> b (> a 537)) (=> b (> a 538)) (=> b (> a 539)) (=> b (> a 540)) (=> b (> a 541)) (=> b (> a 542)) (=> b (> a 543))
+    (=> b (> a 544)) (=> b (> a 545)) (=> b (> a 546)) (=> b (> a 547)) (=> b (> a 548)) (=> b (> a 549)) (=> b (> a 550)) (=> b (> a 551))
+    (=> b (> a 552)) (=> b (> a 553)) (=> b (> a 554)) (=> b (> a 555)) (=> b (> a 556)) (=> b (> a 557)) (=> b (> a 558)) (=> b (> a 559))
+    (=> b (> a 560)) (=> b (> a 561)) (=> b (> a 562)) (=> b (> a 563)) (=> b (> a 564)) (=> b (> a 565)) (=> b (> a 566)) (=> b (> a 567))
+    (=> b (> a 568)) (=> b (> a 569)) (=> b (> a 570)) (=> b (> a 571)) (=> b (> a 572)) (=> b (> a 573)) (=> b (> a 574)) (=> b (> a 575))
+    (=> b (> a 576)) (=> b (> a 577)) (=> b (> a 578)) (=> b (> a 579)) (=> b (> a 580)) (=> b (> a 581)) (=> b (> a 582)) (=> b (> a 583))
+    (=> b (> a 584)) (=> b (> a 585)) (=> b (> a 586)) (=> b (> a 587)) (=> b (> a 588)) (=> b (> a 589)) (=> b (> a 590)) (=> b (> a 591))
+    (=> b (> a 592)) (=> b (> a 593)) (=> b (> a 594)) (=> b (> a 595)) (=> b (> a 596)) (=> b (> a 597)) (=> b (> a 598)) (=> b (> a 599))
+    (=> b (> a 600)) (=> b (> a 601)) (=> b (> a 602)) (=> b (> a 603)) (=> b (> a 604)) (=> b (> a 605)) (=> b (> a 606)) (=> b (> a 607))
+    (=> b (> a 608)) (=> b (> a 609)) (=> b (> a 610)) (=> b (> a 611)) (=> b (> a 612)) (=> b (> a 613)) (=> b (> a 614)) (=> b (> a 615))
+    (=> b (> a 616)) (=> b (> a 617)) (=> b (> a 618)) (=> b (> a 619)) (=> b (> a 620)) (=> b (> a 621)) (=> b (> a 622)) (=> b (> a 623))
+    (=> b (> a 624)) (=> b (> a 625)) (=> b (> a 626)) (=> b (> a 627)) (=> b (> a 628)) (=> b (> a 629)) (=> b (> a 630)) (=> b (> a 631))
+    (=> b (> a 632)) (=> b (> a 633)) (=> b (> a 634)) (=> b (> a 635)) (=> b (> a 636)) (=> b (> a 637)) (=> b (> a 638)) (=> b (> a 639))
+    (=> b (> a 640)) (=> b (> a 641)) (=> b (> a 642)) (=> b (> a 643)) (=> b (> a 644)) (=> b (> a 645)) (=> b (> a 646)) (=> b (> a 647))
+    (=> b (> a 648)) (=> b (> a 649)) (=> b (> a 650)) (=> b (> a 651)) (=> b (> a 652)) (=> b (> a 653)) (=> b (> a 654)) (=> b (> a 655))
+    (=> b (> a 656)) (=> b (> a 657)) (=> b (> a 658)) (=> b (> a 659)) (=> b (> a 660)) (=> b (> a 661)) (=> b (> a 662)) (=> b (> a 663))
+    (=> b (> a 664)) (=> b (> a 665)) (=> b (> a 666)) (=> b (> a 667)) (=> b (> a 668)) (=> b (> a 669)) (=> b (> a 670)) (=> b (> a 671))
+    (=> b (> a 672)) (=> b (> a 673)) (=> b (> a 674)) (=> b (> a 675)) (=> b (> a 676)) (=> b (> a 677)) (=> b (> a 678)) (=> b (> a 679))
+    (=> b (> a 680)) (=> b (> a 681)) (=> b (> a 682)) (=> b (> a 683)) (=> b (> a 684)) (=> b (> a 685)) (=> b (> a 686)) (=> b (> a 687))
+    (=> b (> a 688)) (=> b (> a 689)) (=> b (> a 690)) (=> b (> a 691)) (=> b (> a 692)) (=> b (> a 693)) (=> b (> a 694)) (=> b (> a 695))
+    (=> b (> a 696)) (=> b (> a 697)) (=> b (> a 698)) (=> b (> a 699)) (=> b (> a 700)) (=> b (> a 701)) (=> b (> a 702)) (=> b (> a 703))
+    (=> b (> a 704)) (=> b (> a 705)) (=> b (> a 706)) (=> b (> a 707)) (=> b (> a 708)) (=> b (> a 709)) (=> b (> a 710)) (=> b (> a 711))
+    (=> b (> a 712)) (=> b (> a 713)) (=> b (> a 714)) (=> b (> a 715)) (=> b (> a 716)) (=> b (> a 717)) (=> b (> a 718)) (=> b (> a 719))
+    (=> b (> a 720)) (=> b (> a 721)) (=> b (> a 722)) (=> b (> a 723)) (=> b (> a 724)) (=> b (> a 725)) (=> b (> a 726)) (=> b (> a 727))
+    (=> b (> a 728)) (=> b (> a 729)) (=> b (> a 730)) (=> b (> a 731)) (=> b (> a 732)) (=> b (> a 733)) (=> b (> a 734)) (=> b (> a 735))
+    (=> b (> a 736)) (=> b (> a 737)) (=> b (> a 738)) (=> b (> a 739)) (=> b (> a 740)) (=> b (> a 741)) (=> b (> a 742)) (=> b (> a 743))
+    (=> b (> a 744)) (=> b (> a 745)) (=> b (> a 746)) (=> b (> a 747)) (=> b (> a 748)) (=> b (> a 749)) (=> b (> a 750)) (=> b (> a 751))
+    (=> b (> a 752)) (=> b (> a 753)) (=> b (> a 754)) (=> b (> a 755)) (=> b (> a 756)) (=> b (> a 757)) (=> b (> a 758)) (=> b (> a 759))
+    (=> b (> a 760)) (=> b (> a 761)) (=> b (> a 762)) (=> b (> a 763)) (=> b (> a 764)) (=> b (> a 765)) (=> b (> a 766)) (=> b (> a 767))
+    (=> b (> a 768)) (=> b (> a 769)) (=> b (> a 770)) (=> b (> a 771)) (=> b (> a 772)) (=> b (> a 773)) (=> b (> a 774)) (=> b (> a 775))
+    (=> b (> a 776)) (=> b (> a 777)) (=> b (> a 778)) (=> b (> a 779)) (=> b (> a 780)) (=> b (> a 781)) (=> b (> a 782)) (=> b (> a 783))
+    (=> b (> a 784)) (=> b (> a 785)) (=> b (> a 786)) (=> b (> a 787)) (=> b (> a 788)) (=> b (> a 789)) (=> b (> a 790)) (=> b (> a 791))
+    (=> b (> a 792)) (=> b (> a 793)) (=> b (> a 794)) (=> b (> a 795)) (=> b (> a 796)) (=> b (> a 797)) (=> b (> a 798)) (=> b (> a 799))
+    (=> b (> a 800)) (=> b (> a 801)) (=> b (> a 802)) (=> b (> a 803)) (=> b (> a 804)) (=> b (> a 805)) (=> b (> a 806)) (=> b (> a 807))
+    (=> b (> a 808)) (=> b (> a 809)) (=> b (> a 810)) (=> b (> a 811)) (=> b (> a 812)) (=> b (> a 813)) (=> b (> a 814)) (=> b (> a 815))
+    (=> b (> a 816)) (=> b (> a 817)) (=> b (> a 818)) (=> b (> a 819)) (=> b (> a 820)) (=> b (> a 821)) (=> b (> a 822)) (=> b (> a 823))
+    (=> b (> a 824)) (=> b (> a 825)) (=> b (> a 826)) (=> b (> a 827)) (=> b (> a 828)) (=> b (> a 829)) (=> b (> a 830)) (=> b (> a 831))
+    (=> b (> a 832)) (=> b (> a 833)) (=> b (> a 834)) (=> b (> a 835)) (=> b (> a 836)) (=> b (> a 837)) (=> b (> a 838)) (=> b (> a 839))
+    (=> b (> a 840)) (=> b (> a 841)) (=> b (> a 842)) (=> b (> a 843)) (=> b (> a 844)) (=> b (> a 845)) (=> b (> a 846)) (=> b (> a 847))
+    (=> b (> a 848)) (=> b (> a 849)) (=> b (> a 850)) (=> b (> a 851)) (=> b (> a 852)) (=> b (> a 853)) (=> b (> a 854)) (=> b (> a 855))
+    (=> b (> a 856)) (=> b (> a 857)) (=> b (> a 858)) (=> b (> a 859)) (=> b (> a 860)) (=> b (> a 861)) (=> b (> a 862)) (=> b (> a 863))
+    (=> b (> a 864)) (=> b (> a 865)) (=> b (> a 866)) (=> b (> a 867)) (=> b (> a 868)) (=> b (> a 869)) (=> b (> a 870)) (=> b (> a 871))
+    (=> b (> a 872)) (=> b (> a 873)) (=> b (> a 874)) (=> b (> a 875)) (=> b (> a 876)) (=> b (> a 877)) (=> b (> a 878)) (=> b (> a 879))
+    (=> b (> a 880)) (=> b (> a 881)) (=> b (> a 882)) (=> b (> a 883)) (=> b (> a 884)) (=> b (> a 885)) (=> b (> a 886)) (=> b (> a 887))
+    (=> b (> a 888)) (=> b (> a 889)) (=> b (> a 890)) (=> b (> a 891)) (=> b (> a 892)) (=> b (> a 893)) (=> b (> a 894)) (=> b (> a 895))
+    (=> b (> a 896)) (=> b (> a 897)) (=> b (> a 898)) (=> b (> a 899)) (=> b (> a 900)) (=> b (> a 901)) (=> b (> a 902)) (=> b (> a 903))
+    (=> b (> a 904)) (=> b (> a 905)) (=> b (> a 906)) (=> b (> a 907)) (=> b (> a 908)) (=> b (> a 909)) (=> b (> a 910)) (=> b (> a 911))
+    (=> b (> a 912)) (=> b (> a 913)) (=> b (> a 914)) (=> b (> a 915)) (=> b (> a 916)) (=> b (> a 917)) (=> b (> a 918)) (=> b (> a 919))
+    (=> b (> a 920)) (=> b (> a 921)) (=> b (> a 922)) (=> b (> a 923)) (=> b (> a 924)) (=> b (> a 925)) (=> b (> a 926)) (=> b (> a 927))
+    (=> b (> a 928)) (=> b (> a 929)) (=> b (> a 930)) (=> b (> a 931)) (=> b (> a 932)) (=> b (> a 933)) (=> b (> a 934)) (=> b (> a 935))
+    (=> b (> a 936)) (=> b (> a 937)) (=> b (> a 938)) (=> b (> a 939)) (=> b (> a 940)) (=> b (> a 941)) (=> b (> a 942)) (=> b (> a 943))
+    (=> b (> a 944)) (=> b (> a 945)) (=> b (> a 946)) (=> b (> a 947)) (=> b (> a 948)) (=> b (> a 949)) (=> b (> a 950)) (=> b (> a 951))
+    (=> b (> a 952)) (=> b (> a 953)) (=> b (> a 954)) (=> b (> a 955)) (=> b (> a 956)) (=> b (> a 957)) (=> b (> a 958)) (=> b (> a 959))
+    (=> b (> a 960)) (=> b (> a 961)) (=> b (> a 962)) (=> b (> a 963)) (=> b (> a 964)) (=> b (> a 965)) (=> b (> a 966)) (=> b (> a 967))
+    (=> b (> a 968)) (=> b (> a 969)) (=> b (> a 970)) (=> b (> a 971)) (=> b (> a 972)) (=> b (> a 973)) (=> b (> a 974)) (=> b (> a 975))
+    (=> b (> a 976)) (=> b (> a 977)) (=> b (> a 978)) (=> b (> a 979)) (=> b (> a 980)) (=> b (> a 981)) (=> b (> a 982)) (=> b (> a 983))
+    (=> b (> a 984)) (=> b (> a 985)) (=> b (> a 986)) (=> b (> a 987)) (=> b (> a 988)) (=> b (> a 989)) (=> b (> a 990)) (=> b (> a 991))
+    (=> b (> a 992)) (=> b (> a 993)) (=> b (> a 994)) (=> b (> a 995)) (=> b (> a 996)) (=> b (> a 997)) (=> b (> a 998)) (=> b (> a 999))
+    (=> b (> a 1000)) (=> b (> a 1001)) (=> b (> a 1002)) (=> b (> a 1003)) (=> b (> a 1004)) (=> b (> a 1005)) (=> b (> a 1006)) (=> b (> a 1007))
+    (=> b (> a 1008)) (=> b (> a 1009)) (=> b (> a 1010)) (=> b (> a 1011)) (=> b (> a 1012)) (=> b (> a 1013)) (=> b (> a 1014)) (=> b (> a 1015))
+    (=> b (> a 1016)) (=> b (> a 1017)) (=> b (> a 1018)) (=> b (> a 1019)) (=> b (> a 1020)) (=> b (> a 1021)) (=> b (> a 1022)) (=> b (> a 1023))
+    (=> b (> a 1024)) (=> b (> a 1025)) (=> b (> a 1026)) (=> b (> a 1027)) (=> b (> a 1028)) (=> b (> a 1029)) (=> b (> a 1030)) (=> b (> a 1031))
+    (=> b (> a 1032)) (=> b (> a 1033)) (=> b (> a 1034)) (=> b (> a 1035)) (=> b (> a 1036)) (=> b (> a 1037)) (=> b (> a 1038)) (=> b (> a 1039))
+    (=> b (> a 1040)) (=> b (> a 1041)) (=> b (> a 1042)) (=> b (> a 1043)) (=> b (> a 1044)) (=> b (> a 1045)) (=> b (> a 1046)) (=> b (> a 1047))
+    (=> b (> a 1048)) (=> b (> a 1049)) (=> b (> a 1050)) (=> b (> a 1051)) (=> b (> a 1052)) (=> b (> a 1053)) (=> b (> a 1054)) (=> b (> a 1055))
+    (=> b (> a 1056)) (=> b (> a 1057)) (=> b (> a 1058)) (=> b (> a 1059)) (=> b (> a 1060)) (=> b (> a 1061)) (=> b (> a 1062)) (=> b (> a 1063))
+    (=> b (> a 1064)) (=> b (> a 1065)) (=> b (> a 1066)) (=> b (> a 1067)) (=> b (> a 1068)) (=> b (> a 1069)) (=> b (> a 1070)) (=> b (> a 1071))
+    (=> b (> a 1072)) (=> b (> a 1073)) (=> b (> a 1074)) (=> b (> a 1075)) (=> b (> a 1076)) (=> b (> a 1077)) (=> b (> a 1078)) (=> b (> a 1079))
+    (=> b (> a 1080)) (=> b (> a 1081)) (=> b (> a 1082)) (=> b (> a 1083)) (=> b (> a 1084)) (=> b (> a 1085)) (=> b (> a 1086)) (=> b (> a 1087))
+    (=> b (> a 1088)) (=> b (> a 1089)) (=> b (> a 1090)) (=> b (> a 1091)) (=> b (> a 1092)) (=> b (> a 1093)) (=> b (> a 1094)) (=> b (> a 1095))
+    (=> b (> a 1096)) (=> b (> a 1097)) (=> b (> a 1098)) (=> b (> a 1099)) (=> b (> a 1100)) (=> b (> a 1101)) (=> b (> a 1102)) (=> b (> a 1103))
+    (=> b (> a 1104)) (=> b (> a 1105)) (=> b (> a 1106)) (=> b (> a 1107)) (=> b (> a 1108)) (=> b (> a 1109)) (=> b (> a 1110)) (=> b (> a 1111))
+    (=> b (> a 1112)) (=> b (> a 1113)) (=> b (> a 1114)) (=> b (> a 1115)) (=> b (> a 1116)) (=> b (> a 1117)) (=> b (> a 1118)) (=> b (> a 1119))
+    (=> b (> a 1120)) (=> b (> a 1121)) (=> b (> a 1122)) (=> b (> a 1123)) (=> b (> a 1124)) (=> b (> a 1125)) (=> b (> a 1126)) (=> b (> a 1127))
+    (=> b (> a 1128)) (=> b (> a 1129)) (=> b (> a 1130)) (=> b (> a 1131)) (=> b (> a 1132)) (=> b (> a 1133)) (=> b (> a 1134)) (=> b (> a 1135))
+    (=> b (> a 1136)) (=> b (> a 1137)) (=> b (> a 1138)) (=> b (> a 1139)) (=> b (> a 1140)) (=> b (> a 1141)) (=> b (> a 1142)) (=> b (> a 1143))
+    (=> b (> a 1144)) (=> b (> a 1145)) (=> b (> a 1146)) (=> b (> a 1147)) (=> b (> a 1148)) (=> b (> a 1149)) (=> b (> a 1150)) (=> b (> a 1151))
+    (=> b (> a 1152)) (=> b (> a 1153)) (=> b (> a 1154)) (=> b (> a 1155)) (=> b (> a 1156)) (=> b (> a 1157)) (=> b (> a 1158)) (=> b (> a 1159))
+    (=> b (> a 1160)) (=> b (> a 1161)) (=> b (> a 1162)) (=> b (> a 1163)) (=> b (> a 1164)) (=> b (> a 1165)) (=> b (> a 1166)) (=> b (> a 1167))
+    (=> b (> a 1168)) (=> b (> a 1169)) (=> b (> a 1170)) (=> b (> a 1171)) (=> b (> a 1172)) (=> b (> a 1173)) (=> b (> a 1174)) (=> b (> a 1175))
+    (=> b (> a 1176)) (=> b (> a 1177)) (=> b (> a 1178)) (=> b (> a 1179)) (=> b (> a 1180)) (=> b (> a 1181)) (=> b (> a 1182)) (=> b (> a 1183))
+    (=> b (> a 1184)) (=> b (> a 1185)) (=> b (> a 1186)) (=> b (> a 1187)) (=> b (> a 1188)) (=> b (> a 1189)) (=> b (> a 1190)) (=> b (> a 1191))
+    (=> b (> a 1192)) (=> b (> a 1193)) (=> b (> a 1194)) (=> b (> a 1195)) (=> b (> a 1196)) (=> b (> a 1197)) (=> b (> a 1198)) (=> b (> a 1199))
+    (=> b (> a 1200)) (=> b (> a 1201)) (=> b (> a 1202)) (=> b (> a 1203)) (=> b (> a 1204)) (=> b (> a 1205)) (=> b (> a 1206)) (=> b (> a 1207))
+    (=> b (> a 1208)) (=> b (> a 1209)) (=> b (> a 1210)) (=> b (> a 1211)) (=> b (> a 1212)) (=> b (> a 1213)) (=> b (> a 1214)) (=> b (> a 1215))
+    (=> b (> a 1216)) (=> b (> a 1217)) (=> b (> a 1218)) (=> b (> a 1219)) (=> b (> a 1220)) (=> b (> a 1221)) (=> b (> a 1222)) (=> b (> a 1223))
+    (=> b (> a 1224)) (=> b (> a 1225)) (=> b (> a 1226)) (=> b (> a 1227)) (=> b (> a 1228)) (=> b (> a 1229)) (=> b (> a 1230)) (=> b (> a 1231))
+    (=> b (> a 1232)) (=> b (> a 1233)) (=> b (> a 1234)) (=> b (> a 1235)) (=> b (> a 1236)) (=> b (> a 1237)) (=> b (> a 1238)) (=> b (> a 1239))
+    (=> b (> a 1240)) (=> b (> a 1241)) (=> b (> a 1242)) (=> b (> a 1243)) (=> b (> a 1244)) (=> b (> a 1245)) (=> b (> a 1246)) (=> b (> a 1247))
+    (=> b (> a 1248)) (=> b (> a 1249)) (=> b (> a 1250)) (=> b (> a 1251)) (=> b (> a 1252)) (=> b (> a 1253)) (=> b (> a 1254)) (=> b (> a 1255))
+    (=> b (> a 1256)) (=> b (> a 1257)) (=> b (> a 1258)) (=> b (> a 1259)) (=> b (> a 1260)) (=> b (> a 1261)) (=> b (> a 1262)) (=> b (> a 1263))
+    (=> b (> a 1264)) (=> b (> a 1265)) (=> b (> a 1266)) (=> b (> a 1267)) (=> b (> a 1268)) (=> b (> a 1269)) (=> b (> a 1270)) (=> b (> a 1271))
+    (=> b (> a 1272)) (=> b (> a 1273)) (=> b (> a 1274)) (=> b (> a 1275)) (=> b (> a 1276)) (=> b (> a 1277)) (=> b (> a 1278)) (=> b (> a 1279))
+    (=> b (> a 1280)) (=> b (> a 1281)) (=> b (> a 1282)) (=> b (> a 1283)) (=> b (> a 1284)) (=> b (> a 1285)) (=> b (> a 1286)) (=> b (> a 1287))
+    (=> b (> a 1288)) (=> b (> a 1289)) (=> b (> a 1290)) (=> b (> a 1291)) (=> b (> a 1292)) (=> b (> a 1293)) (=> b (> a 1294)) (=> b (> a 1295))
+    (=> b (> a 1296)) (=> b (> a 1297)) (=> b (> a 1298)) (=> b (> a 1299)) (=> b (> a 1300)) (=> b (> a 1301)) (=> b (> a 1302)) (=> b (> a 1303))
+    (=> b (> a 1304)) (=> b (> a 1305)) (=> b (> a 1306)) (=> b (> a 1307)) (=> b (> a 1308)) (=> b (> a 1309)) (=> b (> a 1310)) (=> b (> a 1311))
+    (=> b (> a 1312)) (=> b (> a 1313)) (=> b (> a 1314)) (=> b (> a 1315)) (=> b (> a 1316)) (=> b (> a 1317)) (=> b (> a 1318)) (=> b (> a 1319))
+    (=> b (> a 1320)) (=> b (> a 1321)) (=> b (> a 1322)) (=> b (> a 1323)) (=> b (> a 1324)) (=> b (> a 1325)) (=> b (> a 1326)) (=> b (> a 1327))
+    (=> b (> a 1328)) (=> b (> a 1329)) (=> b (> a 1330)) (=> b (> a 1331)) (=> b (> a 1332)) (=> b (> a 1333)) (=> b (> a 1334)) (=> b (> a 1335))
+    (=> b (> a 1336)) (=> b (> a 1337)) (=> b (> a 1338)) (=> b (> a 1339)) (=> b (> a 1340)) (=> b (> a 1341)) (=> b (> a 1342)) (=> b (> a 1343))
+    (=> b (> a 1344)) (=> b (> a 1345)) (=> b (> a 1346)) (=> b (> a 1347)) (=> b (> a 1348)) (=> b (> a 1349)) (=> b (> a 1350)) (=> b (> a 1351))
+    (=> b (> a 1352)) (=> b (> a 1353)) (=> b (> a 1354)) (=> b (> a 1355)) (=> b (> a 1356)) (=> b (> a 1357)) (=> b (> a 1358)) (=> b (> a 1359))
+    (=> b (> a 1360)) (=> b (> a 1361)) (=> b (> a 1362)) (=> b (> a 1363)) (=> b (> a 1364)) (=> b (> a 1365)) (=> b (> a 1366)) (=> b (> a 1367))
+    (=> b (> a 1368)) (=> b (> a 1369)) (=> b (> a 1370)) (=> b (> a 1371)) (=> b (> a 1372)) (=> b (> a 1373)) (=> b (> a 1374)) (=> b (> a 1375))
+    (=> b (> a 1376)) (=> b (> a 1377)) (=> b (> a 1378)) (=> b (> a 1379)) (=> b (> a 1380)) (=> b (> a 1381)) (=> b (> a 1382)) (=> b (> a 1383))
+    (=> b (> a 1384)) (=> b (> a 1385)) (=> b (> a 1386)) (=> b (> a 1387)) (=> b (> a 1388)) (=> b (> a 1389)) (=> b (> a 1390)) (=> b (> a 1391))
+    (=> b (> a 1392)) (=> b (> a 1393)) (=> b (> a 1394)) (=> b (> a 1395)) (=> b (> a 1396)) (=> b (> a 1397)) (=> b (> a 1398)) (=> b (> a 1399))
+    (=> b (> a 1400)) (=> b (> a 1401)) (=> b (> a 1402)) (=> b (> a 1403)) (=> b (> a 1404)) (=> b (> a 1405)) (=> b (> a 1406)) (=> b (> a 1407))
+    (=> b (> a 1408)) (=> b (> a 1409)) (=> b (> a 1410)) (=> b (> a 1411)) (=> b (> a 1412)) (=> b (> a 1413)) (=> b (> a 1414)) (=> b (> a 1415))
+    (=> b (> a 1416)) (=> b (> a 1417)) (=> b (> a 1418)) (=> b (> a 1419)) (=> b (> a 1420)) (=> b (> a 1421)) (=> b (> a 1422)) (=> b (> a 1423))
+    (=> b (> a 1424)) (=> b (> a 1425)) (=> b (> a 1426)) (=> b (> a 1427)) (=> b (> a 1428)) (=> b (> a 1429)) (=> b (> a 1430)) (=> b (> a 1431))
+    (=> b (> a 1432)) (=> b (> a 1433)) (=> b (> a 1434)) (=> b (> a 1435)) (=> b (> a 1436)) (=> b (> a 1437)) (=> b (> a 1438)) (=> b (> a 1439))
+    (=> b (> a 1440)) (=> b (> a 1441)) (=> b (> a 1442)) (=> b (> a 1443)) (=> b (> a 1444)) (=> b (> a 1445)) (=> b (> a 1446)) (=> b (> a 1447))
+    (=> b (> a 1448)) (=> b (> a 1449)) (=> b (> a 1450)) (=> b (> a 1451)) (=> b (> a 1452)) (=> b (> a 1453)) (=> b (> a 1454)) (=> b (> a 1455))
+    (=> b (> a 1456)) (=> b (> a 1457)) (=> b (> a 1458)) (=> b (> a 1459)) (=> b (> a 1460)) (=> b (> a 1461)) (=> b (> a 1462)) (=> b (> a 1463))
+    (=> b (> a 1464)) (=> b (> a 1465)) (=> b (> a 1466)) (=> b (> a 1467)) (=> b (> a 1468)) (=> b (> a 1469)) (=> b (> a 1470)) (=> b (> a 1471))
+    (=> b (> a 1472)) (=> b (> a 1473)) (=> b (> a 1474)) (=> b (> a 1475)) (=> b (> a 1476)) (=> b (> a 1477)) (=> b (> a 1478)) (=> b (> a 1479))
+    (=> b (> a 1480)) (=> b (> a 1481)) (=> b (> a 1482)) (=> b (> a 1483)) (=> b (> a 1484)) (=> b (> a 1485)) (=> b (> a 1486)) (=> b (> a 1487))
+    (=> b (> a 1488)) (=> b (> a 1489)) (=> b (> a 1490)) (=> b (> a 1491)) (=> b (> a 1492)) (=> b (> a 1493)) (=> b (> a 1494)) (=> b (> a 1495))
+    (=> b (> a 1496)) (=> b (> a 1497)) (=> b (> a 1498)) (=> b (> a 1499)) (=> b (> a 1500)) (=> b (> a 1501)) (=> b (> a 1502)) (=> b (> a 1503))
+    (=> b (> a 1504)) (=> b (> a 1505)) (=> b (> a 1506)) (=> b (> a 1507)) (=> b (> a 1508)) (=> b (> a 1509)) (=> b (> a 1510)) (=> b (> a 1511))
+    (=> b (> a 1512)) (=> b (> a 1513)) (=> b (> a 1514)) (=> b (> a 1515)) (=> b (> a 1516)) (=> b (> a 1517)) (=> b (> a 1518)) (=> b (> a 1519))
+    (=> b (> a 1520)) (=> b (> a 1521)) (=> b (> a 1522)) (=> b (> a 1523)) (=> b (> a 1524)) (=> b (> a 1525)) (=> b (> a 1526)) (=> b (> a 1527))
+    (=> b (> a 1528)) (=> b (> a 1529)) (=> b (> a 1530)) (=> b (> a 1531)) (=> b (> a 1532)) (=> b (> a 1533)) (=> b (> a 1534)) (=> b (> a 1535))
+    (=> b (> a 1536)) (=> b (> a 1537)) (=> b (> a 1538)) (=> b (> a 1539)) (=> b (> a 1540)) (=> b (> a 1541)) (=> b (> a 1542)) (=> b (> a 1543))
+    (=> b (> a 1544)) (=> b (> a 1545)) (=> b (> a 1546)) (=> b (> a 1547)) (=> b (> a 1548)) (=> b (> a 1549)) (=> b (> a 1550)) (=> b (> a 1551))
+    (=> b (> a 1552)) (=> b (> a 1553)) (=> b (> a 1554)) (=> b (> a 1555)) (=> b (> a 1556)) (=> b (> a 1557)) (=> b (> a 1558)) (=> b (> a 1559))
+    (=> b (> a 1560)) (=> b (> a 1561)) (=> b (> a 1562)) (=> b (> a 1563)) (=> b (> a 1564)) (=> b (> a 1565)) (=> b (> a 1566)) (=> b (> a 1567))
+    (=> b (> a 1568)) (=> b (> a 1569)) (=> b (> a 1570)) (=> b (> a 1571)) (=> b (> a 1572)) (=> b (> a 1573)) (=> b (> a 1574)) (=> b (> a 1575))
+    (=> b (> a 1576)) (=> b (> a 1577)) (=> b (> a 1578)) (=> b (> a 1579)) (=> b (> a 1580)) (=> b (> a 1581)) (=> b (> a 1582)) (=> b (> a 1583))
+    (=> b (> a 1584)) (=> b (> a 1585)) (=> b (> a 1586)) (=> b (> a 1587)) (=> b (> a 1588)) (=> b (> a 1589)) (=> b (> a 1590)) (=> b (> a 1591))
+    (=> b (> a 1592)) (=> b (> a 1593)) (=> b (> a 1594)) (=> b (> a 1595)) (=> b (> a 1596)) (=> b (> a 1597)) (=> b (> a 1598)) (=> b (> a 1599))
+    (=> b (> a 1600)) (=> b (> a 1601)) (=> b (> a 1602)) (=> b (> a 1603)) (=> b (> a 1604)) (=> b (> a 1605)) (=> b (> a 1606)) (=> b (> a 1607))
+    (=> b (> a 1608)) (=> b (> a 1609)) (=> b (> a 1610)) (=> b (> a 1611)) (=> b (> a 1612)) (=> b (> a 1613)) (=> b (> a 1614)) (=> b (> a 1615))
+    (=> b (> a 1616)) (=> b (> a 1617)) (=> b (> a 1618)) (=> b (> a 1619)) (=> b (> a 1620)) (=> b (> a 1621)) (=> b (> a 1622)) (=> b (> a 1623))
+    (=> b (> a 1624)) (=> b (> a 1625)) (=> b (> a 1626)) (=> b (> a 1627)) (=> b (> a 1628)) (=> b (> a 1629)) (=> b (> a 1630)) (=> b (> a 1631))
+    (=> b (> a 1632)) (=> b (> a 1633)) (=> b (> a 1634)) (=> b (> a 1635)) (=> b (> a 1636)) (=> b (> a 1637)) (=> b (> a 1638)) (=> b (> a 1639))
+    (=> b (> a 1640)) (=> b (> a 1641)) (=> b (> a 1642)) (=> b (> a 1643)) (=> b (> a 1644)) (=> b (> a 1645)) (=> b (> a 1646)) (=> b (> a 1647))
+    (=> b (> a 1648)) (=> b (> a 1649)) (=> b (> a 1650)) (=> b (> a 1651)) (=> b (> a 1652)) (=> b (> a 1653)) (=> b (> a 1654)) (=> b (> a 1655))
+    (=> b (> a 1656)) (=> b (> a 1657)) (=> b (> a 1658)) (=> b (> a 1659)) (=> b (> a 1660)) (=> b (> a 1661)) (=> b (> a 1662)) (=> b (> a 1663))
+    (=> b (> a 1664)) (=> b (> a 1665)) (=> b (> a 1666)) (=> b (> a 1667)) (=> b (> a 1668)) (=> b (> a 1669)) (=> b (> a 1670)) (=> b (> a 1671))
+    (=> b (> a 1672)) (=> b (> a 1673)) (=> b (> a 1674)) (=> b (> a 1675)) (=> b (> a 1676)) (=> b (> a 1677)) (=> b (> a 1678)) (=> b (> a 1679))
+    (=> b (> a 1680)) (=> b (> a 1681)) (=> b (> a 1682)) (=> b (> a 1683)) (=> b (> a 1684)) (=> b (> a 1685)) (=> b (> a 1686)) (=> b (> a 1687))
+    (=> b (> a 1688)) (=> b (> a 1689)) (=> b (> a 1690)) (=> b (> a 1691)) (=> b (> a 1692)) (=> b (> a 1693)) (=> b (> a 1694)) (=> b (> a 1695))
+    (=> b (> a 1696)) (=> b (> a 1697)) (=> b (> a 1698)) (=> b (> a 1699)) (=> b (> a 1700)) (=> b (> a 1701)) (=> b (> a 1702)) (< a b)
+    (=> b (> a 1704)) (=> b (> a 1705)) (=> b (> a 1706)) (=> b (> a 1707)) (=> b (> a 1708)) (=> b (> a 1709)) (=> b (> a 1710)) (=> b (> a 1711))
+    (=> b (> a 1712)) (=> b (> a 1713)) (=> b (> a 1714)) (=> b (> a 1715)) (=> b (> a 1716)) (=> b (> a 1717)) (=> b (> a 1718)) (=> b (> a 1719))
+    (=> b (> a 1720)) (=> b (> a 1721)) (=> b (> a 1722)) (=> b (> a 1723)) (=> b (> a 1724)) (=> b (> a 1725)) (=> b (> a 1726)) (=> b (> a 1727))
+    (=> b (> a 1728)) (=> b (> a 1729)) (=> b (> a 1730)) (=> b (> a 1731)) (=> b (> a 1732)) (=> b (> a 1733)) (=> b (> a 1734)) (=> b (> a 1735))
+    (=> b (> a 1736)) (=> b (> a 1737)) (=> b (> a 1738)) (=> b (> a 1739)) (=> b (> a 1740)) (=> b (> a 1741)) (=> b (> a 1742)) (=> b (> a 1743))
+    (=> b (> a 1744)) (=> b (> a 1745)) (=> b (> a 1746)) (=> b (> a 1747)) (=> b (> a 1748)) (=> b (> a 1749)) (=> b (> a 1750)) (=> b (> a 1751))
+    (=> b (> a 1752)) (=> b (> a 1753)) (=> b (> a 1754)) (=> b (> a 1755)) (=> b (> a 1756)) (=> b (> a 1757)) (=> b (> a 1758)) (=> b (> a 1759))
+    (=> b (> a 1760)) (=> b (> a 1761)) (=> b (> a 1762)) (=> b (> a 1763)) (=> b (> a 1764)) (=> b (> a 1765)) (=> b (> a 1766)) (=> b (> a 1767))
+    (=> b (> a 1768)) (=> b (> a 1769)) (=> b (> a 1770)) (=> b (> a 1771)) (=> b (> a 1772)) (=> b (> a 1773)) (=> b (> a 1774)) (=> b (> a 1775))
+    (=> b (> a 1776)) (=> b (> a 1777)) (=> b (> a 1778)) (=> b (> a 1779)) (=> b (> a 1780)) (=> b (> a 1781)) (=> b (> a 1782)) (=> b (> a 1783))
+    (=> b (> a 1784)) (=> b (> a 1785)) (=> b (> a 1786)) (=> b (> a 1787)) (=> b (> a 1788)) (=> b (> a 1789)) (=> b (> a 1790)) (=> b (> a 1791))
+    (=> b (> a 1792)) (=> b (> a 1793)) (=> b (> a 1794)) (=> b (> a 1795)) (=> b (> a 1796)) (=> b (> a 1797)) (=> b (> a 1798)) (=> b (> a 1799))
+    (=> b (> a 1800)) (=> b (> a 1801)) (=> b (> a 1802)) (=> b (> a 1803)) (=> b (> a 1804)) (=> b (> a 1805)) (=> b (> a 1806)) (=> b (> a 1807))
+    (=> b (> a 1808)) (=> b (> a 1809)) (=> b (> a 1810)) (=> b (> a 1811)) (=> b (> a 1812)) (=> b (> a 1813)) (=> b (> a 1814)) (=> b (> a 1815))
+    (=> b (> a 1816)) (=> b (> a 1817)) (=> b (> a 1818)) (=> b (> a 1819)) (=> b (> a 1820)) (=> b (> a 1821)) (=> b (> a 1822)) (=> b (> a 1823))
+    (=> b (> a 1824)) (=> b (> a 1825)) (=> b (> a 1826)) (=> b (> a 1827)) (=> b (> a 1828)) (=> b (> a 1829)) (=> b (> a 1830)) (=> b (> a 1831))
+    (=> b (> a 1832)) (=> b (> a 1833)) (=> b (> a 1834)) (=> b (> a 1835)) (=> b (> a 1836)) (=> b (> a 1837)) (=> b (> a 1838)) (=> b (> a 1839))
+    (=> b (> a 1840)) (=> b (> a 1841)) (=> b (> a 1842)) (=> b (> a 1843)) (=> b (> a 1844)) (=> b (> a 1845)) (=> b (> a 1846)) (=> b (> a 1847))
+    (=> b (> a 1848)) (=> b (> a 1849)) (=> b (> a 1850)) (=> b (> a 1851)) (=> b (> a 1852)) (=> b (> a 1853)) (=> b (> a 1854)) (=> b (> a 1855))
+    (=> b (> a 1856)) (=> b (> a 1857)) (=> b (> a 1858)) (=> b (> a 1859)) (=> b (> a 1860)) (=> b (> a 1861)) (=> b (> a 1862)) (=> b (> a 1863))
+    (=> b (> a 1864)) (=> b (> a 1865)) (=> b (> a 1866)) (=> b (> a 1867)) (=> b (> a 1868)) (=> b (> a 1869)) (=> b (> a 1870)) (=> b (> a 1871))
+    (=> b (> a 1872)) (=> b (> a 1873)) (=> b (> a 1874)) (=> b (> a 1875)) (=> b (> a 1876)) (=> b (> a 1877)) (=> b (> a 1878)) (=> b (> a 1879))
+    (=> b (> a 1880)) (=> b (> a 1881)) (=> b (> a 1882)) (=> b (> a 1883)) (=> b (> a 1884)) (=> b (> a 1885)) (=> b (> a 1886)) (=> b (> a 1887))
+    (=> b (> a 1888)) (=> b (> a 1889)) (=> b (> a 1890)) (=> b (> a 1891)) (=> b (> a 1892)) (=> b (> a 1893)) (=> b (> a 1894)) (=> b (> a 1895))
+    (=> b (> a 1896)) (=> b (> a 1897)) (=> b (> a 1898)) (=> b (> a 1899)) (=> b (> a 1900)) (=> b (> a 1901)) (=> b (> a 1902)) (=> b (> a 1903))
+    (=> b (> a 1904)) (=> b (> a 1905)) (=> b (> a 1906)) (=> b (> a 1907)) (=> b (> a 1908)) (=> b (> a 1909)) (=> b (> a 1910)) (=> b (> a 1911))
+    (=> b (> a 1912)) (=> b (> a 1913)) (=> b (> a 1914)) (=> b (> a 1915)) (=> b (> a 1916)) (=> b (> a 1917)) (=> b (> a 1918)) (=> b (> a 1919))
+    (=> b (> a 1920)) (=> b (> a 1921)) (=> b (> a 1922)) (=> b (> a 1923)) (=> b (> a 1924)) (=> b (> a 1925)) (=> b (> a 1926)) (=> b (> a 1927))
+    (=> b (> a 1928)) (=> b (> a 1929)) (=> b (> a 1930)) (=> b (> a 1931)) (=> b (> a 1932)) (=> b (> a 1933)) (=> b (> a 1934)) (=> b (> a 1935))
+    (=> b (> a 1936)) (=> b (> a 1937)) (=> b (> a 1938)) (=> b (> a 1939)) (=> b (> a 1940)) (=> b (> a 1941)) (=> b (> a 1942)) (=> b (> a 1943))
+    (=> b (> a 1944)) (=> b (> a 1945)) (=> b (> a 1946)) (=> b (> a 1947)) (=> b (> a 1948)) (=> b (> a 1949)) (=> b (> a 1950)) (=> b (> a 1951))
+    (=> b (> a 1952)) (=> b (> a 1953)) (=> b (> a 1954)) (=> b (> a 1955)) (=> b (> a 1956)) (=> b (> a 1957)) (=> b (> a 1958)) (=> b (> a 1959))
+    (=> b (> a 1960)) (=> b (> a 1961)) (=> b (> a 1962)) (=> b (> a 1963)) (=> b (> a 1964)) (=> b (> a 1965)) (=> b (> a 1966)) (=> b (> a 1967))
+    (=> b (> a 1968)) (=> b (> a 1969)) (=> b (> a 1970)) (=> b (> a 1971)) (=> b (> a 1972)) (=> b (> a 1973)) (=> b (> a 1974)) (=> b (> a 1975))
+    (=> b (> a 1976)) (=> b (> a 1977)) (=> b (> a 1978)) (=> b (> a 1979)) (=> b (> a 1980)) (=> b (> a 1981)) (=> b (> a 1982)) (=> b (> a 1983))
+    (=> b (> a 1984)) (=> b (> a 1985)) (=> b (> a 1986)) (=> b (> a 1987)) (=> b (> a 1988)) (=> b (> a 1989)) (=> b (> a 1990)) (=> b (> a 1991))
+    (=> b (> a 1992)) (=> b (> a 1993)) (=> b (> a 1994)) (=> b (> a 1995)) (=> b (> a 1996)) (=> b (> a 1997)) (=> b (> a 1998)) (=> b (> a 1999))
+)))
+(check-sat)
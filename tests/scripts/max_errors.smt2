@@ -0,0 +1,13 @@
+; With --max-errors, checking stops once that many errors have been found.
+; The first ones are kept, in the order of the commands, and a last line says
+; that the limit was reached.
+; args: --max-errors=3
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(assert (+ x 1))
+(declare-fun y () Foo)
+(assert (< x true))
+(assert (and x))
+(assert (- x 2))
+(declare-fun z () Bar)
+(check-sat)
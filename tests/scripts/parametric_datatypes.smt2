@@ -0,0 +1,17 @@
+; Parametric datatypes declared together refer to themselves and to each other.
+; The sort of each datatype is built with its parameters before it is expanded,
+; since expanded sorts are cached by their text.
+(set-logic UFLIA)
+(declare-datatypes ((List 1) (Tree 1))
+    ((par (T) ((nil) (cons (head T) (tail (List T)))))
+     (par (T) ((leaf) (node (value T) (children (List (Tree T))))))))
+(declare-const l (List Int))
+(declare-const t (Tree Bool))
+(assert (= (head l) 1))
+(assert (= (tail l) (as nil (List Int))))
+(assert (value t))
+(assert (= (children t) (as nil (List (Tree Bool)))))
+(assert (= (head (children t)) (as leaf (Tree Bool))))
+(assert (= (head l) true))
+(assert (= (children t) (as nil (List Bool))))
+(check-sat)
@@ -0,0 +1,8 @@
+; A parsing error stops the execution with exit code 1. The ill-sorted
+; assertion before it is not reported, since nothing is checked any further.
+; exit: 1
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(assert (+ x 1))
+(assert (< x 2)
+(check-sat)
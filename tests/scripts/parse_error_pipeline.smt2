@@ -0,0 +1,12 @@
+; A parsing error while commands are checked on the pipeline thread stops
+; that thread before the error is written out and the execution ends.
+; args: --pipeline --check-on-reduce
+; exit: 1
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (< x y))
+(assert (+ x 1))
+(assert (= x (+ y 1)))
+(assert (> x 0) (< y 0))
+(check-sat)
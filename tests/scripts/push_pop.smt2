@@ -0,0 +1,25 @@
+; Scopes opened by push are closed by pop with the same number of levels.
+; Before the symbol table was flattened, (pop n) needed n + 1 open levels
+; and closed only n - 1 of them, so (push 1) (pop 1) was rejected.
+(set-logic QF_LIA)
+(declare-fun a () Int)
+(push 1)
+(pop 1)
+(push 1)
+(declare-fun b () Int)
+(assert (< a b))
+(pop 1)
+(push 1)
+(declare-fun c () Int)
+(push 2)
+(pop 2)
+(assert (= c a))
+(pop 1)
+(push 1)
+(define-sort S () Int)
+(declare-fun d () S)
+(push 1)
+(assert (= d a))
+(pop 2)
+(assert (> a 0))
+(check-sat)
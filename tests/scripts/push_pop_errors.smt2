@@ -0,0 +1,23 @@
+; Popping more levels than were pushed, or none, is an error, and
+; symbols declared in a popped scope are unknown afterwards.
+(set-logic QF_LIA)
+(declare-fun a () Int)
+(pop 1)
+(push 1)
+(pop 2)
+(pop 0)
+(declare-fun b () Int)
+(pop 1)
+(push 2)
+(declare-fun c () Int)
+(define-sort S () Int)
+(pop 2)
+(assert (= b a))
+(assert (= c a))
+(declare-fun d () S)
+(push 1)
+(push 1)
+(declare-fun e () Int)
+(pop 1)
+(assert (= e a))
+(check-sat)
@@ -0,0 +1,30 @@
+; Sortedness errors of many kinds, reported in the order of the commands.
+(set-logic QF_UFLIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(declare-fun f (Int Int) Int)
+(declare-fun g (Foo) Int)
+(declare-const x Int)
+(assert (+ x y))
+(assert (= x undeclared))
+(assert (f x))
+(assert (and (> x 0) (f x y y)))
+(assert (forall ((a Int)) (+ a 1)))
+(assert (let ((z (+ x 1))) (> z w)))
+(define-fun h ((a Int) (b Bool)) Int (ite b a (+ a 1)))
+(assert (> (h x true) (h x 3)))
+(define-sort MyArr (X) (Array Int X))
+(declare-fun arr () (MyArr Bool))
+(assert (select arr 1))
+(assert (select arr true))
+(declare-datatypes ((L 0)) (((nil) (cons (hd Int) (tl L)))))
+(assert (= (hd (cons 1 nil)) 1))
+(assert (match (cons 1 nil) ((nil false) ((cons h t) (> h 0)))))
+(assert (match (cons 1 nil) ((nil 1) ((cons h t) (> h 0)))))
+(assert (! (> x 1) :named a1))
+(assert ((as const (Array Int Int)) 0))
+(assert (= (_ bv5 8) #b101))
+(assert (distinct x y 3 "s"))
+(check-sat)
+(get-value (x (+ y 1)))
+(exit)
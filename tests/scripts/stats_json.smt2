@@ -0,0 +1,9 @@
+; Statistics written as JSON: timings and counts vary, so only the structure is compared
+; args: --stats=json
+; json: stderr
+; mask: :[0-9.]+
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Int)
+(assert (> (+ x y) 0))
+(check-sat)
@@ -0,0 +1,9 @@
+; Syntax errors are reported on their own: the sortedness errors below
+; (an unknown sort and an ill-sorted assertion) are not.
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Foo)
+(define-sort Pair (X Y) Int)
+(assert (+ x 1))
+(define-sort Single (X) X)
+(check-sat)
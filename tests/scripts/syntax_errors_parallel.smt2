@@ -0,0 +1,9 @@
+; syntax_errors.smt2 with parallel checking, which must report the same errors
+; args: --parallel
+(set-logic QF_LIA)
+(declare-fun x () Int)
+(declare-fun y () Foo)
+(define-sort Pair (X Y) Int)
+(assert (+ x 1))
+(define-sort Single (X) X)
+(check-sat)
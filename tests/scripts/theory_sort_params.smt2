@@ -0,0 +1,20 @@
+; Sort parameters of theory functions are not script sorts, even when a script
+; defines a sort with the same name before the function is first used.
+; Theory declarations are loaded on first use, and they were once checked
+; against the sorts of the script, so that (= i i) below was rejected.
+(set-logic QF_AUFLIA)
+(define-sort A () Bool)
+(define-sort X () Bool)
+(declare-fun i () Int)
+(assert (= i i))
+(push 1)
+(define-sort Y () A)
+(declare-fun a () (Array Int Int))
+(declare-fun p () Y)
+(assert (= (select (store a i 1) i) 1))
+(assert (ite p (distinct i 0) (= p true)))
+(pop 1)
+(declare-fun b () (Array Int X))
+(assert (select b i))
+(assert (= (store b 0 true) b))
+(check-sat)
@@ -0,0 +1,116 @@
+/**
+ * \file symbol_syntax.cpp
+ * \brief Checks SymbolSyntax against the regular expressions it replaced.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * SyntaxChecker used to match symbols and keywords against the regular expressions
+ * below. SymbolSyntax must accept exactly the same values: every string of one or two
+ * bytes, every string of three bytes made of bytes from each class, every byte inside,
+ * before and after quoted symbols and keywords, and a few longer values.
+ */
+
+#include "util/symbol_syntax.h"
+
+#include <cstdio>
+#include <regex>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace smtlib;
+
+// Expressions used by SyntaxChecker before SymbolSyntax
+static const regex REGEX_SYMBOL(
+        "^([a-zA-Z+\\-/*=%?!.$_~&^<>@][a-zA-Z0-9+\\-/*=%?!.$_~&^<>@]*)"
+                "|(\\|[\\x20-\\x5B\\x5D-\\x7B\\x7D\\x7E\\xA0-\\xFF\\x09\\r\\n \\xA0]*\\|)$"
+);
+
+static const regex REGEX_KEYWORD(
+        "^:([a-zA-Z+\\-/*=%?!.$_~&^<>@][a-zA-Z0-9+\\-/*=%?!.$_~&^<>@]*)"
+                "|(\\|[\\x20-\\x5B\\x5D-\\x7B\\x7D\\x7E\\xA0-\\xFF\\x09\\r\\n \\xA0]*\\|)$"
+);
+
+// Bytes at the edges of the classes of the table, and those with a meaning of their own
+static const char CLASS_BYTES[] = {
+    '\x00', '\x08', '\t', '\n', '\r', '\x1F', ' ', '!', '"', '#', '\'', '(', ')', ',', '/',
+    '0', '9', ':', ';', '@', 'A', 'Z', '[', '\\', ']', '^', '_', '`', 'a', 'z', '{', '|',
+    '}', '~', '\x7F', '\x80', '\x9F', '\xA0', '\xFE', '\xFF'
+};
+
+// Longer values, well-formed or not
+static const char* VALUES[] = {
+    "x", "x!1", "abc", "ABC_def", "a.b.c", "<=", "=>", "+", "-", "bvadd", "~x", "@fresh",
+    "1abc", "0", "a b", "a|b", "a\\b", "a:b", "a(b", "a\"b", "#b0101", "#x1F",
+    ":named", ":left-assoc", ":a:b", "::", ":", ":1a", ": a", ":|a|",
+    "|", "||", "|a|", "|a b|", "|a|b|", "|a\\b|", "|a\nb|", "|a\tb|", "|\xA0|", "|\x7F|",
+    "|\x80|", "|\x9F|", "|\xFF|", "|(x y)|", "|;;|", "|\"|", "||a", "a||", "|a", "a|",
+    ""
+};
+
+static int failures = 0;
+
+static void compare(const string& value) {
+    bool symbol = regex_match(value, REGEX_SYMBOL);
+    bool keyword = regex_match(value, REGEX_KEYWORD);
+
+    if (SymbolSyntax::isSymbol(value) != symbol || SymbolSyntax::isKeyword(value) != keyword) {
+        string bytes;
+        for (auto chIt = value.begin(); chIt != value.end(); chIt++) {
+            char hex[8];
+            snprintf(hex, sizeof(hex), "%02X ", (unsigned char) *chIt);
+            bytes += hex;
+        }
+        fprintf(stderr, "Mismatch for [%s]: symbol %d (expected %d), keyword %d (expected %d)\n",
+                bytes.c_str(), SymbolSyntax::isSymbol(value), symbol,
+                SymbolSyntax::isKeyword(value), keyword);
+        failures++;
+    }
+}
+
+int main() {
+    vector<string> bytes;
+    for (int i = 0; i < 256; i++) {
+        bytes.push_back(string(1, (char) i));
+    }
+
+    // Every string of one or two bytes
+    for (auto firstIt = bytes.begin(); firstIt != bytes.end(); firstIt++) {
+        compare(*firstIt);
+        for (auto secondIt = bytes.begin(); secondIt != bytes.end(); secondIt++) {
+            compare(*firstIt + *secondIt);
+        }
+    }
+
+    // Every string of three bytes taken from the classes
+    for (char first : CLASS_BYTES) {
+        for (char second : CLASS_BYTES) {
+            for (char third : CLASS_BYTES) {
+                compare(string(1, first) + second + third);
+            }
+        }
+    }
+
+    // Every byte in each position of quoted symbols, simple symbols and keywords
+    for (auto byteIt = bytes.begin(); byteIt != bytes.end(); byteIt++) {
+        const string& b = *byteIt;
+        compare("|" + b + "|");
+        compare("|ab" + b + "cd|");
+        compare("|" + b + "ab|");
+        compare("|ab" + b + "|");
+        compare("|ab|" + b);
+        compare(b + "|ab|");
+        compare("|ab" + b);
+        compare("ab" + b + "cd");
+        compare(b + "abc");
+        compare("abc" + b);
+        compare(":" + b + "ab");
+        compare(":ab" + b);
+        compare(":ab" + b + "cd");
+    }
+
+    for (const char* value : VALUES) {
+        compare(value);
+    }
+
+    return failures == 0 ? 0 : 1;
+}
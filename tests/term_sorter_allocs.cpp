@@ -0,0 +1,128 @@
+/**
+ * \file term_sorter_allocs.cpp
+ * \brief Checks that sorting well-sorted terms does not allocate on the heap.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * A script is checked once, which loads the theories, declares the constants and
+ * warms up the caches and scratch buffers of TermSorter. Each asserted term is then
+ * sorted again, with every call to operator new counted, and must get its sort
+ * without a single allocation.
+ */
+
+#include "ast/ast_command.h"
+#include "ast/ast_script.h"
+#include "ast/visitor/ast_sortedness_checker.h"
+#include "ast/visitor/ast_term_sorter.h"
+#include "parser/smtlib_parser.h"
+#include "util/global_values.h"
+
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <string>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+// Whether allocations are being counted
+static atomic<bool> counting(false);
+
+// Number of allocations made while counting
+static atomic<unsigned long> allocations(0);
+
+void* operator new(size_t size) {
+    if (counting)
+        allocations++;
+    void* ptr = malloc(size ? size : 1);
+    if (!ptr)
+        throw bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    free(ptr);
+}
+
+// Script whose assertions are all well-sorted
+static const char* SCRIPT =
+    "(set-logic QF_AUFLIA)\n"
+    "(declare-fun x () Int)\n"
+    "(declare-fun y () Int)\n"
+    "(declare-fun p () Bool)\n"
+    "(declare-fun f (Int Int) Int)\n"
+    "(declare-fun a () (Array Int Int))\n"
+    "(declare-fun b () (Array Int Bool))\n"
+    "(assert (and p (< x y) (<= (+ x 1) (* 2 y)) (not (= x y))))\n"
+    "(assert (= (f x (- y 3)) (f (f x x) (div y 2)) (mod x 7)))\n"
+    "(assert (distinct x y (+ x y) (abs (- x))))\n"
+    "(assert (ite p (> x 0) (>= (ite (= x y) x y) 0)))\n"
+    "(assert (= (select (store a x y) (+ x 1)) (select a y)))\n"
+    "(assert (or (select b x) (= (store b y p) b) (=> p (select b (f x y)))))\n"
+    "(assert (= a (store (store a 0 1) 1 (select a 0))))\n";
+
+int main() {
+    string path = "term_sorter_allocs.smt2";
+    {
+        ofstream out(path);
+        out << SCRIPT;
+    }
+
+    Parser parser;
+    sptr_t<AstNode> ast = parser.parse(path);
+    remove(path.c_str());
+
+    sptr_t<Script> script = dynamic_pointer_cast<Script>(ast);
+    if (!script) {
+        fprintf(stderr, "Could not parse the script\n");
+        return 1;
+    }
+
+    sptr_t<SortednessChecker> checker = make_shared<SortednessChecker>();
+    checker->setLazyTheoryLoading(true);
+    checker->loadTheory(THEORY_CORE);
+    if (!checker->check(ast)) {
+        fprintf(stderr, "The script is not well-sorted\n");
+        return 1;
+    }
+
+    int failures = 0;
+    sptr_v<Command>& commands = script->getCommands();
+    for (auto cmdIt = commands.begin(); cmdIt != commands.end(); cmdIt++) {
+        sptr_t<AssertCommand> cmd = dynamic_pointer_cast<AssertCommand>(*cmdIt);
+        if (!cmd)
+            continue;
+
+        TermSorter sorter(checker);
+        allocations = 0;
+        counting = true;
+        bool sorted = sorter.run(cmd->getTerm().get()) != nullptr;
+        counting = false;
+
+        if (!sorted || allocations > 0) {
+            fprintf(stderr, "%s: %s, %lu allocations\n", cmd->getTerm()->toString().c_str(),
+                    sorted ? "sorted" : "not sorted", allocations.load());
+            failures++;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
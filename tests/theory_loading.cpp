@@ -0,0 +1,64 @@
+/**
+ * \file theory_loading.cpp
+ * \brief Checks that the symbols of theory declarations are made only once.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ *
+ * Theory declarations are kept aside until their names are first looked up.
+ * The symbols they declare must then stay the same objects, whether they are
+ * looked up in a pushed level that is popped afterwards or in a snapshot of
+ * the stack, so that what is cached for them (such as the instances of
+ * parametric functions) is not lost.
+ */
+
+#include "ast/visitor/ast_sortedness_checker.h"
+#include "util/global_values.h"
+
+#include <cstdio>
+#include <string>
+
+using namespace std;
+using namespace smtlib;
+using namespace smtlib::ast;
+
+static int failures = 0;
+
+static void expect(bool condition, const string& what) {
+    if (!condition) {
+        fprintf(stderr, "Failed: %s\n", what.c_str());
+        failures++;
+    }
+}
+
+int main() {
+    sptr_t<SortednessChecker> checker = make_shared<SortednessChecker>();
+    checker->setLazyTheoryLoading(true);
+    checker->loadTheory(THEORY_CORE);
+    checker->loadTheory("Ints");
+
+    sptr_t<SymbolStack> stack = checker->getStack();
+
+    // Looked up first in a level that is then popped
+    stack->push(2);
+    sptr_v<FunInfo> pushed = stack->getFunInfo("<");
+    sptr_t<SortInfo> pushedSort = stack->getSortInfo("Int");
+    stack->pop(2);
+
+    expect(!pushed.empty() && pushedSort, "'<' and 'Int' are loaded");
+    expect(stack->getFunInfo("<") == pushed, "'<' is not loaded again after a pop");
+    expect(stack->getSortInfo("Int") == pushedSort, "'Int' is not loaded again after a pop");
+
+    // Looked up first in a snapshot
+    sptr_t<SymbolStack> snapshot = stack->snapshot();
+    sptr_v<FunInfo> fromSnapshot = snapshot->getFunInfo("=");
+    expect(!fromSnapshot.empty(), "'=' is loaded");
+    expect(stack->getFunInfo("=") == fromSnapshot, "'=' has the same symbols in a stack and its snapshot");
+
+    // Looked up again after a reset, which keeps the symbols of theories
+    stack->push(1);
+    sptr_v<FunInfo> beforeReset = stack->getFunInfo("+");
+    stack->reset();
+    expect(!beforeReset.empty(), "'+' is loaded");
+    expect(stack->getFunInfo("+") == beforeReset, "'+' is not loaded again after a reset");
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,153 @@
+#include "diagnostic_writer.h"
+
+#include <cstring>
+#include <fstream>
+
+using namespace std;
+using namespace smtlib;
+
+// Size of the buffer above which records are written out
+static const size_t BUFFER_SIZE = 64 * 1024;
+
+// Time after which records are written out, if more are added
+static const chrono::milliseconds FLUSH_INTERVAL(50);
+
+/** Append a string to a record as a JSON string */
+static void appendQuoted(string& record, const string& str) {
+    static const char* HEX = "0123456789abcdef";
+
+    record += '"';
+    for (auto it = str.begin(); it != str.end(); it++) {
+        unsigned char c = (unsigned char) *it;
+        switch (c) {
+            case '"': record += "\\\""; break;
+            case '\\': record += "\\\\"; break;
+            case '\n': record += "\\n"; break;
+            case '\r': record += "\\r"; break;
+            case '\t': record += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    record += "\\u00";
+                    record += HEX[c >> 4];
+                    record += HEX[c & 0xf];
+                } else {
+                    record += (char) c;
+                }
+        }
+    }
+    record += '"';
+}
+
+/** Append a position to a record, as a JSON object */
+static void appendPosition(string& record, long offset, int line, int col) {
+    record += "{\"offset\":";
+    record += offset < 0 ? "null" : to_string(offset);
+    record += ",\"line\":" + to_string(line) + ",\"column\":" + to_string(col) + "}";
+}
+
+DiagnosticWriter::DiagnosticWriter(FILE* out) : out(out), ownsOut(false) { }
+
+DiagnosticWriter::~DiagnosticWriter() {
+    flush();
+    if (ownsOut)
+        fclose(out);
+}
+
+sptr_t<DiagnosticWriter> DiagnosticWriter::open(string path) {
+    if (path == "-")
+        return make_shared<DiagnosticWriter>(stdout);
+
+    FILE* file = fopen(path.c_str(), "w");
+    if (!file)
+        return sptr_t<DiagnosticWriter>();
+
+    sptr_t<DiagnosticWriter> writer = make_shared<DiagnosticWriter>(file);
+    writer->ownsOut = true;
+    return writer;
+}
+
+const vector<unsigned long>& DiagnosticWriter::getLineStarts(const string& file) {
+    auto it = lineStarts.find(file);
+    if (it != lineStarts.end())
+        return it->second;
+
+    vector<unsigned long>& starts = lineStarts[file];
+    ifstream in(file, ios::binary);
+    if (!in)
+        return starts;
+
+    starts.push_back(0);
+
+    char chunk[BUFSIZ];
+    unsigned long offset = 0;
+    while (in.read(chunk, sizeof(chunk)) || in.gcount() > 0) {
+        unsigned long count = (unsigned long) in.gcount();
+        const char* pos = chunk;
+        const char* end = chunk + count;
+        while ((pos = (const char*) memchr(pos, '\n', end - pos))) {
+            pos++;
+            starts.push_back(offset + (pos - chunk));
+        }
+        offset += count;
+    }
+
+    return starts;
+}
+
+long DiagnosticWriter::getOffset(const vector<unsigned long>& starts, int line, int col) {
+    if (line < 1 || (unsigned long) line > starts.size() || col < 1)
+        return -1;
+    return (long) (starts[line - 1] + col - 1);
+}
+
+void DiagnosticWriter::write(ErrorCode code, const string* file,
+                             int rowLeft, int colLeft, int rowRight, int colRight,
+                             const string& message) {
+    string head = "{\"file\":";
+    if (file)
+        appendQuoted(head, *file);
+    else
+        head += "null";
+
+    string tail = ",\"code\":\"";
+    tail += ErrorMessages::getCodeName(code);
+    tail += "\",\"message\":";
+    appendQuoted(tail, message);
+    tail += "}\n";
+
+    lock_guard<std::mutex> lock(mutex);
+
+    buffer += head;
+    if (rowLeft > 0) {
+        // Columns are counted in bytes, so offsets follow from the offsets of the lines
+        static const vector<unsigned long> none;
+        const vector<unsigned long>& starts = file ? getLineStarts(*file) : none;
+        long end = getOffset(starts, rowRight, colRight);
+
+        buffer += ",\"start\":";
+        appendPosition(buffer, getOffset(starts, rowLeft, colLeft), rowLeft, colLeft);
+        buffer += ",\"end\":";
+        appendPosition(buffer, end < 0 ? end : end + 1, rowRight, colRight);
+    } else {
+        buffer += ",\"start\":null,\"end\":null";
+    }
+    buffer += tail;
+
+    if (buffer.size() >= BUFFER_SIZE || chrono::steady_clock::now() - lastFlush >= FLUSH_INTERVAL)
+        flushBuffer();
+}
+
+void DiagnosticWriter::flush() {
+    lock_guard<std::mutex> lock(mutex);
+    flushBuffer();
+}
+
+void DiagnosticWriter::flushBuffer() {
+    if (!buffer.empty()) {
+        fwrite(buffer.data(), 1, buffer.size(), out);
+        buffer.clear();
+    }
+
+    fflush(out);
+    lastFlush = chrono::steady_clock::now();
+}
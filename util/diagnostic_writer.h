@@ -0,0 +1,86 @@
+/**
+ * \file diagnostic_writer.h
+ * \brief Writing errors as JSON Lines records, while checking is still running.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_DIAGNOSTIC_WRITER_H
+#define SMTLIB_PARSER_DIAGNOSTIC_WRITER_H
+
+#include "error_messages.h"
+#include "global_typedef.h"
+
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace smtlib {
+    /**
+     * Writes one JSON object per line for each error, with its file, its start and
+     * end positions (byte offset, line and column), its code and its message.
+     * Records are built on the calling thread and added to a shared buffer, which
+     * any thread may write to.
+     *
+     * The buffer is written out once it is large enough, when some time has passed
+     * since it was last written out (so the first record of a run is written out
+     * right away), and on flush().
+     */
+    class DiagnosticWriter {
+    private:
+        FILE* out;
+        bool ownsOut;
+
+        std::mutex mutex;
+        std::string buffer;
+        std::chrono::steady_clock::time_point lastFlush;
+
+        /** Byte offset at which each line starts, for each file an error was found in */
+        umap<std::string, std::vector<unsigned long>> lineStarts;
+
+        /** Offsets of the line starts of a file, read the first time they are needed */
+        const std::vector<unsigned long>& getLineStarts(const std::string& file);
+
+        /** Byte offset of a column (counted in bytes, from 1) of a line (from 1) */
+        long getOffset(const std::vector<unsigned long>& starts, int line, int col);
+
+        void flushBuffer();
+
+    public:
+        /** Write records to an open file, which is not closed afterwards */
+        explicit DiagnosticWriter(FILE* out);
+
+        /** Write out the records left in the buffer, closing the file if it was opened here */
+        ~DiagnosticWriter();
+
+        DiagnosticWriter(const DiagnosticWriter&) = delete;
+        DiagnosticWriter& operator=(const DiagnosticWriter&) = delete;
+
+        /**
+         * Open a file to write records to
+         * \param path  Path of the file, or "-" for the standard output
+         * \return The writer, or an empty pointer if the file cannot be opened
+         */
+        static sptr_t<DiagnosticWriter> open(std::string path);
+
+        /**
+         * Add a record for an error
+         * \param code      Kind of the error
+         * \param file      File in which the error was found (NULL if there is none)
+         * \param rowLeft   Line where the erroneous node begins (0 if it has no position)
+         * \param colLeft   Column where the erroneous node begins
+         * \param rowRight  Line where the erroneous node ends
+         * \param colRight  Column where the erroneous node ends
+         * \param message   Message of the error
+         */
+        void write(ErrorCode code, const std::string* file,
+                   int rowLeft, int colLeft, int rowRight, int colRight,
+                   const std::string& message);
+
+        /** Write out the records in the buffer */
+        void flush();
+    };
+}
+
+#endif //SMTLIB_PARSER_DIAGNOSTIC_WRITER_H
@@ -100,6 +100,56 @@ const string ErrorMessages::ERR_SORTED_VAR_MISSING_SORT = "Missing sort from sor
 const string ErrorMessages::ERR_VAR_BIND_MISSING_SYMBOL = "Missing symbol from variable binding";
 const string ErrorMessages::ERR_VAR_BIND_MISSING_SORT = "Missing sort from variable binding";
 
+// Names of the error codes, in the order in which they are declared
+static const char* CODE_NAMES[] = {
+    "THEORY_UNLOADABLE",
+    "THEORY_UNKNOWN",
+    "THEORY_ALREADY_LOADED",
+    "LOGIC_UNLOADABLE",
+    "LOGIC_UNKNOWN",
+    "LOGIC_ALREADY_SET",
+    "SORT_UNKNOWN",
+    "SORT_ARITY",
+    "ASSERT_TERM_NOT_WELL_SORTED",
+    "ASSERT_TERM_NOT_BOOL",
+    "CONST_ALREADY_EXISTS",
+    "CONST_UNKNOWN",
+    "CONST_MULTIPLE_SORTS",
+    "CONST_WRONG_SORT",
+    "FUN_ALREADY_EXISTS",
+    "FUN_BODY_WRONG_SORT",
+    "FUN_BODY_NOT_WELL_SORTED",
+    "SORT_ALREADY_EXISTS",
+    "SPEC_CONST_ALREADY_EXISTS",
+    "META_SPEC_CONST_ALREADY_EXISTS",
+    "RIGHT_ASSOC_PARAM_COUNT",
+    "RIGHT_ASSOC_RET_SORT",
+    "LEFT_ASSOC_PARAM_COUNT",
+    "LEFT_ASSOC_RET_SORT",
+    "CHAINABLE_AND_PAIRWISE",
+    "CHAINABLE_PARAM_COUNT",
+    "CHAINABLE_PARAM_SORT",
+    "CHAINABLE_RET_SORT",
+    "PAIRWISE_PARAM_COUNT",
+    "PAIRWISE_PARAM_SORT",
+    "PAIRWISE_RET_SORT",
+    "TERM_NOT_WELL_SORTED",
+    "STACK_UNPOPPABLE",
+    "LITERAL_UNKNOWN_SORT",
+    "LITERAL_MULTIPLE_SORTS",
+    "FUN_UNKNOWN_DECL",
+    "FUN_MULTIPLE_DECLS",
+    "QUANT_TERM_WRONG_SORT",
+    "PATTERN_MISMATCH",
+    "CASES_MISMATCH",
+    "SYNTAX",
+    "PARSE"
+};
+
+const char* ErrorMessages::getCodeName(ErrorCode code) {
+    return CODE_NAMES[code];
+}
+
 string ErrorMessages::extractFirstN(string str, unsigned long n) {
     if (str.length() > n)
         return string(str, 0, n) + "[...]";
@@ -108,7 +158,7 @@ string ErrorMessages::extractFirstN(string str, unsigned long n) {
 }
 
 void ErrorMessages::printArray(stringstream &ss,
-                               vector<string> &array,
+                               const vector<string> &array,
                                string separator) {
     bool first = true;
     for (auto it = array.begin(); it != array.end(); it++) {
@@ -165,7 +215,7 @@ string ErrorMessages::buildSortParamArity(string sort, string sortName) {
 string ErrorMessages::buildAssertTermNotWellSorted(string term,
                                                    int rowLeft, int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "Assertion term '" << extractFirstN(term, 50) << "'";
+    ss << "Assertion term '" << extractFirstN(term, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -177,7 +227,7 @@ string ErrorMessages::buildAssertTermNotWellSorted(string term,
 string ErrorMessages::buildAssertTermNotBool(string term, string termSort,
                                              int rowLeft, int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "Assertion term '" << extractFirstN(term, 50) << "'";
+    ss << "Assertion term '" << extractFirstN(term, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -264,7 +314,7 @@ string ErrorMessages::buildPairwiseRetSort(string name) {
 string ErrorMessages::buildFunBodyWrongSort(string body, string wrongSort, string rightSort,
                                             int rowLeft, int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "Function body '" << extractFirstN(body, 50) << "'";
+    ss << "Function body '" << extractFirstN(body, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -277,7 +327,7 @@ string ErrorMessages::buildFunBodyWrongSort(string name, string body,
                                             string wrongSort, string rightSort,
                                             int rowLeft, int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "The body of function " << name << ", '" << extractFirstN(body, 50) << "'";
+    ss << "The body of function " << name << ", '" << extractFirstN(body, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -289,7 +339,7 @@ string ErrorMessages::buildFunBodyWrongSort(string name, string body,
 string ErrorMessages::buildFunBodyNotWellSorted(string body,
                                                 int rowLeft, int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "Function body '" << extractFirstN(body, 50) << "'";
+    ss << "Function body '" << extractFirstN(body, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -301,7 +351,7 @@ string ErrorMessages::buildFunBodyNotWellSorted(string body,
 string ErrorMessages::buildFunBodyNotWellSorted(string name, string body, int rowLeft,
                                                 int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "The body of function '" << name << "', '" << extractFirstN(body, 50) << "'";
+    ss << "The body of function '" << name << "', '" << extractFirstN(body, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -313,7 +363,7 @@ string ErrorMessages::buildFunBodyNotWellSorted(string name, string body, int ro
 string ErrorMessages::buildTermNotWellSorted(string term, int rowLeft,
                                              int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "Term '" << extractFirstN(term, 50) << "'";
+    ss << "Term '" << extractFirstN(term, TERM_QUOTE_LENGTH) << "'";
 
     if (rowLeft && colLeft && rowRight && colRight)
         ss << " (" << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight << ")";
@@ -342,7 +392,7 @@ string ErrorMessages::buildTheoryAlreadyLoaded(string theory) {
     return "Theory '" + theory + "' already loaded";
 }
 
-string ErrorMessages::buildConstMultipleSorts(string name, vector<string> &possibleSorts) {
+string ErrorMessages::buildConstMultipleSorts(string name, const vector<string> &possibleSorts) {
     stringstream ss;
     ss << "Multiple possible sorts for constant '" << name << "': ";
     printArray(ss, possibleSorts, ", ");
@@ -352,7 +402,7 @@ string ErrorMessages::buildConstMultipleSorts(string name, vector<string> &possi
 
 string ErrorMessages::buildConstWrongSort(string name,
                                           string wrongSort,
-                                          vector<string> &possibleSorts) {
+                                          const vector<string> &possibleSorts) {
     stringstream ss;
     ss << "Constant '" << name << "' cannot be of sort " << wrongSort << ". Possible sorts: ";
     printArray(ss, possibleSorts, ", ");
@@ -365,7 +415,7 @@ string ErrorMessages::buildLiteralUnknownSort(string literalType) {
 }
 
 string ErrorMessages::buildLiteralMultipleSorts(string literalType,
-                                                vector<string> &possibleSorts) {
+                                                const vector<string> &possibleSorts) {
     stringstream ss;
     ss << "Multiple declared sorts for " + literalType + " literals: ";
     printArray(ss, possibleSorts, ", ");
@@ -433,7 +483,7 @@ string ErrorMessages::buildFunMultipleDecls(string name,
 string ErrorMessages::buildQuantTermWrongSort(string term, string wrongSort, string rightSort,
                                               int rowLeft, int colLeft, int rowRight, int colRight) {
     stringstream ss;
-    ss << "Quantified term '" << extractFirstN(term, 50) << "' ("
+    ss << "Quantified term '" << extractFirstN(term, TERM_QUOTE_LENGTH) << "' ("
     << rowLeft << ":" << colLeft << " - " << rowRight << ":" << colRight
     << ") is of type " << wrongSort << ", not " << rightSort;
 
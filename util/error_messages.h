@@ -12,14 +12,69 @@
 #include <vector>
 
 namespace smtlib {
+    /**
+     * Kinds of errors: one for each family of sortedness messages built by ErrorMessages,
+     * followed by one for all syntax errors and one for parsing errors
+     */
+    enum ErrorCode {
+        ERROR_THEORY_UNLOADABLE = 0,
+        ERROR_THEORY_UNKNOWN,
+        ERROR_THEORY_ALREADY_LOADED,
+        ERROR_LOGIC_UNLOADABLE,
+        ERROR_LOGIC_UNKNOWN,
+        ERROR_LOGIC_ALREADY_SET,
+        ERROR_SORT_UNKNOWN,
+        ERROR_SORT_ARITY,
+        ERROR_ASSERT_TERM_NOT_WELL_SORTED,
+        ERROR_ASSERT_TERM_NOT_BOOL,
+        ERROR_CONST_ALREADY_EXISTS,
+        ERROR_CONST_UNKNOWN,
+        ERROR_CONST_MULTIPLE_SORTS,
+        ERROR_CONST_WRONG_SORT,
+        ERROR_FUN_ALREADY_EXISTS,
+        ERROR_FUN_BODY_WRONG_SORT,
+        ERROR_FUN_BODY_NOT_WELL_SORTED,
+        ERROR_SORT_ALREADY_EXISTS,
+        ERROR_SPEC_CONST_ALREADY_EXISTS,
+        ERROR_META_SPEC_CONST_ALREADY_EXISTS,
+        ERROR_RIGHT_ASSOC_PARAM_COUNT,
+        ERROR_RIGHT_ASSOC_RET_SORT,
+        ERROR_LEFT_ASSOC_PARAM_COUNT,
+        ERROR_LEFT_ASSOC_RET_SORT,
+        ERROR_CHAINABLE_AND_PAIRWISE,
+        ERROR_CHAINABLE_PARAM_COUNT,
+        ERROR_CHAINABLE_PARAM_SORT,
+        ERROR_CHAINABLE_RET_SORT,
+        ERROR_PAIRWISE_PARAM_COUNT,
+        ERROR_PAIRWISE_PARAM_SORT,
+        ERROR_PAIRWISE_RET_SORT,
+        ERROR_TERM_NOT_WELL_SORTED,
+        ERROR_STACK_UNPOPPABLE,
+        ERROR_LITERAL_UNKNOWN_SORT,
+        ERROR_LITERAL_MULTIPLE_SORTS,
+        ERROR_FUN_UNKNOWN_DECL,
+        ERROR_FUN_MULTIPLE_DECLS,
+        ERROR_QUANT_TERM_WRONG_SORT,
+        ERROR_PATTERN_MISMATCH,
+        ERROR_CASES_MISMATCH,
+        ERROR_SYNTAX,
+        ERROR_PARSE
+    };
+
     class ErrorMessages {
     private:
         static std::string extractFirstN(std::string str, unsigned long n);
 
         static void printArray(std::stringstream &ss,
-                               std::vector<std::string> &array,
+                               const std::vector<std::string> &array,
                                std::string separator);
     public:
+        /** Name of an error code, as written in machine-readable diagnostics */
+        static const char* getCodeName(ErrorCode code);
+
+        /** Maximum number of characters of a term quoted in an error message */
+        static const unsigned long TERM_QUOTE_LENGTH = 50;
+
         static const std::string ERR_NULL_NODE_VISIT;
         static const std::string ERR_ATTR_MISSING_KEYWORD;
         static const std::string ERR_SYMBOL_MALFORMED;
@@ -148,11 +203,11 @@ namespace smtlib {
         static std::string buildConstUnknown(std::string name);
 
         static std::string buildConstMultipleSorts(std::string name,
-                                                   std::vector<std::string> &possibleSorts);
+                                                   const std::vector<std::string> &possibleSorts);
 
         static std::string buildConstWrongSort(std::string name,
                                                std::string wrongSort,
-                                               std::vector<std::string> &possibleSorts);
+                                               const std::vector<std::string> &possibleSorts);
 
         static std::string buildFunAlreadyExists(std::string name);
 
@@ -205,7 +260,7 @@ namespace smtlib {
         static std::string buildLiteralUnknownSort(std::string literalType);
 
         static std::string buildLiteralMultipleSorts(std::string literalType,
-                                                     std::vector<std::string> &possibleSorts);
+                                                     const std::vector<std::string> &possibleSorts);
 
         static std::string buildFunUnknownDecl(std::string name,
                                                std::string retSort);
@@ -1,5 +1,4 @@
 #include <stdio.h>
-#include <stdlib.h>
 #include "logger.h"
 
 using namespace smtlib;
@@ -38,5 +37,4 @@ void Logger::parsingError(unsigned int rowLeft, unsigned int colLeft,
 
     fprintf(stderr, "In %s from %d:%d to %d:%d - %s\n",
             filename, rowLeft, colLeft, rowRight, colRight, msg);
-    exit(Logger::ErrorCode::ERR_PARSE);
 }
\ No newline at end of file
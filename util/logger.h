@@ -10,7 +10,7 @@
 namespace smtlib {
     class Logger {
     public:
-        /** Error codes to be used with exit() calls */
+        /** Exit codes of smtlib-parser */
         enum ErrorCode {
             ERR_PARSE = 1
         };
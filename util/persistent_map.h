@@ -0,0 +1,207 @@
+/**
+ * \file persistent_map.h
+ * \brief Hash map with structural sharing between versions.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_PERSISTENT_MAP_H
+#define SMTLIB_PARSER_PERSISTENT_MAP_H
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace smtlib {
+    /**
+     * Hash array mapped trie. Copying a map takes constant time, and setting
+     * a key only copies the path from the root to that key, so that all other
+     * copies keep seeing their own contents. Nodes are never modified once
+     * built, which means that a copy can be read from several threads at once
+     * while other copies are being changed.
+     */
+    template<class K, class V, class Hash = std::hash<K>>
+    class PersistentMap {
+    private:
+        static const unsigned BITS = 5;
+        static const size_t MASK = (1 << BITS) - 1;
+
+        /** Entry, followed by the other entries whose keys have the same hash */
+        struct Leaf {
+            size_t hash;
+            K key;
+            V value;
+            std::vector<std::pair<K, V>> collisions;
+
+            inline Leaf(size_t hash, const K& key, const V& value) : hash(hash), key(key), value(value) { }
+        };
+
+        struct Node;
+
+        /** Either a subtree or a leaf */
+        struct Slot {
+            std::shared_ptr<const Node> node;
+            std::shared_ptr<const Leaf> leaf;
+        };
+
+        struct Node {
+            uint32_t bitmap;
+            std::vector<Slot> slots;
+
+            inline Node() : bitmap(0) { }
+        };
+
+        std::shared_ptr<const Node> root;
+        size_t count;
+
+        /** Position of the slot for a bit, among the slots present in the bitmap */
+        static inline unsigned position(uint32_t bitmap, uint32_t bit) {
+            return (unsigned) __builtin_popcount(bitmap & (bit - 1));
+        }
+
+        static std::shared_ptr<const Node> insert(const std::shared_ptr<const Node>& node, unsigned shift,
+                                                  size_t hash, const K& key, const V& value, bool& added) {
+            uint32_t bit = (uint32_t) 1 << ((hash >> shift) & MASK);
+            std::shared_ptr<Node> copy = node ? std::make_shared<Node>(*node) : std::make_shared<Node>();
+            unsigned pos = position(copy->bitmap, bit);
+
+            if (!(copy->bitmap & bit)) {
+                Slot slot;
+                slot.leaf = std::make_shared<Leaf>(hash, key, value);
+                copy->slots.insert(copy->slots.begin() + pos, slot);
+                copy->bitmap |= bit;
+                added = true;
+                return copy;
+            }
+
+            Slot& slot = copy->slots[pos];
+            if (slot.node) {
+                slot.node = insert(slot.node, shift + BITS, hash, key, value, added);
+            } else if (slot.leaf->hash == hash) {
+                std::shared_ptr<Leaf> leaf = std::make_shared<Leaf>(*slot.leaf);
+                if (leaf->key == key) {
+                    leaf->value = value;
+                } else {
+                    auto entryIt = leaf->collisions.begin();
+                    while (entryIt != leaf->collisions.end() && !(entryIt->first == key))
+                        entryIt++;
+
+                    if (entryIt != leaf->collisions.end()) {
+                        entryIt->second = value;
+                    } else {
+                        leaf->collisions.push_back(std::make_pair(key, value));
+                        added = true;
+                    }
+                }
+                slot.leaf = leaf;
+            } else {
+                // Different hashes always differ in some chunk before the bits run out
+                unsigned subshift = shift + BITS;
+                std::shared_ptr<Node> sub = std::make_shared<Node>();
+                Slot moved;
+                moved.leaf = slot.leaf;
+                sub->slots.push_back(moved);
+                sub->bitmap = (uint32_t) 1 << ((slot.leaf->hash >> subshift) & MASK);
+
+                slot.leaf.reset();
+                slot.node = insert(sub, subshift, hash, key, value, added);
+            }
+
+            return copy;
+        }
+
+        template<class F>
+        static void forEach(const std::shared_ptr<const Node>& node, F& f) {
+            for (auto slotIt = node->slots.begin(); slotIt != node->slots.end(); slotIt++) {
+                if (slotIt->node) {
+                    forEach(slotIt->node, f);
+                } else {
+                    f(slotIt->leaf->key, slotIt->leaf->value);
+                    for (auto entryIt = slotIt->leaf->collisions.begin();
+                         entryIt != slotIt->leaf->collisions.end(); entryIt++) {
+                        f(entryIt->first, entryIt->second);
+                    }
+                }
+            }
+        }
+
+    public:
+        inline PersistentMap() : count(0) { }
+
+        inline size_t size() const { return count; }
+
+        inline bool empty() const { return count == 0; }
+
+        inline void clear() {
+            root.reset();
+            count = 0;
+        }
+
+        /**
+         * Get the value of a key, or NULL if the key is not in the map.
+         * The value stays in place until its key, or a key with the same hash, is set again.
+         */
+        const V* find(const K& key) const {
+            unsigned depth;
+            return find(key, depth);
+        }
+
+        /**
+         * Get the value of a key, as find(key), along with the number of trie nodes and
+         * colliding entries that were looked at to get to it
+         */
+        const V* find(const K& key, unsigned& depth) const {
+            size_t hash = Hash()(key);
+            const Node* node = root.get();
+            unsigned shift = 0;
+            depth = 0;
+
+            while (node) {
+                depth++;
+                uint32_t bit = (uint32_t) 1 << ((hash >> shift) & MASK);
+                if (!(node->bitmap & bit))
+                    return NULL;
+
+                const Slot& slot = node->slots[position(node->bitmap, bit)];
+                if (slot.node) {
+                    node = slot.node.get();
+                    shift += BITS;
+                } else {
+                    if (slot.leaf->hash != hash)
+                        return NULL;
+
+                    if (slot.leaf->key == key)
+                        return &slot.leaf->value;
+
+                    for (auto entryIt = slot.leaf->collisions.begin();
+                         entryIt != slot.leaf->collisions.end(); entryIt++) {
+                        depth++;
+                        if (entryIt->first == key)
+                            return &entryIt->second;
+                    }
+                    return NULL;
+                }
+            }
+
+            return NULL;
+        }
+
+        /** Set the value of a key. Other copies of the map are not affected. */
+        void set(const K& key, const V& value) {
+            bool added = false;
+            root = insert(root, 0, Hash()(key), key, value, added);
+            if (added)
+                count++;
+        }
+
+        /** Call f(key, value) for every entry in the map, in no particular order */
+        template<class F>
+        void forEach(F f) const {
+            if (root)
+                forEach(root, f);
+        }
+    };
+}
+
+#endif //SMTLIB_PARSER_PERSISTENT_MAP_H
@@ -0,0 +1,161 @@
+/**
+ * \file spsc_queue.h
+ * \brief Bounded queue between a single producer thread and a single consumer thread.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_SPSC_QUEUE_H
+#define SMTLIB_PARSER_SPSC_QUEUE_H
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace smtlib {
+    /**
+     * Ring buffer of fixed capacity, with one thread adding items at its back and
+     * another one taking them from its front. Items are passed without locking:
+     * each side only writes its own position and reads the other one's. A side
+     * that cannot go on (the producer on a full queue, or the consumer on an empty
+     * one) yields for a while, then sleeps until the other side makes progress.
+     * A sleeping side is only woken up once a few items have been added (or taken
+     * off) since, so that waking up is paid once for a batch of items.
+     *
+     * The consumer looks at the front item in place and only removes it once done
+     * with it, so that the producer can wait for all items to have been handled.
+     */
+    template<class T>
+    class SpscQueue {
+    private:
+        /** Number of times a side yields before going to sleep, when the other one may be running */
+        static const unsigned SPIN_LIMIT = 64;
+
+        /** Number of items added or taken off by one side before it wakes up the other one */
+        static const size_t WAKE_BATCH = 16;
+
+        /** Size of a cache line, so that each position is written without disturbing the other */
+        static const size_t LINE_SIZE = 64;
+
+        std::vector<T> slots;
+        size_t mask;
+        size_t batch;
+
+        /** Number of times a side yields before going to sleep: none on a single hardware thread */
+        unsigned spins;
+
+        // Position of the next item to take, only written by the consumer
+        std::atomic<size_t> head;
+        char headPadding[LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+        // Position of the next free slot, only written by the producer
+        std::atomic<size_t> tail;
+        char tailPadding[LINE_SIZE - sizeof(std::atomic<size_t>)];
+
+        // Last position seen of the other side, so that it is read again only when needed
+        size_t cachedHead;
+        size_t cachedTail;
+
+        std::atomic<unsigned> sleepers;
+        std::mutex mutex;
+        std::condition_variable progress;
+
+        /** Wait until a condition holds, which only the other side can bring about */
+        template<class F>
+        void waitUntil(F condition) {
+            for (unsigned i = 0; i < spins; i++) {
+                if (condition())
+                    return;
+                std::this_thread::yield();
+            }
+
+            std::unique_lock<std::mutex> lock(mutex);
+            sleepers.fetch_add(1);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            progress.wait(lock, condition);
+            sleepers.fetch_sub(1);
+        }
+
+        /** Wake up the other side, if it is sleeping and the condition it waits for may hold */
+        void notify(bool ready) {
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (ready && sleepers.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(mutex);
+                progress.notify_all();
+            }
+        }
+
+        static size_t roundUp(size_t capacity) {
+            size_t size = 1;
+            while (size < capacity)
+                size <<= 1;
+            return size;
+        }
+
+    public:
+        /** \param capacity Maximum number of items, rounded up to a power of two */
+        explicit SpscQueue(size_t capacity)
+                : slots(roundUp(capacity)), mask(roundUp(capacity) - 1),
+                  batch(mask < WAKE_BATCH ? mask + 1 : WAKE_BATCH),
+                  spins(std::thread::hardware_concurrency() > 1 ? SPIN_LIMIT : 0),
+                  head(0), tail(0), cachedHead(0), cachedTail(0), sleepers(0) { }
+
+        SpscQueue(const SpscQueue&) = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        /** Add an item at the back, waiting while the queue is full. Producer only. */
+        void push(T item) {
+            size_t back = tail.load(std::memory_order_relaxed);
+            if (back - cachedHead > mask) {
+                waitUntil([this, back] {
+                    cachedHead = head.load(std::memory_order_acquire);
+                    return back - cachedHead <= mask;
+                });
+            }
+
+            slots[back & mask] = std::move(item);
+            tail.store(back + 1, std::memory_order_release);
+            notify(back + 1 - head.load(std::memory_order_relaxed) >= batch);
+        }
+
+        /**
+         * Wait until all items have been taken off the queue, waking up the consumer
+         * if there are fewer of them than it waits for. Producer only.
+         */
+        void waitEmpty() {
+            size_t back = tail.load(std::memory_order_relaxed);
+            notify(true);
+            waitUntil([this, back] {
+                cachedHead = head.load(std::memory_order_acquire);
+                return cachedHead == back;
+            });
+        }
+
+        /** Item at the front, waiting while the queue is empty. Consumer only. */
+        T& front() {
+            size_t first = head.load(std::memory_order_relaxed);
+            if (first == cachedTail) {
+                waitUntil([this, first] {
+                    cachedTail = tail.load(std::memory_order_acquire);
+                    return first != cachedTail;
+                });
+            }
+
+            return slots[first & mask];
+        }
+
+        /** Take the item at the front off the queue, once done with it. Consumer only. */
+        void pop() {
+            size_t first = head.load(std::memory_order_relaxed);
+            slots[first & mask] = T();
+            head.store(first + 1, std::memory_order_release);
+
+            size_t left = tail.load(std::memory_order_relaxed) - (first + 1);
+            notify(left == 0 || left + batch <= mask + 1);
+        }
+    };
+}
+
+#endif //SMTLIB_PARSER_SPSC_QUEUE_H
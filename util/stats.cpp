@@ -0,0 +1,160 @@
+#include "stats.h"
+
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+
+using namespace std;
+using namespace smtlib;
+
+// Names of the counters, in the order in which they are declared
+static const char* COUNTER_NAMES[] = {
+    "sort_lookups",
+    "fun_lookups",
+    "var_lookups",
+    "lookup_depth",
+    "sort_expansions",
+    "sort_expansions_uncached",
+    "sort_comparisons"
+};
+
+/** Phase of an execution, timed once it is done */
+struct Phase {
+    string name;
+    string subject;
+    unsigned depth;
+    double wall;
+    double cpu;
+};
+
+bool Stats::enabled = false;
+vector<unique_ptr<Stats::Counters>> Stats::allCounters;
+
+static mutex statsMutex;
+
+// Phases in the order in which they started
+static vector<Phase> phases;
+
+// Number of phases started and not yet done on the calling thread
+static thread_local unsigned depth = 0;
+
+Stats::Counters& Stats::local() {
+    static thread_local Counters* counters = NULL;
+
+    if (!counters) {
+        counters = new Counters();
+        lock_guard<mutex> lock(statsMutex);
+        allCounters.push_back(unique_ptr<Counters>(counters));
+    }
+
+    return *counters;
+}
+
+void Stats::enable() {
+    enabled = true;
+}
+
+Stats::Timer::Timer(const char* phase, const string& subject) : index(-1) {
+    if (!enabled)
+        return;
+
+    {
+        lock_guard<mutex> lock(statsMutex);
+        index = (long) phases.size();
+        phases.push_back(Phase { phase, subject, depth, 0, 0 });
+    }
+
+    depth++;
+    wallStart = chrono::steady_clock::now();
+    cpuStart = clock();
+}
+
+Stats::Timer::~Timer() {
+    if (index < 0)
+        return;
+
+    double wall = chrono::duration<double, milli>(chrono::steady_clock::now() - wallStart).count();
+    double cpu = 1000.0 * (double) (clock() - cpuStart) / CLOCKS_PER_SEC;
+    depth--;
+
+    lock_guard<mutex> lock(statsMutex);
+    phases[index].wall = wall;
+    phases[index].cpu = cpu;
+}
+
+/** String as a JSON string */
+static string quote(const string& str) {
+    stringstream ss;
+    ss << '"';
+    for (auto it = str.begin(); it != str.end(); it++) {
+        if (*it == '"' || *it == '\\')
+            ss << '\\' << *it;
+        else if ((unsigned char) *it < 0x20)
+            ss << "\\u" << hex << setw(4) << setfill('0') << (int) *it << dec << setfill(' ');
+        else
+            ss << *it;
+    }
+    ss << '"';
+    return ss.str();
+}
+
+string Stats::report(bool json, function<string(unsigned)> nodeKindName) {
+    lock_guard<mutex> lock(statsMutex);
+
+    Counters total = Counters();
+    for (auto countersIt = allCounters.begin(); countersIt != allCounters.end(); countersIt++) {
+        for (unsigned i = 0; i < STAT_COUNTER_COUNT; i++)
+            total.values[i] += (*countersIt)->values[i];
+        for (unsigned i = 0; i < MAX_NODE_KINDS; i++)
+            total.nodes[i] += (*countersIt)->nodes[i];
+    }
+
+    stringstream ss;
+    ss << fixed << setprecision(3);
+
+    if (json) {
+        ss << "{\"phases\":[";
+        for (auto phaseIt = phases.begin(); phaseIt != phases.end(); phaseIt++) {
+            ss << (phaseIt == phases.begin() ? "" : ",")
+               << "{\"phase\":" << quote(phaseIt->name) << ",\"subject\":" << quote(phaseIt->subject)
+               << ",\"depth\":" << phaseIt->depth
+               << ",\"wall_ms\":" << phaseIt->wall << ",\"cpu_ms\":" << phaseIt->cpu << "}";
+        }
+
+        ss << "],\"counters\":{";
+        for (unsigned i = 0; i < STAT_COUNTER_COUNT; i++) {
+            ss << (i == 0 ? "" : ",") << "\"" << COUNTER_NAMES[i] << "\":" << total.values[i];
+        }
+
+        ss << "},\"nodes\":{";
+        bool first = true;
+        for (unsigned i = 0; i < MAX_NODE_KINDS; i++) {
+            if (total.nodes[i]) {
+                ss << (first ? "" : ",") << quote(nodeKindName(i)) << ":" << total.nodes[i];
+                first = false;
+            }
+        }
+        ss << "}}" << endl;
+    } else {
+        ss << "Phases (wall ms / CPU ms):" << endl;
+        for (auto phaseIt = phases.begin(); phaseIt != phases.end(); phaseIt++) {
+            stringstream name;
+            name << string(2 * phaseIt->depth + 2, ' ') << phaseIt->name << " " << phaseIt->subject;
+            ss << left << setw(60) << name.str() << right
+               << setw(12) << phaseIt->wall << setw(12) << phaseIt->cpu << endl;
+        }
+
+        ss << "Counters:" << endl;
+        for (unsigned i = 0; i < STAT_COUNTER_COUNT; i++) {
+            ss << "  " << left << setw(30) << COUNTER_NAMES[i] << right << setw(14) << total.values[i] << endl;
+        }
+
+        ss << "Nodes built:" << endl;
+        for (unsigned i = 0; i < MAX_NODE_KINDS; i++) {
+            if (total.nodes[i])
+                ss << "  " << left << setw(40) << nodeKindName(i) << right << setw(14) << total.nodes[i] << endl;
+        }
+    }
+
+    return ss.str();
+}
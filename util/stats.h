@@ -0,0 +1,103 @@
+/**
+ * \file stats.h
+ * \brief Timing of the phases of an execution, and counters of the work done in them.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_STATS_H
+#define SMTLIB_PARSER_STATS_H
+
+#include <chrono>
+#include <ctime>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace smtlib {
+    /**
+     * Process-wide statistics, only collected once enabled. While they are not,
+     * timers and counters only cost a test of a flag.
+     *
+     * Counters are kept by each thread on its own, and only added up for the report,
+     * which should be built once the threads that did the work are idle.
+     */
+    class Stats {
+    public:
+        enum Counter {
+            STAT_SORT_LOOKUPS = 0,
+            STAT_FUN_LOOKUPS,
+            STAT_VAR_LOOKUPS,
+            STAT_LOOKUP_DEPTH,
+            STAT_SORT_EXPANSIONS,
+            STAT_SORT_EXPANSIONS_UNCACHED,
+            STAT_SORT_COMPARISONS,
+            STAT_COUNTER_COUNT
+        };
+
+        /** Upper bound on the number of kinds of nodes counted */
+        static const unsigned MAX_NODE_KINDS = 128;
+
+        /**
+         * Records the wall and CPU time of a phase, from its construction to its destruction.
+         * The CPU time is that of the whole process, so it includes the time of helper threads.
+         */
+        class Timer {
+        private:
+            long index;
+            std::chrono::steady_clock::time_point wallStart;
+            std::clock_t cpuStart;
+
+        public:
+            /**
+             * \param phase     Name of the phase
+             * \param subject   File, theory or logic the phase works on
+             */
+            Timer(const char* phase, const std::string& subject);
+
+            ~Timer();
+
+            Timer(const Timer&) = delete;
+            Timer& operator=(const Timer&) = delete;
+        };
+
+    private:
+        static bool enabled;
+
+        struct Counters {
+            unsigned long values[STAT_COUNTER_COUNT];
+            unsigned long nodes[MAX_NODE_KINDS];
+        };
+
+        /** Counters of every thread that counted something */
+        static std::vector<std::unique_ptr<Counters>> allCounters;
+
+        /** Counters of the calling thread, set up the first time it counts something */
+        static Counters& local();
+
+    public:
+        /** Start collecting statistics. Should be called before any other thread is started. */
+        static void enable();
+
+        static inline bool isEnabled() { return enabled; }
+
+        static inline void count(Counter counter, unsigned long amount = 1) {
+            if (enabled)
+                local().values[counter] += amount;
+        }
+
+        static inline void countNode(unsigned kind) {
+            if (enabled)
+                local().nodes[kind]++;
+        }
+
+        /**
+         * Report of the phases, in the order in which they started, and of the counters
+         * \param json          Whether to build a JSON object, instead of text
+         * \param nodeKindName  Name of a kind of node
+         */
+        static std::string report(bool json, std::function<std::string(unsigned)> nodeKindName);
+    };
+}
+
+#endif //SMTLIB_PARSER_STATS_H
@@ -0,0 +1,91 @@
+#include "symbol_syntax.h"
+
+using namespace std;
+using namespace smtlib;
+
+/** Character may start a simple symbol */
+static const unsigned char SIMPLE_BEGIN = 1;
+/** Character may follow the first one in a simple symbol */
+static const unsigned char SIMPLE_CONTINUE = 2;
+/** Character may appear between the bars of a quoted symbol */
+static const unsigned char QUOTED = 4;
+
+/** Classes of each byte */
+struct CharClasses {
+    unsigned char classes[256];
+
+    CharClasses() {
+        for (int c = 0; c < 256; c++) {
+            classes[c] = 0;
+        }
+
+        // Letters, digits and the special characters ~ ! @ $ % ^ & * _ - + = < > . ? /
+        for (int c = 'a'; c <= 'z'; c++) {
+            classes[c] |= SIMPLE_BEGIN | SIMPLE_CONTINUE;
+        }
+        for (int c = 'A'; c <= 'Z'; c++) {
+            classes[c] |= SIMPLE_BEGIN | SIMPLE_CONTINUE;
+        }
+        for (int c = '0'; c <= '9'; c++) {
+            classes[c] |= SIMPLE_CONTINUE;
+        }
+        const char* special = "~!@$%^&*_-+=<>.?/";
+        for (const char* c = special; *c; c++) {
+            classes[(unsigned char) *c] |= SIMPLE_BEGIN | SIMPLE_CONTINUE;
+        }
+
+        // Printable characters other than '|' and '\', and whitespace
+        for (int c = 0x20; c <= 0x7E; c++) {
+            if (c != '|' && c != '\\')
+                classes[c] |= QUOTED;
+        }
+        for (int c = 0xA0; c <= 0xFF; c++) {
+            classes[c] |= QUOTED;
+        }
+        classes[(unsigned char) '\t'] |= QUOTED;
+        classes[(unsigned char) '\r'] |= QUOTED;
+        classes[(unsigned char) '\n'] |= QUOTED;
+    }
+
+    inline bool has(char c, unsigned char cls) const {
+        return (classes[(unsigned char) c] & cls) != 0;
+    }
+};
+
+static const CharClasses charClasses;
+
+/** Checks whether the characters of a value, from a given position on, form a simple symbol */
+static bool isSimpleSymbol(const string& value, size_t pos) {
+    size_t size = value.size();
+    if (pos >= size || !charClasses.has(value[pos], SIMPLE_BEGIN))
+        return false;
+
+    for (pos++; pos < size; pos++) {
+        if (!charClasses.has(value[pos], SIMPLE_CONTINUE))
+            return false;
+    }
+
+    return true;
+}
+
+/** Checks whether a value is a quoted symbol */
+static bool isQuotedSymbol(const string& value) {
+    size_t size = value.size();
+    if (size < 2 || value[0] != '|' || value[size - 1] != '|')
+        return false;
+
+    for (size_t pos = 1; pos < size - 1; pos++) {
+        if (!charClasses.has(value[pos], QUOTED))
+            return false;
+    }
+
+    return true;
+}
+
+bool SymbolSyntax::isSymbol(const string& value) {
+    return isSimpleSymbol(value, 0) || isQuotedSymbol(value);
+}
+
+bool SymbolSyntax::isKeyword(const string& value) {
+    return (!value.empty() && value[0] == ':' && isSimpleSymbol(value, 1)) || isQuotedSymbol(value);
+}
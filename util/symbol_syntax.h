@@ -0,0 +1,27 @@
+/**
+ * \file symbol_syntax.h
+ * \brief Well-formedness of symbols and keywords.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_SYMBOL_SYNTAX_H
+#define SMTLIB_PARSER_SYMBOL_SYNTAX_H
+
+#include <string>
+
+namespace smtlib {
+    /**
+     * Checks symbols and keywords against the SMT-LIB lexical rules, one
+     * character at a time, using a table with the classes of all 256 bytes.
+     */
+    class SymbolSyntax {
+    public:
+        /** Checks whether a value is a simple symbol (e.g. "x!1") or a quoted symbol (e.g. "|x y|") */
+        static bool isSymbol(const std::string& value);
+
+        /** Checks whether a value is a keyword (e.g. ":named") or a quoted symbol */
+        static bool isKeyword(const std::string& value);
+    };
+}
+
+#endif //SMTLIB_PARSER_SYMBOL_SYNTAX_H
@@ -0,0 +1,84 @@
+#include "thread_pool.h"
+
+using namespace std;
+using namespace smtlib;
+
+ThreadPool::ThreadPool(unsigned long size) : stopping(false) {
+    for (unsigned long i = 0; i < size; i++) {
+        workers.push_back(thread(&ThreadPool::work, this));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    available.notify_all();
+
+    for (auto workerIt = workers.begin(); workerIt != workers.end(); workerIt++) {
+        workerIt->join();
+    }
+}
+
+ThreadPool& ThreadPool::getShared() {
+    static ThreadPool pool(thread::hardware_concurrency() > 1 ? thread::hardware_concurrency() - 1 : 0);
+    return pool;
+}
+
+void ThreadPool::forEach(unsigned long count, unsigned long taskCount,
+                         function<void(unsigned long, unsigned long)> body) {
+    shared_ptr<Parts> parts = make_shared<Parts>(body, count);
+
+    // Workers starting after all parts have been taken return right away
+    for (unsigned long task = 1; task < taskCount && task < count && !workers.empty(); task++) {
+        {
+            lock_guard<std::mutex> lock(mutex);
+            tasks.push([parts, task] { runParts(parts, task); });
+        }
+        available.notify_one();
+    }
+
+    runParts(parts, 0);
+
+    unique_lock<std::mutex> lock(parts->mutex);
+    parts->finished.wait(lock, [&parts] { return parts->done == parts->count; });
+    if (parts->error)
+        rethrow_exception(parts->error);
+}
+
+void ThreadPool::runParts(shared_ptr<Parts> parts, unsigned long task) {
+    for (unsigned long part = parts->next++; part < parts->count; part = parts->next++) {
+        exception_ptr error;
+        try {
+            parts->body(task, part);
+        } catch (...) {
+            error = current_exception();
+        }
+
+        lock_guard<std::mutex> lock(parts->mutex);
+        if (error && !parts->error)
+            parts->error = error;
+        if (++parts->done == parts->count)
+            parts->finished.notify_all();
+    }
+}
+
+void ThreadPool::work() {
+    while (true) {
+        function<void()> task;
+        {
+            unique_lock<std::mutex> lock(mutex);
+            available.wait(lock, [this] { return stopping || !tasks.empty(); });
+
+            // Queued tasks are still run when stopping
+            if (tasks.empty())
+                return;
+
+            task = move(tasks.front());
+            tasks.pop();
+        }
+
+        task();
+    }
+}
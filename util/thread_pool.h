@@ -0,0 +1,109 @@
+/**
+ * \file thread_pool.h
+ * \brief Fixed set of worker threads running submitted tasks.
+ * \author Cristina Serban <cristina.serban89@gmail.com>
+ */
+
+#ifndef SMTLIB_PARSER_THREAD_POOL_H
+#define SMTLIB_PARSER_THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace smtlib {
+    /**
+     * A fixed number of worker threads, taking tasks in the order in which they
+     * were submitted. The result of a task (or the exception it threw) is handed
+     * back through the future returned when submitting it. A pool without workers
+     * runs each task as soon as it is submitted, on the submitting thread.
+     */
+    class ThreadPool {
+    private:
+        std::vector<std::thread> workers;
+        std::queue<std::function<void()>> tasks;
+        std::mutex mutex;
+        std::condition_variable available;
+        bool stopping;
+
+        /** Progress of a call to forEach(), shared with the workers taking part in it */
+        struct Parts {
+            std::function<void(unsigned long, unsigned long)> body;
+            unsigned long count;
+            std::atomic<unsigned long> next;
+            unsigned long done;
+            std::exception_ptr error;
+            std::mutex mutex;
+            std::condition_variable finished;
+
+            inline Parts(std::function<void(unsigned long, unsigned long)> body, unsigned long count)
+                    : body(body), count(count), next(0), done(0) { }
+        };
+
+        /** Run parts, as the given task, until none are left to take */
+        static void runParts(std::shared_ptr<Parts> parts, unsigned long task);
+
+        void work();
+
+    public:
+        /** \param size Number of worker threads */
+        explicit ThreadPool(unsigned long size);
+
+        /** Runs the tasks that are still queued, then stops the workers */
+        ~ThreadPool();
+
+        ThreadPool(const ThreadPool&) = delete;
+        ThreadPool& operator=(const ThreadPool&) = delete;
+
+        /** Number of worker threads */
+        inline unsigned long getSize() { return workers.size(); }
+
+        /**
+         * Pool shared by the whole process, with one worker for each hardware thread
+         * but the one of the thread submitting tasks
+         */
+        static ThreadPool& getShared();
+
+        /**
+         * Run body(task, part) for every part from 0 to count - 1, with at most taskCount
+         * tasks taking parts in increasing order: the calling thread, as task 0, and up to
+         * taskCount - 1 workers. Each task runs on a single thread. Returns once all parts
+         * are done, rethrowing the first exception thrown by one of them.
+         * The calling thread only waits for parts that have already been taken, so this
+         * can be called from inside a task, even when all workers are busy.
+         */
+        void forEach(unsigned long count, unsigned long taskCount,
+                     std::function<void(unsigned long, unsigned long)> body);
+
+        /** Queue a task, to be run by the first free worker */
+        template<class F>
+        std::future<typename std::result_of<F()>::type> submit(F task) {
+            typedef typename std::result_of<F()>::type Result;
+
+            std::shared_ptr<std::packaged_task<Result()>> packaged =
+                    std::make_shared<std::packaged_task<Result()>>(std::move(task));
+            std::future<Result> result = packaged->get_future();
+            if (workers.empty()) {
+                (*packaged)();
+                return result;
+            }
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                tasks.push([packaged] { (*packaged)(); });
+            }
+            available.notify_one();
+            return result;
+        }
+    };
+}
+
+#endif //SMTLIB_PARSER_THREAD_POOL_H